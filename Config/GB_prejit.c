@@ -60,7 +60,18 @@ static char *GB_prejit_names [0] =
 #endif
 
 //------------------------------------------------------------------------------
-// GB_prejit: return list of PreJIT function pointers and function names
+// GB_prejit_hashes: the hash codes of the PreJIT kernels, in ascending order
+//------------------------------------------------------------------------------
+
+#if ( 0 > 0 )
+static uint64_t GB_prejit_hashes [0] =
+{
+
+} ;
+#endif
+
+//------------------------------------------------------------------------------
+// GB_prejit: return the lists of PreJIT functions, names, and hashes
 //------------------------------------------------------------------------------
 
 void GB_prejit
@@ -68,7 +79,8 @@ void GB_prejit
     int32_t *nkernels,      // return # of kernels
     void ***Kernel_handle,  // return list of function pointers to kernels
     void ***Query_handle,   // return list of function pointers to queries
-    char ***Name_handle     // return list of kernel names
+    char ***Name_handle,    // return list of kernel names
+    uint64_t **Hash_handle  // return list of kernel hashes, in ascending order
 )
 {
     (*nkernels) = 0 ;
@@ -76,10 +88,12 @@ void GB_prejit
     (*Kernel_handle) = NULL ;
     (*Query_handle) = NULL ;
     (*Name_handle) = NULL ;
+    (*Hash_handle) = NULL ;
     #else
     (*Kernel_handle) = GB_prejit_kernels ;
     (*Query_handle) = GB_prejit_queries ;
     (*Name_handle) = GB_prejit_names ;
+    (*Hash_handle) = GB_prejit_hashes ;
     #endif
 }
 
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/build_demo.c: build a matrix from an edge list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Measures how fast GrB_Matrix_build can build an n-by-n matrix from a list
+// of random unsorted edges, for a range of n.  Most of the time is spent
+// sorting the edges.  Each build is done twice: with the radix sort (the
+// default, if GrB_Matrix_build determines it to be faster), and with the
+// mergesort (GrB_set (GrB_GLOBAL, false, GxB_BUILD_RADIX_SORT)).  Both an iso
+// build (the sort of (j,i) pairs) and a build with values and duplicates
+// (the sort of (j,i,k) tuples) are timed.
+
+// usage:
+// build_demo [nedges]
+
+#include "graphblas_demos.h"
+#include "simple_rand.c"
+#undef I
+
+#include "omp.h"
+#if defined ( _OPENMP )
+#define WALLCLOCK omp_get_wtime ( )
+#else
+#define WALLCLOCK 0
+#endif
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Scalar_free (&s) ;                  \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+
+//------------------------------------------------------------------------------
+// build: build a matrix with the radix sort or the mergesort
+//------------------------------------------------------------------------------
+
+static GrB_Info build
+(
+    GrB_Matrix *A_handle,
+    double *t,              // time to build the matrix
+    bool radix,             // if true, allow the radix sort
+    bool iso,               // if true, build an iso matrix
+    GrB_Index n,
+    GrB_Index *I,
+    GrB_Index *J,
+    double *X,
+    GrB_Scalar s,
+    GrB_Index nedges
+)
+{
+    GrB_Info info ;
+    info = GrB_set (GrB_GLOBAL, (int32_t) radix, GxB_BUILD_RADIX_SORT) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GrB_Matrix_new (A_handle, GrB_FP64, n, n) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    double t0 = WALLCLOCK ;
+    info = iso ?
+        GxB_Matrix_build_Scalar (*A_handle, I, J, s, nedges) :
+        GrB_Matrix_build_FP64 (*A_handle, I, J, X, nedges, GrB_PLUS_FP64) ;
+    (*t) = WALLCLOCK - t0 ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// build_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Info info ;
+
+    GrB_Index nedges = (argc > 1) ? strtoull (argv [1], NULL, 0) : 10000000 ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int32_t nthreads ;
+    OK (GrB_get (GrB_GLOBAL, &nthreads, GxB_NTHREADS)) ;
+    printf ("build demo: nthreads %d, %g edges\n", nthreads, (double) nedges) ;
+    printf ("rates are in millions of edges per second\n\n") ;
+    printf ("      n         iso: radix   merge  speedup"
+            "    non-iso: radix   merge  speedup\n") ;
+
+    I = malloc (nedges * sizeof (GrB_Index)) ;
+    J = malloc (nedges * sizeof (GrB_Index)) ;
+    X = malloc (nedges * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+    OK (GrB_Scalar_new (&s, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (s, 1)) ;
+
+    for (int e = 10 ; e <= 40 ; e += 6)
+    {
+
+        //----------------------------------------------------------------------
+        // create the edges
+        //----------------------------------------------------------------------
+
+        GrB_Index n = ((GrB_Index) 1) << e ;
+        simple_rand_seed (1) ;
+        for (GrB_Index k = 0 ; k < nedges ; k++)
+        {
+            I [k] = simple_rand_i ( ) % n ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 1 ;
+        }
+
+        //----------------------------------------------------------------------
+        // build the matrix both ways, and check the results
+        //----------------------------------------------------------------------
+
+        double t [2][2] ;
+        for (int iso = 1 ; iso >= 0 ; iso--)
+        {
+            OK (build (&A, &t [iso][0], true,  iso, n, I, J, X, s, nedges)) ;
+            OK (build (&B, &t [iso][1], false, iso, n, I, J, X, s, nedges)) ;
+            // check if A and B are equal
+            GrB_Index anvals, bnvals, cnvals ;
+            bool ok ;
+            OK (GrB_Matrix_new (&C, GrB_BOOL, n, n)) ;
+            OK (GrB_eWiseMult (C, NULL, NULL, GrB_EQ_FP64, A, B, NULL)) ;
+            OK (GrB_Matrix_nvals (&anvals, A)) ;
+            OK (GrB_Matrix_nvals (&bnvals, B)) ;
+            OK (GrB_Matrix_nvals (&cnvals, C)) ;
+            OK (GrB_reduce (&ok, NULL, GrB_LAND_MONOID_BOOL, C, NULL)) ;
+            CHECK (ok && anvals == bnvals && anvals == cnvals, GrB_PANIC) ;
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+            GrB_Matrix_free (&C) ;
+        }
+
+        printf ("2^%-2d %17.2f %7.2f %8.2f %18.2f %7.2f %8.2f\n", e,
+            1e-6 * nedges / t [1][0], 1e-6 * nedges / t [1][1],
+            t [1][1] / t [1][0],
+            1e-6 * nedges / t [0][0], 1e-6 * nedges / t [0][1],
+            t [0][1] / t [0][0]) ;
+    }
+
+    OK (GrB_set (GrB_GLOBAL, (int32_t) true, GxB_BUILD_RADIX_SORT)) ;
+    FREE_ALL ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
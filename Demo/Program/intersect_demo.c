@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/intersect_demo.c: sparse set intersection rates
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Measures how many intersections of two sorted index lists GraphBLAS can do
+// per second, for a range of ratios of the two list lengths.  Each list is a
+// column of a sparse matrix.  Column j of A has alen entries and column j of
+// B has alen*ratio entries, with few entries in common, as is typical of
+// triangle counting.  Two methods are timed:
+
+//  dot3:  C<M>=A'*B with the PLUS_PAIR semiring, where M is diagonal.
+//         Each C(j,j) is the size of the intersection of A(:,j) and B(:,j).
+//  emult: C=A.*B with the PAIR operator.
+
+// The list intersection method is selected at run time, from the cpu features
+// (AVX2 or AVX512F block compares when the lists have similar lengths, and a
+// galloping search when one list is much longer than the other).
+
+// usage:
+// intersect_demo [alen [ncols]]
+
+#include "graphblas_demos.h"
+#include "simple_rand.c"
+#undef I
+
+#include "omp.h"
+#if defined ( _OPENMP )
+#define WALLCLOCK omp_get_wtime ( )
+#else
+#define WALLCLOCK 0
+#endif
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&M) ;                  \
+    GrB_Descriptor_free (&desc) ;           \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+
+//------------------------------------------------------------------------------
+// random_columns: create a matrix with len entries in each column
+//------------------------------------------------------------------------------
+
+// The row indices of each column are chosen from a jittered grid, so they are
+// distinct and already sorted.
+
+static GrB_Info random_columns
+(
+    GrB_Matrix *A_handle,
+    GrB_Index vlen,
+    GrB_Index ncols,
+    GrB_Index len,
+    GrB_Index *I,
+    GrB_Index *J,
+    bool *X
+)
+{
+    GrB_Info info ;
+    GrB_Index stride = vlen / len ;
+    GrB_Index nz = 0 ;
+    for (GrB_Index j = 0 ; j < ncols ; j++)
+    {
+        for (GrB_Index k = 0 ; k < len ; k++)
+        {
+            I [nz] = k * stride + (simple_rand ( ) % stride) ;
+            J [nz] = j ;
+            X [nz] = true ;
+            nz++ ;
+        }
+    }
+    info = GrB_Matrix_new (A_handle, GrB_BOOL, vlen, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GrB_set (*A_handle, GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = GrB_set (*A_handle, GxB_SPARSE, GxB_SPARSITY_CONTROL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    return (GrB_Matrix_build_BOOL (*A_handle, I, J, X, nz, GrB_LOR)) ;
+}
+
+//------------------------------------------------------------------------------
+// intersect_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, B = NULL, C = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    bool *X = NULL ;
+    GrB_Info info ;
+
+    GrB_Index alen  = (argc > 1) ? strtoull (argv [1], NULL, 0) : 64 ;
+    GrB_Index ncols = (argc > 2) ? strtoull (argv [2], NULL, 0) : 256 ;
+    int max_ratio = 512 ;
+    int ntrials = 3 ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int32_t nthreads ;
+    OK (GrB_get (GrB_GLOBAL, &nthreads, GxB_NTHREADS)) ;
+    printf ("intersect demo: nthreads %d, |A(:,j)| = %g, %g columns\n",
+        nthreads, (double) alen, (double) ncols) ;
+    printf ("rates are in millions of intersections per second, and in\n"
+            "millions of list entries (|A(:,j)|+|B(:,j)|) per second\n\n") ;
+    printf ("  ratio      |B(:,j)|  dot3: isect/s  entries/s"
+            "   emult: isect/s  entries/s\n") ;
+
+    I = malloc (alen * max_ratio * ncols * sizeof (GrB_Index)) ;
+    J = malloc (alen * max_ratio * ncols * sizeof (GrB_Index)) ;
+    X = malloc (alen * max_ratio * ncols * sizeof (bool)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+
+    // C<M>=A'*B with M diagonal and structural, and computed via dot3
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_set (desc, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_set (desc, GrB_STRUCTURE, GrB_MASK)) ;
+    OK (GrB_set (desc, GxB_AxB_DOT, GxB_AxB_METHOD)) ;
+
+    for (int ratio = 1 ; ratio <= max_ratio ; ratio *= 2)
+    {
+
+        //----------------------------------------------------------------------
+        // create the problem
+        //----------------------------------------------------------------------
+
+        // the index lists are 1/8th full, so the intersections are small
+        GrB_Index blen = alen * ratio ;
+        GrB_Index vlen = 8 * blen ;
+        simple_rand_seed (1) ;
+        OK (random_columns (&A, vlen, ncols, alen, I, J, X)) ;
+        OK (random_columns (&B, vlen, ncols, blen, I, J, X)) ;
+        OK (GrB_Matrix_new (&M, GrB_BOOL, ncols, ncols)) ;
+        for (GrB_Index j = 0 ; j < ncols ; j++)
+        {
+            OK (GrB_Matrix_setElement_BOOL (M, true, j, j)) ;
+        }
+        OK (GrB_wait (M, GrB_MATERIALIZE)) ;
+        double entries = (double) (alen + blen) * (double) ncols ;
+
+        //----------------------------------------------------------------------
+        // dot3: C<M>=A'*B
+        //----------------------------------------------------------------------
+
+        // the first trial is not timed, since it may compile a JIT kernel
+        double tdot = 0 ;
+        for (int trial = 0 ; trial <= ntrials ; trial++)
+        {
+            OK (GrB_Matrix_new (&C, GrB_INT64, ncols, ncols)) ;
+            double t = WALLCLOCK ;
+            OK (GrB_mxm (C, M, NULL, GxB_PLUS_PAIR_INT64, A, B, desc)) ;
+            if (trial > 0) tdot += (WALLCLOCK - t) / ntrials ;
+            GrB_Matrix_free (&C) ;
+        }
+
+        //----------------------------------------------------------------------
+        // emult: C=A.*B
+        //----------------------------------------------------------------------
+
+        double temult = 0 ;
+        for (int trial = 0 ; trial <= ntrials ; trial++)
+        {
+            OK (GrB_Matrix_new (&C, GrB_BOOL, vlen, ncols)) ;
+            OK (GrB_set (C, GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+            double t = WALLCLOCK ;
+            OK (GrB_eWiseMult (C, NULL, NULL, GxB_PAIR_BOOL, A, B, NULL)) ;
+            if (trial > 0) temult += (WALLCLOCK - t) / ntrials ;
+            GrB_Matrix_free (&C) ;
+        }
+
+        printf ("%7d %13g  %13.3f %10.3f  %15.3f %10.3f\n", ratio,
+            (double) blen,
+            1e-6 * ncols / tdot, 1e-6 * entries / tdot,
+            1e-6 * ncols / temult, 1e-6 * entries / temult) ;
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+        GrB_Matrix_free (&M) ;
+    }
+
+    FREE_ALL ;
+    GrB_finalize ( ) ;
+    return (0) ;
+}
+
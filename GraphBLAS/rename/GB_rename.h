@@ -56,6 +56,11 @@
 #define GB_AxB_saxpy3_generic_unflipped GM_AxB_saxpy3_generic_unflipped
 #define GB_AxB_saxpy3 GM_AxB_saxpy3
 #define GB_AxB_saxpy3_jit GM_AxB_saxpy3_jit
+#define GB_AxB_saxpy3_plan_find GM_AxB_saxpy3_plan_find
+#define GB_AxB_saxpy3_plan_key GM_AxB_saxpy3_plan_key
+#define GB_AxB_saxpy3_plan_save GM_AxB_saxpy3_plan_save
+#define GB_AxB_saxpy3_plans_free GM_AxB_saxpy3_plans_free
+#define GB_AxB_saxpy3_plan_tasks GM_AxB_saxpy3_plan_tasks
 #define GB_AxB_saxpy3_slice_balanced GM_AxB_saxpy3_slice_balanced
 #define GB_AxB_saxpy3_slice_quick GM_AxB_saxpy3_slice_quick
 #define GB_AxB_saxpy3_sym_bh GM_AxB_saxpy3_sym_bh
@@ -99,6 +104,8 @@
 #define GB_AxB_saxpy3_sym_sf GM_AxB_saxpy3_sym_sf
 #define GB_AxB_saxpy3_sym_sh GM_AxB_saxpy3_sym_sh
 #define GB_AxB_saxpy3_sym_ss GM_AxB_saxpy3_sym_ss
+#define GB_AxB_saxpy3_werk_free GM_AxB_saxpy3_werk_free
+#define GB_AxB_saxpy3_werk_get GM_AxB_saxpy3_werk_get
 #define GB_AxB_saxpy4 GM_AxB_saxpy4
 #define GB_AxB_saxpy4_jit GM_AxB_saxpy4_jit
 #define GB_AxB_saxpy4_tasks GM_AxB_saxpy4_tasks
@@ -108,6 +115,9 @@
 #define GB_AxB_saxpy GM_AxB_saxpy
 #define GB_AxB_saxpy_sparsity GM_AxB_saxpy_sparsity
 #define GB_AxB_semiring_builtin GM_AxB_semiring_builtin
+#define GB_batch_check GM_batch_check
+#define GB_batch_lookup GM_batch_lookup
+#define GB_batch_wait GM_batch_wait
 #define GB_BinaryOp_check GM_BinaryOp_check
 #define GB_BinaryOp_compatible GM_BinaryOp_compatible
 #define GB_binop_builtin GM_binop_builtin
@@ -175,8 +185,14 @@
 #define GB_block GM_block
 #define GB_boolean_rename GM_boolean_rename
 #define GB_boolean_rename_op GM_boolean_rename_op
+#define GB_Builder_clear GM_Builder_clear
 #define GB_builder GM_builder
+#define GB_Builder_merge GM_Builder_merge
 #define GB_build GM_build
+#define GB_build_hash_control_get GM_build_hash_control_get
+#define GB_build_hash_control_set GM_build_hash_control_set
+#define GB_build_hash_dupl GM_build_hash_dupl
+#define GB_build_hash GM_build_hash
 #define GB_build_jit GM_build_jit
 #define GB_callback GM_callback
 #define GB_calloc_memory GM_calloc_memory
@@ -230,6 +246,9 @@
 #define GB_concat_hyper GM_concat_hyper
 #define GB_concat_sparse GM_concat_sparse
 #define GB_concat_sparse_jit GM_concat_sparse_jit
+#define GB_Concurrent_clear GM_Concurrent_clear
+#define GB_Concurrent_free GM_Concurrent_free
+#define GB_Concurrent_wait GM_Concurrent_wait
 #define GB_conform GM_conform
 #define GB_conform_hyper GM_conform_hyper
 #define GB_Context_check GM_Context_check
@@ -241,9 +260,18 @@
 #define GB_Context_gpu_id_get GM_Context_gpu_id_get
 #define GB_Context_gpu_id GM_Context_gpu_id
 #define GB_Context_gpu_id_set GM_Context_gpu_id_set
+#define GB_Context_mxm_plan_max_get GM_Context_mxm_plan_max_get
+#define GB_Context_mxm_plan_max_set GM_Context_mxm_plan_max_set
+#define GB_Context_mxm_plans GM_Context_mxm_plans
+#define GB_Context_mxm_workspace_get GM_Context_mxm_workspace_get
+#define GB_Context_mxm_workspace GM_Context_mxm_workspace
+#define GB_Context_mxm_workspace_set GM_Context_mxm_workspace_set
 #define GB_Context_nthreads_max_get GM_Context_nthreads_max_get
 #define GB_Context_nthreads_max GM_Context_nthreads_max
 #define GB_Context_nthreads_max_set GM_Context_nthreads_max_set
+#define GB_Context_numa_first_touch_get GM_Context_numa_first_touch_get
+#define GB_Context_numa_first_touch GM_Context_numa_first_touch
+#define GB_Context_numa_first_touch_set GM_Context_numa_first_touch_set
 #define GB_CONTEXT_THREAD GM_CONTEXT_THREAD
 #define GB_convert_any_to_bitmap GM_convert_any_to_bitmap
 #define GB_convert_any_to_full GM_convert_any_to_full
@@ -279,7 +307,12 @@
 #define GB_Descriptor_get GM_Descriptor_get
 #define GB_deserialize_from_blob GM_deserialize_from_blob
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_stream GM_deserialize_stream
+#define GB_deserialize_unfilter GM_deserialize_unfilter
 #define GB_dup GM_dup
+#define GB_dup_shared_control_get GM_dup_shared_control_get
+#define GB_dup_shared_control_set GM_dup_shared_control_set
+#define GB_dup_shared GM_dup_shared
 #define GB_dup_worker GM_dup_worker
 #define GB_ek_slice GM_ek_slice
 #define GB_ek_slice_merge1 GM_ek_slice_merge1
@@ -386,6 +419,7 @@
 #define GB_Global_calloc_function_set GM_Global_calloc_function_set
 #define GB_Global_cpu_features_avx2 GM_Global_cpu_features_avx2
 #define GB_Global_cpu_features_avx512f GM_Global_cpu_features_avx512f
+#define GB_Global_cpu_features_isa GM_Global_cpu_features_isa
 #define GB_Global_cpu_features_query GM_Global_cpu_features_query
 #define GB_Global_flush_get GM_Global_flush_get
 #define GB_Global_flush_set GM_Global_flush_set
@@ -522,11 +556,14 @@
 #define GB_ix_realloc GM_ix_realloc
 #define GB_jitifyer_alloc_space GM_jitifyer_alloc_space
 #define GB_jitifyer_cmake_compile GM_jitifyer_cmake_compile
+#define GB_jitifyer_copy_record_file GM_jitifyer_copy_record_file
 #define GB_jitifyer_direct_compile GM_jitifyer_direct_compile
 #define GB_jitifyer_entry_free GM_jitifyer_entry_free
 #define GB_jitifyer_establish_paths GM_jitifyer_establish_paths
+#define GB_jitifyer_export GM_jitifyer_export
 #define GB_jitifyer_extract_JITpackage GM_jitifyer_extract_JITpackage
 #define GB_jitifyer_finalize GM_jitifyer_finalize
+#define GB_jitifyer_get_async GM_jitifyer_get_async
 #define GB_jitifyer_get_cache_path GM_jitifyer_get_cache_path
 #define GB_jitifyer_get_C_cmake_libs GM_jitifyer_get_C_cmake_libs
 #define GB_jitifyer_get_C_compiler GM_jitifyer_get_C_compiler
@@ -537,11 +574,14 @@
 #define GB_jitifyer_get_C_preface GM_jitifyer_get_C_preface
 #define GB_jitifyer_get_CUDA_preface GM_jitifyer_get_CUDA_preface
 #define GB_jitifyer_get_error_log GM_jitifyer_get_error_log
+#define GB_jitifyer_get_record_file GM_jitifyer_get_record_file
+#define GB_jitifyer_get_tune_reduce_panel GM_jitifyer_get_tune_reduce_panel
 #define GB_jitifyer_get_use_cmake GM_jitifyer_get_use_cmake
 #define GB_jitifyer_hash_encoding GM_jitifyer_hash_encoding
 #define GB_jitifyer_hash GM_jitifyer_hash
 #define GB_jitifyer_init GM_jitifyer_init
 #define GB_jitifyer_insert GM_jitifyer_insert
+#define GB_jitifyer_kernel_list GM_jitifyer_kernel_list
 #define GB_jitifyer_load2_worker GM_jitifyer_load2_worker
 #define GB_jitifyer_load GM_jitifyer_load
 #define GB_jitifyer_load_worker GM_jitifyer_load_worker
@@ -550,6 +590,7 @@
 #define GB_jitifyer_path_256 GM_jitifyer_path_256
 #define GB_jitifyer_query GM_jitifyer_query
 #define GB_jitifyer_sanitize GM_jitifyer_sanitize
+#define GB_jitifyer_set_async GM_jitifyer_set_async
 #define GB_jitifyer_set_cache_path GM_jitifyer_set_cache_path
 #define GB_jitifyer_set_cache_path_worker GM_jitifyer_set_cache_path_worker
 #define GB_jitifyer_set_C_cmake_libs GM_jitifyer_set_C_cmake_libs
@@ -569,8 +610,12 @@
 #define GB_jitifyer_set_CUDA_preface_worker GM_jitifyer_set_CUDA_preface_worker
 #define GB_jitifyer_set_error_log GM_jitifyer_set_error_log
 #define GB_jitifyer_set_error_log_worker GM_jitifyer_set_error_log_worker
+#define GB_jitifyer_set_record_file GM_jitifyer_set_record_file
+#define GB_jitifyer_set_tune_reduce_panel GM_jitifyer_set_tune_reduce_panel
 #define GB_jitifyer_set_use_cmake GM_jitifyer_set_use_cmake
 #define GB_jitifyer_table_free GM_jitifyer_table_free
+#define GB_jitifyer_tune_panel GM_jitifyer_tune_panel
+#define GB_jitifyer_warmup GM_jitifyer_warmup
 #define GB_JITpackage_0 GM_JITpackage_0
 #define GB_JITpackage_100 GM_JITpackage_100
 #define GB_JITpackage_101 GM_JITpackage_101
@@ -852,6 +897,7 @@
 #define GB_JITpackage_350 GM_JITpackage_350
 #define GB_JITpackage_351 GM_JITpackage_351
 #define GB_JITpackage_352 GM_JITpackage_352
+#define GB_JITpackage_353 GM_JITpackage_353
 #define GB_JITpackage_35 GM_JITpackage_35
 #define GB_JITpackage_36 GM_JITpackage_36
 #define GB_JITpackage_37 GM_JITpackage_37
@@ -1070,8 +1116,30 @@
 #define GB_matvec_type GM_matvec_type
 #define GB_matvec_type_name GM_matvec_type_name
 #define GB_memcpy GM_memcpy
+#define GB_memory_first_touch GM_memory_first_touch
+#define GB_memory_huge_pages_control_get GM_memory_huge_pages_control_get
+#define GB_memory_huge_pages_control_set GM_memory_huge_pages_control_set
+#define GB_memory_huge_pages_malloc GM_memory_huge_pages_malloc
+#define GB_memory_pool_control_get GM_memory_pool_control_get
+#define GB_memory_pool_control_set GM_memory_pool_control_set
+#define GB_memory_pool_finalize GM_memory_pool_finalize
+#define GB_memory_pool_flush GM_memory_pool_flush
+#define GB_memory_pool_forget GM_memory_pool_forget
+#define GB_memory_pool_get GM_memory_pool_get
+#define GB_memory_pool_import GM_memory_pool_import
+#define GB_memory_pool_limits_get GM_memory_pool_limits_get
+#define GB_memory_pool_limits_set GM_memory_pool_limits_set
+#define GB_memory_pool_max_bytes_get GM_memory_pool_max_bytes_get
+#define GB_memory_pool_max_bytes_set GM_memory_pool_max_bytes_set
+#define GB_memory_pool_put GM_memory_pool_put
+#define GB_memory_pool_round GM_memory_pool_round
+#define GB_memory_pool_stats_clear GM_memory_pool_stats_clear
+#define GB_memory_pool_stats_get GM_memory_pool_stats_get
 #define GB_memoryUsage GM_memoryUsage
 #define GB_memset GM_memset
+#define GB_mmap_read GM_mmap_read
+#define GB_mmap_unmap GM_mmap_unmap
+#define GB_mmap_write GM_mmap_write
 #define GB_Monoid_check GM_Monoid_check
 #define GB_monoid_get GM_monoid_get
 #define GB_monoid_name_get GM_monoid_name_get
@@ -1108,6 +1176,7 @@
 #define GB_Pending_alloc GM_Pending_alloc
 #define GB_Pending_ensure GM_Pending_ensure
 #define GB_Pending_free GM_Pending_free
+#define GB_Pending_gather GM_Pending_gather
 #define GB_Pending_n GM_Pending_n
 #define GB_Pending_realloc GM_Pending_realloc
 #define GB_phybix_free GM_phybix_free
@@ -1145,6 +1214,10 @@
 #define GB_qsort_1 GM_qsort_1
 #define GB_qsort_2 GM_qsort_2
 #define GB_qsort_3 GM_qsort_3
+#define GB_radix_sort_control_get GM_radix_sort_control_get
+#define GB_radix_sort_control_set GM_radix_sort_control_set
+#define GB_radix_sort GM_radix_sort
+#define GB_radix_sort_nbits GM_radix_sort_nbits
 #define GB_realloc_memory GM_realloc_memory
 #define GB_reduce_to_scalar GM_reduce_to_scalar
 #define GB_reduce_to_scalar_iso GM_reduce_to_scalar_iso
@@ -1179,13 +1252,19 @@
 #define GB_semiring_name_get GM_semiring_name_get
 #define GB_Semiring_new GM_Semiring_new
 #define GB_serialize_array GM_serialize_array
+#define GB_serialize_filter GM_serialize_filter
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize GM_serialize
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream GM_serialize_stream
 #define GB_serialize_to_blob GM_serialize_to_blob
+#define GB_setElement_concurrent GM_setElement_concurrent
+#define GB_setElement_concurrent_supported GM_setElement_concurrent_supported
 #define GB_setElement GM_setElement
 #define GB_shallow_copy GM_shallow_copy
 #define GB_shallow_op GM_shallow_op
+#define GB_shared_create GM_shared_create
+#define GB_shared_free GM_shared_free
 #define GB_signumf GM_signumf
 #define GB_signum GM_signum
 #define GB_slice_vector GM_slice_vector
@@ -1269,12 +1348,14 @@
 #define GB_unop_iso GM_unop_iso
 #define GB_unop_new GM_unop_new
 #define GB_unop_one GM_unop_one
+#define GB_unshare GM_unshare
 #define GB_user_name_set GM_user_name_set
 #define GB_user_op_jit GM_user_op_jit
 #define GB_user_type_jit GM_user_type_jit
 #define GB_Vector_check GM_Vector_check
 #define GB_Vector_diag GM_Vector_diag
 #define GB_Vector_removeElement GM_Vector_removeElement
+#define GB_view GM_view
 #define GB_wait GM_wait
 #define GB_werk_pop GM_werk_pop
 #define GB_werk_push GM_werk_push
@@ -3076,6 +3157,10 @@
 #define GxB_BSHIFT_UINT32 GxM_BSHIFT_UINT32
 #define GxB_BSHIFT_UINT64 GxM_BSHIFT_UINT64
 #define GxB_BSHIFT_UINT8 GxM_BSHIFT_UINT8
+#define GxB_Builder_append GxM_Builder_append
+#define GxB_Builder_finish GxM_Builder_finish
+#define GxB_Builder_free GxM_Builder_free
+#define GxB_Builder_new GxM_Builder_new
 #define GxB_BXNOR_BAND_UINT16 GxM_BXNOR_BAND_UINT16
 #define GxB_BXNOR_BAND_UINT32 GxM_BXNOR_BAND_UINT32
 #define GxB_BXNOR_BAND_UINT64 GxM_BXNOR_BAND_UINT64
@@ -3420,6 +3505,8 @@
 #define GxB_ISNE_UINT32 GxM_ISNE_UINT32
 #define GxB_ISNE_UINT64 GxM_ISNE_UINT64
 #define GxB_ISNE_UINT8 GxM_ISNE_UINT8
+#define GxB_JIT_export GxM_JIT_export
+#define GxB_JIT_warmup GxM_JIT_warmup
 #define GxB_kron GxM_kron
 #define GxB_LAND_BOOL GxM_LAND_BOOL
 #define GxB_LAND_BOOL_MONOID GxM_LAND_BOOL_MONOID
@@ -3720,7 +3807,10 @@
 #define GxB_Matrix_build_FC64 GxM_Matrix_build_FC64
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
+#define GxB_Matrix_deleteTuples GxM_Matrix_deleteTuples
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
+#define GxB_Matrix_deserialize_view GxM_Matrix_deserialize_view
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
@@ -3748,9 +3838,12 @@
 #define GxB_Matrix_import_FullR GxM_Matrix_import_FullR
 #define GxB_Matrix_import_HyperCSC GxM_Matrix_import_HyperCSC
 #define GxB_Matrix_import_HyperCSR GxM_Matrix_import_HyperCSR
+#define GxB_Matrix_insertTuples GxM_Matrix_insertTuples
 #define GxB_Matrix_iso GxM_Matrix_iso
 #define GxB_Matrix_isStoredElement GxM_Matrix_isStoredElement
 #define GxB_Matrix_memoryUsage GxM_Matrix_memoryUsage
+#define GxB_Matrix_mmap_read GxM_Matrix_mmap_read
+#define GxB_Matrix_mmap_write GxM_Matrix_mmap_write
 #define GxB_Matrix_Option_get_FP64 GxM_Matrix_Option_get_FP64
 #define GxB_Matrix_Option_get GxM_Matrix_Option_get
 #define GxB_Matrix_Option_get_INT32 GxM_Matrix_Option_get_INT32
@@ -3774,6 +3867,7 @@
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
 #define GxB_Matrix_sort GxM_Matrix_sort
@@ -3804,6 +3898,7 @@
 #define GxB_Matrix_unpack_FullR GxM_Matrix_unpack_FullR
 #define GxB_Matrix_unpack_HyperCSC GxM_Matrix_unpack_HyperCSC
 #define GxB_Matrix_unpack_HyperCSR GxM_Matrix_unpack_HyperCSR
+#define GxB_Matrix_view GxM_Matrix_view
 #define GxB_MAX_DIV_FP32 GxM_MAX_DIV_FP32
 #define GxB_MAX_DIV_FP64 GxM_MAX_DIV_FP64
 #define GxB_MAX_DIV_INT16 GxM_MAX_DIV_INT16
@@ -1,4 +1,4 @@
-// SuiteSparse:GraphBLAS 9.4.3
+// SuiteSparse:GraphBLAS 9.5.0
 //------------------------------------------------------------------------------
 // GraphBLAS.h: definitions for the GraphBLAS package
 //------------------------------------------------------------------------------
@@ -270,8 +270,8 @@
 #define GxB_IMPLEMENTATION_NAME "SuiteSparse:GraphBLAS"
 #define GxB_IMPLEMENTATION_DATE "Dec 20, 2024"
 #define GxB_IMPLEMENTATION_MAJOR 9
-#define GxB_IMPLEMENTATION_MINOR 4
-#define GxB_IMPLEMENTATION_SUB   3
+#define GxB_IMPLEMENTATION_MINOR 5
+#define GxB_IMPLEMENTATION_SUB   0
 #define GxB_SPEC_DATE "Dec 22, 2023"
 #define GxB_SPEC_MAJOR 2
 #define GxB_SPEC_MINOR 1
@@ -487,6 +487,16 @@ GrB_Mode ;
 // GPU control (DRAFT: in progress, do not use)
 #define GxB_GPU_ID 7088
 
+// GxB_NUMA_FIRST_TOUCH: if true, large blocks of memory are first touched in
+// parallel, so their pages are spread across the NUMA nodes of the machine
+#define GxB_NUMA_FIRST_TOUCH 7116
+
+// GxB_MXM_PLAN: # of saxpy3 analyses a GxB_Context keeps for reuse in GrB_mxm
+#define GxB_MXM_PLAN 7101
+
+// GxB_MXM_WORKSPACE: if true, a GxB_Context keeps the saxpy3 workspace
+#define GxB_MXM_WORKSPACE 7115
+
 typedef enum
 {
     GrB_OUTP = 0,   // descriptor for output of a method
@@ -1375,6 +1385,9 @@ typedef enum            // for global options or matrix options
     GxB_BITMAP_SWITCH = 7001,   // switch to bitmap (double value)
     GxB_FORMAT = 7002,          // Historical; use GrB_STORAGE_ORIENTATION_HINT
 
+    // per matrix (bool): allow GrB_*_setElement from many user threads
+    GxB_CONCURRENT_SETELEMENT = 7121,
+
     //------------------------------------------------------------
     // GrB_get for GrB_GLOBAL:
     //------------------------------------------------------------
@@ -1407,11 +1420,21 @@ typedef enum            // for global options or matrix options
     GxB_GLOBAL_NTHREADS = GxB_NTHREADS,  // max number of threads to use
     GxB_GLOBAL_CHUNK = GxB_CHUNK,        // chunk size for small problems.
     GxB_GLOBAL_GPU_ID = GxB_GPU_ID,      // which GPU to use (DRAFT)
+    GxB_GLOBAL_NUMA_FIRST_TOUCH = GxB_NUMA_FIRST_TOUCH, // parallel first
+                                     // touch of large blocks (true/false)
 
     GxB_BURBLE = 7019,               // diagnostic output
     GxB_PRINTF = 7020,               // printf function diagnostic output
     GxB_FLUSH = 7021,                // flush function diagnostic output
     GxB_MEMORY_POOL = 7022,          // no longer used
+    GxB_MEMORY_POOL_CONTROL = 7111,  // memory pool: enabled (true/false)
+    GxB_MEMORY_POOL_LIMITS = 7112,   // memory pool: max # of blocks kept
+    GxB_MEMORY_POOL_MAX_BYTES = 7113,    // memory pool: max # bytes kept
+    GxB_MEMORY_POOL_STATS = 7114,    // memory pool statistics
+    GxB_MEMORY_HUGE_PAGES = 7117,    // huge pages for large blocks (true/false)
+    GxB_DUP_COPY_ON_WRITE = 7118,    // GrB_*_dup shares arrays (true/false)
+    GxB_BUILD_RADIX_SORT = 7119,     // build may use radix sort (true/false)
+    GxB_BUILD_HASH = 7120,           // build may use a hash table (true/false)
     GxB_PRINT_1BASED = 7023,         // print matrices as 0-based or 1-based
 
     GxB_JIT_C_COMPILER_NAME = 7024,  // CPU JIT C compiler name
@@ -1424,6 +1447,9 @@ typedef enum            // for global options or matrix options
     GxB_JIT_C_CMAKE_LIBS = 7031,     // CPU JIT C libraries when using cmake
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
+    GxB_JIT_ASYNC = 7108,            // CPU JIT: compile in the background
+    GxB_JIT_RECORD_FILE = 7109,      // CPU JIT: file to record kernels used
+    GxB_JIT_TUNE_REDUCE_PANEL = 7110, // CPU JIT: tune the reduce panel size
 
     GxB_JIT_CUDA_PREFACE = 7100,     // CUDA JIT C++ preface
 
@@ -1453,6 +1479,33 @@ typedef enum
 }
 GxB_JIT_Control ;
 
+// GxB_JIT_warmup compiles a set of CPU JIT kernels ahead of time, with up to
+// ncompilers compilers running at the same time.  Each kernel is given by its
+// name (if its source is already in the JIT cache folder) or by the path to
+// its source file.  The kernels are listed in the kernels array, or in a
+// manifest file (one kernel per line), or both.  Kernels that have already
+// been compiled are skipped.
+GrB_Info GxB_JIT_warmup
+(
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest,       // manifest file, or NULL if none
+    int32_t ncompilers          // max # of compilers (<= 0: use GxB_NTHREADS)
+) ;
+
+// GxB_JIT_export writes the source files of a set of CPU JIT kernels into a
+// folder, such as GraphBLAS/PreJIT, so that they can be compiled into the
+// GraphBLAS library as PreJIT kernels.  The kernels are given as for
+// GxB_JIT_warmup.  If none are given, the kernels listed in the
+// GxB_JIT_RECORD_FILE are exported.
+GrB_Info GxB_JIT_export
+(
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest,       // manifest file, or NULL if none
+    const char *folder          // folder to write the kernel sources to
+) ;
+
 // the default hyper_switch parameter
 GB_GLOBAL const double GxB_HYPER_DEFAULT ;
 
@@ -1465,6 +1518,11 @@ GB_GLOBAL const double GxB_HYPER_DEFAULT ;
 // size of b array for GxB_set/get (GxB_BITMAP_SWITCH, b)
 #define GxB_NBITMAP_SWITCH 8    // size of bitmap_switch parameter array
 
+// size of the arrays for GrB_set/get (GrB_GLOBAL, ..., GxB_MEMORY_POOL_LIMITS)
+// and GrB_get (GrB_GLOBAL, ..., GxB_MEMORY_POOL_STATS)
+#define GxB_NMEMORY_POOL 64        // size of memory pool limits array
+#define GxB_NMEMORY_POOL_STATS 4   // size of memory pool statistics array
+
 // any sparsity value:
 #define GxB_ANY_SPARSITY (GxB_HYPERSPARSE + GxB_SPARSE + GxB_BITMAP + GxB_FULL)
 
@@ -1548,6 +1606,19 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    GxB_CONTEXT_NUMA_FIRST_TOUCH = GxB_NUMA_FIRST_TOUCH, // if true, large
+                    // blocks of memory are first touched by all threads in
+                    // parallel.  If false, by the thread that first writes
+                    // to them (the default).
+
+    GxB_CONTEXT_MXM_PLAN = GxB_MXM_PLAN, // # of C=A*B analyses to keep for
+                    // reuse by later calls to GrB_mxm, GrB_mxv, and GrB_vxm.
+                    // If <= 0, no analysis is kept (the default).
+
+    GxB_CONTEXT_MXM_WORKSPACE = GxB_MXM_WORKSPACE, // if true, keep the
+                    // workspace of GrB_mxm, GrB_mxv, and GrB_vxm for reuse
+                    // by later calls.  If false, it is freed (the default).
 }
 GxB_Context_Field ;
 
@@ -2625,6 +2696,10 @@ GB_GLOBAL const GxB_Format_Value GxB_FORMAT_DEFAULT ;
 #define GxB_COMPRESSION_LZ4   1000  // LZ4
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
 #define GxB_COMPRESSION_ZSTD  3000  // ZSTD, with default level 1
+#define GxB_COMPRESSION_ALIGNED 9000 // no compression, with each array
+                                    // aligned for GxB_Matrix_deserialize_view
+#define GxB_COMPRESSION_FILTER 100000 // add to LZ4, LZ4HC, or ZSTD: delta
+                                    // and byte-shuffle pre-filters
 
 //==============================================================================
 //=== GraphBLAS functions ======================================================
@@ -4367,6 +4442,50 @@ GrB_Info GrB_Matrix_build           // build a matrix from (I,J,X) tuples
     (C, Ilist, J, ((const void *) (X)), nvals, dup)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Builder: build a matrix from a stream of batches of tuples
+//------------------------------------------------------------------------------
+
+// A GxB_Builder accepts batches of (I,J,X) tuples, as they arrive, and
+// finishes them into a GrB_Matrix.  Each batch is sorted and built into a
+// run, and runs of similar size are merged with the dup operator
+// as more batches arrive (as in a log-structured merge tree), so the memory
+// held by the builder is proportional to the number of distinct entries, not
+// the number of tuples appended.  The result is the same as a single call to
+// GrB_Matrix_build with all the tuples, in the order they were appended,
+// except that dup must be associative.  X has the type of the builder.
+
+typedef struct GB_Builder_opaque *GxB_Builder ;
+
+GrB_Info GxB_Builder_new            // create a new builder
+(
+    GxB_Builder *builder,           // handle of builder to create
+    GrB_Type type,                  // type of the matrix to build
+    GrB_Index nrows,                // # of rows of the matrix to build
+    GrB_Index ncols,                // # of columns of the matrix to build
+    const GrB_BinaryOp dup          // binary function to assemble duplicates
+) ;
+
+GrB_Info GxB_Builder_append         // append a batch of (I,J,X) tuples
+(
+    GxB_Builder builder,            // builder to append the tuples to
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GrB_Info GxB_Builder_finish         // finish the builder into a matrix
+(
+    GrB_Matrix *C,                  // handle of matrix to create
+    GxB_Builder builder             // builder to finish; empty on output
+) ;
+
+GrB_Info GxB_Builder_free           // free a builder
+(
+    GxB_Builder *builder            // handle of builder to free
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_setElement
 //------------------------------------------------------------------------------
@@ -4693,6 +4812,37 @@ GrB_Info GrB_Matrix_removeElement
     GrB_Index j                     // column index
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_insertTuples and GxB_Matrix_deleteTuples: batch updates
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_insertTuples (C, I, J, X, nvals) sets C(I[k],J[k]) = X[k] for
+// k = 0 to nvals-1, with the same result as calling GrB_Matrix_setElement for
+// each tuple in order (if a tuple appears more than once, its last value is
+// kept).  X has the type of C.  GxB_Matrix_deleteTuples (C, I, J, nvals)
+// removes the entries C(I[k],J[k]), as GrB_Matrix_removeElement does for a
+// single entry.  The tuples of each batch are found in C in parallel, and the
+// work left pending in C is finished when enough of it accumulates.  If any
+// index is out of bounds, C is not modified and GrB_INDEX_OUT_OF_BOUNDS is
+// returned.
+
+GrB_Info GxB_Matrix_insertTuples    // C(I[k],J[k]) = X[k] for all k
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GrB_Info GxB_Matrix_deleteTuples    // remove C(I[k],J[k]) for all k
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_extractTuples
 //------------------------------------------------------------------------------
@@ -5479,7 +5629,8 @@ GrB_Info GxB_Context_set_VOID   (GxB_Context, void *    , GrB_Field, size_t) ;
             GrB_Matrix       *: GrB_Matrix_free       , \
             GrB_Descriptor   *: GrB_Descriptor_free   , \
             GxB_Context      *: GxB_Context_free      , \
-            GxB_Iterator     *: GxB_Iterator_free       \
+            GxB_Iterator     *: GxB_Iterator_free     , \
+            GxB_Builder      *: GxB_Builder_free        \
     )                                                   \
     (object)
 #endif
@@ -5939,6 +6090,24 @@ GrB_Info GrB_Col_extract            // w<mask> = accum (w, A(I,j))
     (arg1, Mask, accum, arg4, __VA_ARGS__)
 #endif
 
+// GxB_Matrix_view creates a new matrix C = A(I,J).  If I and J select a
+// contiguous range of whole vectors of A (a range of columns if A is held by
+// column, or a range of rows if A is held by row), C shares the entries of A
+// and takes O(1) time and memory to construct if A is bitmap or full, or
+// O(|J|) (or O(|I|) by row) if A is sparse or hypersparse.  Otherwise, C is
+// computed with GrB_Matrix_extract.  C and A can each be modified or freed
+// without affecting the other.
+
+GrB_Info GxB_Matrix_view            // C = A(I,J), sharing the arrays of A
+(
+    GrB_Matrix *C,                  // handle of output matrix to create
+    const GrB_Matrix A,             // input matrix
+    const GrB_Index *Ilist,         // row indices
+    GrB_Index ni,                   // number of row indices
+    const GrB_Index *J,             // column indices
+    GrB_Index nj                    // number of column indices
+) ;
+
 //==============================================================================
 // GxB_subassign: matrix and vector subassign: C(I,J)<Mask> = accum (C(I,J), A)
 //==============================================================================
@@ -10289,6 +10458,21 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // These settings can be added, so to use LZ4HC at level 5, use method =
 // GxB_COMPRESSION_LZ4HC + 5.
 
+// GxB_COMPRESSION_FILTER can also be added to LZ4, LZ4HC, or ZSTD, so that
+// each array is filtered before it is compressed: the integer arrays of the
+// pattern are delta encoded, and the bytes of their deltas and of the values
+// are shuffled into planes (byte 0 of all entries, then byte 1, and so on).
+// This often gives a much smaller blob, and faster compression.  For example,
+// use GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER + 3.  Blobs written with
+// filters are rejected by v9.4.x and earlier (GrB_INVALID_OBJECT).  The filters
+// are not supported by GxB_Matrix_serialize_stream, which returns
+// GrB_NOT_IMPLEMENTED if they are requested.
+
+// GxB_COMPRESSION_ALIGNED is like GxB_COMPRESSION_NONE, except that each array
+// starts on a 64-byte boundary in the blob, so that GxB_Matrix_deserialize_view
+// can use the arrays in place.  Blobs written with GxB_COMPRESSION_ALIGNED
+// cannot be read by v9.4.x and earlier.
+
 // If the level setting is out of range, the default is used for that method.
 // If the method is negative, no compression is performed.  If the method is
 // positive but unrecognized, the default is used (GxB_COMPRESSION_ZSTD,
@@ -10354,6 +10538,24 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+// GxB_Matrix_deserialize_view: like GxB_Matrix_deserialize, except that the
+// arrays held in a blob serialized with GxB_COMPRESSION_ALIGNED are not
+// copied; C points into the blob instead.  The blob must not be freed or
+// modified while C, or any matrix that shares its arrays, exists.
+GrB_Info GxB_Matrix_deserialize_view    // deserialize blob in place
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob, which must outlive C
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 GrB_Info GrB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
 (
     // output:
@@ -10381,6 +10583,82 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+//==============================================================================
+// GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream
+//==============================================================================
+
+// GxB_Matrix_serialize_stream serializes a matrix like GxB_Matrix_serialize,
+// but passes the result to a user write function in pieces, as it is
+// compressed, so the serialized matrix is never held in memory as a whole.
+// The write function must write all size bytes of the buffer to the stream
+// and return true, or return false on error.  GxB_Matrix_deserialize_stream
+// reads the matrix back with a user read function, which must read exactly
+// size bytes into the buffer and return true, or return false if it cannot.
+// The stream is passed to each call of the function.  A stream is not a
+// blob, and can only be read by GxB_Matrix_deserialize_stream.
+
+typedef bool (*GxB_stream_write_function)
+    (void *stream, const void *buffer, size_t size) ;
+typedef bool (*GxB_stream_read_function)
+    (void *stream, void *buffer, size_t size) ;
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // output:
+    GxB_stream_write_function write_func,   // function to write the stream
+    void *stream,                   // passed to write_func
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function read_func,     // function to read the stream
+    void *stream,                   // passed to read_func
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+//==============================================================================
+// GxB_Matrix_mmap_write and GxB_Matrix_mmap_read: out-of-core matrices
+//==============================================================================
+
+// GxB_Matrix_mmap_write writes a matrix to a file, uncompressed, with each of
+// its arrays aligned to a 4KB page.  GxB_Matrix_mmap_read maps the file into
+// memory (read-only) and creates a matrix whose content is held in the
+// mapping, without reading the file; pages are read from the file as they are
+// accessed, so the matrix can be larger than the memory of the system.  The
+// matrix can be used as an input to any method.  If it is modified, it first
+// gets its own copy of its content, in memory.  The file must not be modified
+// while it is mapped.  The file is in the native byte order of the system that
+// wrote it.  Only available on POSIX systems (GrB_NOT_IMPLEMENTED otherwise).
+
+GrB_Info GxB_Matrix_mmap_write      // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    const GrB_Matrix A              // matrix to write
+) ;
+
+GrB_Info GxB_Matrix_mmap_read       // map a matrix from a file
+(
+    // output:
+    GrB_Matrix *C,      // output matrix mapped from the file
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the file holds a
+                        // matrix of user-defined type.  May be NULL if the
+                        // file holds a built-in type; otherwise must match
+                        // the type of C.
+    const char *filename    // file to map
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GB_Builder_merge: merge the two newest runs of a GxB_Builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The two newest runs A (older) and B (newer) are merged with GB_add, using
+// the dup operator of the builder to assemble entries that appear in both.
+// The runs and the result have the type of the dup operator (builder->ztype),
+// so no values are typecasted.
+// The older run is the first operand, so the result is the same as if both
+// batches had been given to a single GrB_Matrix_build (assuming dup is
+// associative).  If dup is NULL or GxB_IGNORE_DUP, the implicit SECOND
+// operator keeps the newer entry; if dup is NULL, entries that appear in both
+// runs are an error, just as they are for GrB_Matrix_build.
+
+// If an error occurs, the runs of the builder are not modified.
+
+#include "builder/GB_build.h"
+#include "add/GB_add.h"
+#include "binaryop/GB_binop.h"
+#include "transplant/GB_transplant.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_phybix_free (S) ;            \
+    GB_Matrix_free (&R) ;           \
+}
+
+GrB_Info GB_Builder_merge            // merge the two newest runs of a builder
+(
+    GxB_Builder builder,
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (builder != NULL && builder->nruns >= 2) ;
+    int nruns = builder->nruns ;
+    GrB_Matrix A = builder->run [nruns-2] ;
+    GrB_Matrix B = builder->run [nruns-1] ;
+    ASSERT_MATRIX_OK (A, "older run for builder merge", GB0) ;
+    ASSERT_MATRIX_OK (B, "newer run for builder merge", GB0) ;
+    ASSERT (A->is_csc == builder->is_csc && B->is_csc == builder->is_csc) ;
+    ASSERT (A->type == builder->ztype && B->type == builder->ztype) ;
+
+    struct GB_Matrix_opaque S_header ;
+    GrB_Matrix S = NULL, R = NULL ;
+    GrB_Type type = builder->ztype ;
+
+    //--------------------------------------------------------------------------
+    // get the operator to assemble entries that appear in both runs
+    //--------------------------------------------------------------------------
+
+    struct GB_BinaryOp_opaque op_header ;
+    GrB_BinaryOp dup = builder->dup ;
+    GrB_BinaryOp op = (dup == NULL || dup == GxB_IGNORE_DUP) ?
+        GB_binop_second (type, &op_header) : dup ;
+
+    //--------------------------------------------------------------------------
+    // S = A+B
+    //--------------------------------------------------------------------------
+
+    bool ignore ;
+    GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+    GB_OK (GB_add (S, type, builder->is_csc, NULL, false, false, &ignore,
+        A, B, false, NULL, NULL, op, false, false, Werk)) ;
+
+    if (dup == NULL && GB_nnz (S) < GB_nnz (A) + GB_nnz (B))
+    { 
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_INVALID_VALUE, "Duplicates appear (" GBd ") but dup "
+            "is NULL", GB_nnz (A) + GB_nnz (B) - GB_nnz (S)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // R = S, with a dynamic header
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&R, // any sparsity, new header
+        type, builder->vlen, builder->vdim, GB_Ap_null, builder->is_csc,
+        GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 0)) ;
+    GB_OK (GB_transplant (R, type, &S, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // replace the two runs with R
+    //--------------------------------------------------------------------------
+
+    GB_Matrix_free (&(builder->run [nruns-2])) ;
+    GB_Matrix_free (&(builder->run [nruns-1])) ;
+    builder->run [nruns-2] = R ;
+    builder->nruns = nruns - 1 ;
+    ASSERT_MATRIX_OK (R, "merged run for builder", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Builder_clear: free all runs of a GxB_Builder
+//------------------------------------------------------------------------------
+
+void GB_Builder_clear (GxB_Builder builder)
+{
+    for (int k = 0 ; k < builder->nruns ; k++)
+    { 
+        GB_Matrix_free (&(builder->run [k])) ;
+    }
+    builder->nruns = 0 ;
+}
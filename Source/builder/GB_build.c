@@ -267,33 +267,100 @@ GrB_Info GB_build               // build matrix
     GrB_Matrix T = NULL ;
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
     GrB_Type ttype = (discard_duplicates) ? xtype : dup->ztype ;
+    const int64_t *I_input = (int64_t *) ((C->is_csc) ? I : J) ;
+    const int64_t *J_input = (int64_t *) ((C->is_csc) ? J : I) ;
 
-    GB_OK (GB_builder (
-        T,              // create T using a static header
-        ttype,          // the type of T
-        C->vlen,        // T->vlen = C->vlen
-        C->vdim,        // T->vdim = C->vdim
-        C->is_csc,      // T has the same CSR/CSC format as C
-        &no_I_work,     // I_work_handle, not used here
-        &I_work_size,
-        &no_J_work,     // J_work_handle, not used here
-        &J_work_size,
-        &no_X_work,     // X_work_handle, not used here
-        &X_work_size,
-        false,          // known_sorted: not yet known
-        false,          // known_no_duplicates: not yet known
-        0,              // I_work, J_work, and X_work not used here
-        is_matrix,      // true if T is a GrB_Matrix
-        (int64_t *) ((C->is_csc) ? I : J),  // size nvals
-        (int64_t *) ((C->is_csc) ? J : I),  // size nvals, or NULL for vector
-        (const GB_void *) X,                // values, size nvals or 1 if iso
-        X_iso,          // true if X is iso
-        nvals,          // number of tuples
-        dup2,           // operator to assemble duplicates (may be NULL)
-        xtype,          // type of the X array
-        true,           // burble is OK
-        Werk
-    )) ;
+    double dupl = 1 ;
+    if (!X_iso && !discard_duplicates && nvals >= GB_BUILD_HASH_MIN
+        && GB_build_hash_control_get ( ))
+    { 
+        // estimate the # of times each (i,j) appears in the tuples
+        dupl = GB_build_hash_dupl (I_input, J_input, nvals) ;
+    }
+
+    if (dupl >= GB_BUILD_HASH_DUPL)
+    {
+
+        //----------------------------------------------------------------------
+        // assemble the duplicates with a hash table, then build T
+        //----------------------------------------------------------------------
+
+        // Each (i,j) appears many times in the tuples, so the duplicates are
+        // assembled first, and only the unique tuples are sorted by
+        // GB_builder.  I_work and J_work hold the unique indices, and X_work
+        // their values, of type ttype.  GB_builder takes ownership of all
+        // three arrays.
+
+        GBURBLE ("(hash build: %g dupl) ", dupl) ;
+        int64_t *I_work = NULL, *J_work = NULL, nunique = 0 ;
+        GB_void *X_work = NULL ;
+        GB_OK (GB_build_hash (&I_work, &I_work_size, &J_work, &J_work_size,
+            &X_work, &X_work_size, &nunique, I_input, J_input,
+            (const GB_void *) X, nvals, C->vlen, C->vdim, C->is_csc, xtype,
+            dup, dupl, Werk)) ;
+
+        GB_OK (GB_builder (
+            T,              // create T using a static header
+            ttype,          // the type of T
+            C->vlen,        // T->vlen = C->vlen
+            C->vdim,        // T->vdim = C->vdim
+            C->is_csc,      // T has the same CSR/CSC format as C
+            &I_work,        // I_work_handle, transplanted into T->i
+            &I_work_size,
+            &J_work,        // J_work_handle, freed on output
+            &J_work_size,
+            &X_work,        // X_work_handle, freed on output
+            &X_work_size,
+            false,          // known_sorted: not yet known
+            true,           // known_no_duplicates: no duplicates remain
+            nunique,        // size of I_work, J_work, and X_work
+            is_matrix,      // true if T is a GrB_Matrix
+            NULL, NULL,     // original I,J tuples, not used here
+            NULL,           // original X, not used here
+            false,          // X_work is not iso
+            nunique,        // number of unique tuples
+            NULL,           // no duplicates, so dup is NULL
+            ttype,          // the type of X_work (no typecasting)
+            true,           // burble is OK
+            Werk
+        )) ;
+
+    }
+    else
+    { 
+
+        //----------------------------------------------------------------------
+        // sort the tuples and assemble any duplicates with GB_builder
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_builder (
+            T,              // create T using a static header
+            ttype,          // the type of T
+            C->vlen,        // T->vlen = C->vlen
+            C->vdim,        // T->vdim = C->vdim
+            C->is_csc,      // T has the same CSR/CSC format as C
+            &no_I_work,     // I_work_handle, not used here
+            &I_work_size,
+            &no_J_work,     // J_work_handle, not used here
+            &J_work_size,
+            &no_X_work,     // X_work_handle, not used here
+            &X_work_size,
+            false,          // known_sorted: not yet known
+            false,          // known_no_duplicates: not yet known
+            0,              // I_work, J_work, and X_work not used here
+            is_matrix,      // true if T is a GrB_Matrix
+            I_input,        // size nvals
+            J_input,        // size nvals, or NULL for vector
+            (const GB_void *) X,    // values, size nvals or 1 if iso
+            X_iso,          // true if X is iso
+            nvals,          // number of tuples
+            dup2,           // operator to assemble duplicates (may be NULL)
+            xtype,          // type of the X array
+            true,           // burble is OK
+            Werk
+        )) ;
+
+    }
 
     //--------------------------------------------------------------------------
     // return an error if any duplicates found when they were not expected
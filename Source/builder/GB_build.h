@@ -57,4 +57,60 @@ GrB_Info GB_builder                 // build a matrix from tuples
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// hash build (for GB_build)
+//------------------------------------------------------------------------------
+
+// GB_build assembles duplicate tuples with GB_build_hash before the sort if
+// it is enabled, if there are at least GB_BUILD_HASH_MIN tuples, and if each
+// (i,j) is estimated by GB_build_hash_dupl to appear GB_BUILD_HASH_DUPL times
+// or more.  The estimate is made from 1 in GB_BUILD_HASH_SAMPLE tuples.
+#define GB_BUILD_HASH_MIN (64 * 1024)
+#define GB_BUILD_HASH_SAMPLE 64
+#define GB_BUILD_HASH_DUPL 4
+
+double GB_build_hash_dupl       // estimate the mean # of copies of each (i,j)
+(
+    const int64_t *restrict I,  // size nvals
+    const int64_t *restrict J,  // size nvals, or NULL
+    const int64_t nvals
+) ;
+
+GrB_Info GB_build_hash          // assemble duplicate tuples with a hash table
+(
+    int64_t **I_work_handle,    // unique tuples, size nunique
+    size_t *I_work_size_handle,
+    int64_t **J_work_handle,    // size nunique, or NULL if vdim <= 1
+    size_t *J_work_size_handle,
+    GB_void **X_work_handle,    // values of type dup->ztype, size nunique
+    size_t *X_work_size_handle,
+    int64_t *nunique_handle,    // # of unique tuples
+    const int64_t *restrict I_input,    // indices, size nvals
+    const int64_t *restrict J_input,    // indices, size nvals, or NULL
+    const GB_void *restrict X_input,    // values, size nvals
+    const int64_t nvals,        // # of tuples
+    const int64_t vlen,         // 0 <= I_input [k] < vlen is required
+    const int64_t vdim,         // 0 <= J_input [k] < vdim is required
+    const bool is_csc,          // only used for error messages
+    const GrB_Type xtype,       // type of X_input
+    const GrB_BinaryOp dup,     // operator to assemble duplicates
+    const double dupl,          // estimate from GB_build_hash_dupl
+    GB_Werk Werk
+) ;
+
+void GB_build_hash_control_set (bool control) ;
+bool GB_build_hash_control_get (void) ;
+
+//------------------------------------------------------------------------------
+// GxB_Builder methods
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Builder_merge            // merge the two newest runs of a builder
+(
+    GxB_Builder builder,
+    GB_Werk Werk
+) ;
+
+void GB_Builder_clear (GxB_Builder builder) ;    // free all runs of a builder
+
 #endif
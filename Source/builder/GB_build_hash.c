@@ -0,0 +1,531 @@
+//------------------------------------------------------------------------------
+// GB_build_hash: assemble duplicate tuples with a hash table, before the sort
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the tuples given to GrB_Matrix_build have many duplicates, most of the
+// work of GB_builder is spent sorting tuples that are then summed away.
+// GB_build_hash instead assembles the duplicates first, with a hash table of
+// the unique (i,j) pairs, so that only the unique tuples need to be sorted
+// by GB_builder.  The tuples are scanned in order, so the dup operator is
+// applied to the values of each (i,j) pair in the same order as GB_builder:
+
+//      T(i,j) = (ztype) X [k1]
+//      T(i,j) = dup (T(i,j), (ztype) X [k2])
+//      ...
+
+// The result is returned in three new arrays (I_work, J_work, and X_work)
+// that are passed to GB_builder with known_no_duplicates true.
+
+// With more than one thread, the (i,j) pairs are partitioned by their hash
+// value, and each thread scans all the tuples but assembles only those in its
+// own partition, into its own hash table.  This keeps the dup operator applied
+// in order, for each (i,j) pair, with no synchronization between threads.
+
+// GB_build_hash_dupl estimates the mean # of times each (i,j) pair appears in
+// the tuples, from a sample of 1 in GB_BUILD_HASH_SAMPLE of them, so that
+// GB_build can decide if GB_build_hash is worth using (see GB_build.h).
+
+#include "builder/GB_build.h"
+
+// # of tuples ahead to prefetch in the hash table
+#define GB_BUILD_HASH_AHEAD 16
+
+#define GB_FREE_ALL                                         \
+{                                                           \
+    for (int p = 0 ; p < nparts ; p++)                      \
+    {                                                       \
+        GB_build_hash_part_free (&(Part [p])) ;             \
+    }                                                       \
+    GB_FREE_WORK (&Part, Part_size) ;                       \
+    GB_FREE (&I_work, I_work_size) ;                        \
+    GB_FREE (&J_work, J_work_size) ;                        \
+    GB_FREE (&X_work, X_work_size) ;                        \
+}
+
+//------------------------------------------------------------------------------
+// GB_build_hash_control: enable/disable the hash build
+//------------------------------------------------------------------------------
+
+static bool GB_build_hash_control = true ;
+
+void GB_build_hash_control_set (bool control)
+{
+    GB_ATOMIC_WRITE
+    GB_build_hash_control = control ;
+}
+
+bool GB_build_hash_control_get (void)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_build_hash_control ;
+    return (control) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_hash_key: hash an index pair (i,j)
+//------------------------------------------------------------------------------
+
+static inline uint64_t GB_build_hash_key (uint64_t i, uint64_t j)
+{
+    uint64_t h = i * 0x9E3779B97F4A7C15 ;
+    h ^= j * 0xC2B2AE3D27D4EB4F ;
+    h ^= (h >> 32) ;
+    h *= 0x94D049BB133111EB ;
+    h ^= (h >> 29) ;
+    return (h) ;
+}
+
+// the hash table has size 2^k, with at least 2*nunique entries
+static int64_t GB_build_hash_size (int64_t nunique)
+{
+    int64_t hsize = 1024 ;
+    while (hsize < 2 * nunique)
+    {
+        hsize *= 2 ;
+    }
+    return (hsize) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_hash_dupl: estimate the mean # of times each (i,j) appears
+//------------------------------------------------------------------------------
+
+// A sample of s tuples is taken, one from each stride of GB_BUILD_HASH_SAMPLE
+// tuples, at a pseudo-random position in the stride.  Let f1 be the # of
+// (i,j) pairs that appear just once in the sample.  If each (i,j) appears d
+// times in all the tuples, and each tuple is in the sample with probability
+// q = s/nvals, then f1/s is the probability that none of the other d-1
+// copies of a sampled tuple are also sampled:  f1/s = (1-q)^(d-1).  Solving
+// for d gives the estimate.  If the # of copies varies, this estimate is
+// dominated by the pairs that appear most often.  If the sample cannot be
+// taken (out of memory), 1 is returned, so the hash build is not used.
+
+double GB_build_hash_dupl       // estimate the mean # of copies of each (i,j)
+(
+    const int64_t *restrict I,  // size nvals
+    const int64_t *restrict J,  // size nvals, or NULL
+    const int64_t nvals
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the hash table for the sample
+    //--------------------------------------------------------------------------
+
+    int64_t stride = GB_BUILD_HASH_SAMPLE ;
+    int64_t s = nvals / stride ;
+    if (s < 2) return (1) ;
+    int64_t hsize = GB_build_hash_size (s) ;
+    int64_t hmask = hsize - 1 ;
+    size_t Hi_size = 0, Hj_size = 0, Hc_size = 0 ;
+    int64_t *restrict Hi = GB_MALLOC_WORK (hsize, int64_t, &Hi_size) ;
+    int64_t *restrict Hj = GB_MALLOC_WORK (hsize, int64_t, &Hj_size) ;
+    int64_t *restrict Hc = GB_CALLOC_WORK (hsize, int64_t, &Hc_size) ;
+    if (Hi == NULL || Hj == NULL || Hc == NULL)
+    {
+        // out of memory; do not use the hash build
+        GB_FREE_WORK (&Hi, Hi_size) ;
+        GB_FREE_WORK (&Hj, Hj_size) ;
+        GB_FREE_WORK (&Hc, Hc_size) ;
+        return (1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the # of times each (i,j) appears in the sample
+    //--------------------------------------------------------------------------
+
+    for (int64_t t = 0 ; t < s ; t++)
+    {
+        int64_t k = t * stride + (GB_build_hash_key (t, 0) % stride) ;
+        int64_t i = I [k] ;
+        int64_t j = (J == NULL) ? 0 : J [k] ;
+        int64_t h = GB_build_hash_key (i, j) & hmask ;
+        while (Hc [h] > 0 && (Hi [h] != i || Hj [h] != j))
+        {
+            h = (h + 1) & hmask ;
+        }
+        Hi [h] = i ;
+        Hj [h] = j ;
+        Hc [h]++ ;
+    }
+
+    int64_t f1 = 0 ;
+    for (int64_t h = 0 ; h < hsize ; h++)
+    {
+        f1 += (Hc [h] == 1) ;
+    }
+
+    GB_FREE_WORK (&Hi, Hi_size) ;
+    GB_FREE_WORK (&Hj, Hj_size) ;
+    GB_FREE_WORK (&Hc, Hc_size) ;
+
+    //--------------------------------------------------------------------------
+    // estimate the # of copies
+    //--------------------------------------------------------------------------
+
+    if (f1 == 0)
+    {
+        // every sampled (i,j) appears more than once in the sample
+        return ((double) nvals) ;
+    }
+    double q = ((double) s) / ((double) nvals) ;
+    return (1 + log (((double) f1) / ((double) s)) / log1p (-q)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_hash_part: the hash table for one partition of the (i,j) pairs
+//------------------------------------------------------------------------------
+
+// Each entry h of the hash table holds (i,j) and the value T(i,j), together
+// in esize bytes, so that finding and updating an entry touches a single
+// cache line.  i is -1 if the entry is empty.
+
+typedef struct
+{
+    GB_void *T ; size_t T_size ;    // hash table, size hsize*esize
+    int64_t hsize ;                 // size of the hash table, a power of 2
+    int64_t n ;                     // # of unique tuples in the table
+    int64_t kbad ;                  // position of an invalid tuple, or -1
+}
+GB_build_hash_part_struct ;
+
+#define GB_TI(T,h) (*((int64_t *) ((T) + (h) * esize)))
+#define GB_TJ(T,h) (*((int64_t *) ((T) + (h) * esize + sizeof (int64_t))))
+#define GB_TX(T,h) ((T) + (h) * esize + 2 * sizeof (int64_t))
+
+static void GB_build_hash_part_free (GB_build_hash_part_struct *P)
+{
+    GB_FREE_WORK (&(P->T), P->T_size) ;
+}
+
+// allocate an empty hash table of size hsize
+static bool GB_build_hash_part_alloc
+(
+    GB_build_hash_part_struct *P,
+    int64_t hsize,
+    size_t esize
+)
+{
+    P->T = GB_MALLOC_WORK (hsize * esize, GB_void, &(P->T_size)) ;
+    P->hsize = hsize ;
+    if (P->T == NULL)
+    {
+        return (false) ;
+    }
+    // set all entries to empty (all values are ignored)
+    memset (P->T, 0xFF, hsize * esize) ;
+    return (true) ;
+}
+
+// double the size of the hash table
+static bool GB_build_hash_part_grow
+(
+    GB_build_hash_part_struct *P,
+    size_t esize
+)
+{
+    GB_build_hash_part_struct Old = (*P) ;
+    if (!GB_build_hash_part_alloc (P, 2 * Old.hsize, esize))
+    {
+        (*P) = Old ;
+        return (false) ;
+    }
+    GB_void *restrict T = P->T ;
+    int64_t hmask = P->hsize - 1 ;
+    for (int64_t h_old = 0 ; h_old < Old.hsize ; h_old++)
+    {
+        int64_t i = GB_TI (Old.T, h_old) ;
+        if (i < 0) continue ;
+        int64_t j = GB_TJ (Old.T, h_old) ;
+        int64_t h = GB_build_hash_key (i, j) & hmask ;
+        while (GB_TI (T, h) >= 0)
+        {
+            h = (h + 1) & hmask ;
+        }
+        memcpy (T + h * esize, Old.T + h_old * esize, esize) ;
+    }
+    P->n = Old.n ;
+    P->kbad = Old.kbad ;
+    GB_build_hash_part_free (&Old) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_hash
+//------------------------------------------------------------------------------
+
+GrB_Info GB_build_hash          // assemble duplicate tuples with a hash table
+(
+    int64_t **I_work_handle,    // unique tuples, size nunique
+    size_t *I_work_size_handle,
+    int64_t **J_work_handle,    // size nunique, or NULL if vdim <= 1
+    size_t *J_work_size_handle,
+    GB_void **X_work_handle,    // values of type dup->ztype, size nunique
+    size_t *X_work_size_handle,
+    int64_t *nunique_handle,    // # of unique tuples
+    const int64_t *restrict I_input,    // indices, size nvals
+    const int64_t *restrict J_input,    // indices, size nvals, or NULL
+    const GB_void *restrict X_input,    // values, size nvals
+    const int64_t nvals,        // # of tuples
+    const int64_t vlen,         // 0 <= I_input [k] < vlen is required
+    const int64_t vdim,         // 0 <= J_input [k] < vdim is required
+    const bool is_csc,          // only used for error messages
+    const GrB_Type xtype,       // type of X_input
+    const GrB_BinaryOp dup,     // operator to assemble duplicates
+    const double dupl,          // estimate from GB_build_hash_dupl
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (I_work_handle != NULL && J_work_handle != NULL) ;
+    ASSERT (X_work_handle != NULL && nunique_handle != NULL) ;
+    ASSERT (I_input != NULL && X_input != NULL) ;
+    ASSERT_BINARYOP_OK (dup, "dup for hash build", GB0) ;
+    ASSERT (dup->xtype == dup->ztype && dup->ytype == dup->ztype) ;
+    ASSERT (GB_Type_compatible (xtype, dup->ztype)) ;
+
+    (*I_work_handle) = NULL ; (*J_work_handle) = NULL ;
+    (*X_work_handle) = NULL ; (*nunique_handle) = 0 ;
+
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GB_void *X_work = NULL ; size_t X_work_size = 0 ;
+    GB_build_hash_part_struct *Part = NULL ; size_t Part_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get the operator and the typecasting function
+    //--------------------------------------------------------------------------
+
+    // if fdup is NULL, the operator is SECOND_UDT and z = y is used instead
+    GxB_binary_function fdup = dup->binop_function ;
+    GrB_Type ztype = dup->ztype ;
+    const size_t zsize = ztype->size ;
+    const size_t xsize = xtype->size ;
+    GB_cast_function cast_X_to_Z = (xtype == ztype) ? NULL :
+        GB_cast_factory (ztype->code, xtype->code) ;
+
+    // each entry holds i, j, and the value, padded to a multiple of 16 bytes
+    const size_t esize = 2 * sizeof (int64_t) + 16 * ((zsize + 15) / 16) ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use, and allocate the hash tables
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+    int nparts = nthreads ;
+    bool keep_j = (vdim > 1) ;
+
+    Part = GB_CALLOC_WORK (nparts, GB_build_hash_part_struct, &Part_size) ;
+    if (Part == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // start each table at the estimated size of its partition
+    double nunique_estimate = ((double) nvals) / ((dupl > 1) ? dupl : 1) ;
+    int64_t hsize = GB_build_hash_size ((int64_t) (nunique_estimate / nparts)) ;
+    bool ok = true ;
+    for (int p = 0 ; p < nparts ; p++)
+    {
+        Part [p].kbad = -1 ;
+        ok = ok && GB_build_hash_part_alloc (&(Part [p]), hsize, esize) ;
+    }
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble the tuples of each partition into its own hash table
+    //--------------------------------------------------------------------------
+
+    int p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+        reduction(&&:ok)
+    for (p = 0 ; p < nparts ; p++)
+    {
+        GB_build_hash_part_struct *P = &(Part [p]) ;
+        GB_void *restrict T = P->T ;
+        int64_t hmask = P->hsize - 1 ;
+        GB_void xwork [GB_VLA(zsize)] ;
+        for (int64_t k = 0 ; k < nvals ; k++)
+        {
+            // prefetch the entry for a later tuple, since the table is
+            // typically much larger than the cache
+            int64_t kahead = k + GB_BUILD_HASH_AHEAD ;
+            if (kahead < nvals)
+            {
+                int64_t i2 = I_input [kahead] ;
+                int64_t j2 = (J_input == NULL) ? 0 : J_input [kahead] ;
+                GB_PREFETCH (T + (GB_build_hash_key (i2, j2) & hmask) * esize) ;
+            }
+            // get the kth tuple, and skip it if not in this partition
+            int64_t i = I_input [k] ;
+            int64_t j = (J_input == NULL) ? 0 : J_input [k] ;
+            uint64_t hash = GB_build_hash_key (i, j) ;
+            if (nparts > 1 && (int) ((hash >> 32) % nparts) != p) continue ;
+            if ((uint64_t) i >= (uint64_t) vlen ||
+                (J_input != NULL && (uint64_t) j >= (uint64_t) vdim))
+            {
+                // invalid index
+                P->kbad = k ;
+                break ;
+            }
+            // find (i,j) in the hash table, or the empty entry for it
+            int64_t h = hash & hmask ;
+            int64_t ih ;
+            while ((ih = GB_TI (T, h)) >= 0 && (ih != i || GB_TJ (T, h) != j))
+            {
+                h = (h + 1) & hmask ;
+            }
+            // y = (ztype) X_input [k]
+            const GB_void *y = X_input + k * xsize ;
+            if (cast_X_to_Z != NULL)
+            {
+                cast_X_to_Z (xwork, y, xsize) ;
+                y = xwork ;
+            }
+            GB_void *z = GB_TX (T, h) ;
+            if (ih >= 0)
+            {
+                // T(i,j) = dup (T(i,j), y)
+                if (fdup != NULL)
+                {
+                    fdup (z, z, y) ;
+                }
+                else
+                {
+                    memcpy (z, y, zsize) ;
+                }
+            }
+            else
+            {
+                // T(i,j) = y, the first time (i,j) appears
+                GB_TI (T, h) = i ;
+                GB_TJ (T, h) = j ;
+                memcpy (z, y, zsize) ;
+                P->n++ ;
+                if (2 * P->n > P->hsize)
+                {
+                    // the table is half full; double its size
+                    if (!GB_build_hash_part_grow (P, esize))
+                    {
+                        // out of memory
+                        ok = false ;
+                        break ;
+                    }
+                    T = P->T ;
+                    hmask = P->hsize - 1 ;
+                }
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check for invalid indices
+    //--------------------------------------------------------------------------
+
+    int64_t kbad = -1 ;
+    for (p = 0 ; p < nparts ; p++)
+    {
+        if (Part [p].kbad >= 0 && (kbad < 0 || Part [p].kbad < kbad))
+        {
+            kbad = Part [p].kbad ;
+        }
+    }
+
+    if (kbad >= 0)
+    {
+        int64_t i = I_input [kbad] ;
+        int64_t j = (J_input == NULL) ? 0 : J_input [kbad] ;
+        int64_t row = is_csc ? i : j ;
+        int64_t col = is_csc ? j : i ;
+        int64_t nrows = is_csc ? vlen : vdim ;
+        int64_t ncols = is_csc ? vdim : vlen ;
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+            "index (" GBd "," GBd ") out of bounds,"
+            " must be < (" GBd ", " GBd ")",
+            row, col, nrows, ncols) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output arrays
+    //--------------------------------------------------------------------------
+
+    int64_t nunique = 0 ;
+    for (p = 0 ; p < nparts ; p++)
+    {
+        nunique += Part [p].n ;
+    }
+
+    int64_t n = GB_IMAX (nunique, 1) ;
+    I_work = GB_MALLOC (n, int64_t, &I_work_size) ;
+    J_work = (keep_j) ? GB_MALLOC (n, int64_t, &J_work_size) : NULL ;
+    X_work = GB_MALLOC (n * zsize, GB_void, &X_work_size) ;
+    if (I_work == NULL || (keep_j && J_work == NULL) || X_work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the unique tuples from each hash table
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (p = 0 ; p < nparts ; p++)
+    {
+        GB_build_hash_part_struct *P = &(Part [p]) ;
+        const GB_void *restrict T = P->T ;
+        int64_t pdest = 0 ;
+        for (int p2 = 0 ; p2 < p ; p2++)
+        {
+            pdest += Part [p2].n ;
+        }
+        for (int64_t h = 0 ; h < P->hsize ; h++)
+        {
+            int64_t i = GB_TI (T, h) ;
+            if (i < 0) continue ;
+            I_work [pdest] = i ;
+            if (keep_j) J_work [pdest] = GB_TJ (T, h) ;
+            memcpy (X_work + pdest * zsize, GB_TX (T, h), zsize) ;
+            pdest++ ;
+        }
+        GB_build_hash_part_free (P) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Part, Part_size) ;
+    (*I_work_handle) = I_work ; (*I_work_size_handle) = I_work_size ;
+    (*J_work_handle) = J_work ; (*J_work_size_handle) = J_work_size ;
+    (*X_work_handle) = X_work ; (*X_work_size_handle) = X_work_size ;
+    (*nunique_handle) = nunique ;
+    return (GrB_SUCCESS) ;
+}
@@ -560,7 +560,25 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // sort all the tuples
         //----------------------------------------------------------------------
 
-        if (vdim > 1)
+        // The indices are bounded by vlen and vdim, so a radix sort can be
+        // used instead of a mergesort.  It is faster if the key (j,i) of each
+        // tuple fits in 64 bits, so that it takes at most 6 passes over the
+        // tuples.  The radix sort is stable, so with K_work [k] = k on input,
+        // it gives the same result as the mergesort.
+
+        int nbits = GB_radix_sort_nbits (vlen) +
+            ((vdim > 1) ? GB_radix_sort_nbits (vdim) : 0) ;
+        bool use_radix = GB_radix_sort_control_get ( )
+            && nvals >= GB_RADIX_SORT_MIN && nbits <= 64 ;
+
+        if (use_radix)
+        { 
+            // sort (j,i,k), (j,i), (i,k), or (i) tuples
+            if (do_burble) GBURBLE ("(radix sort) ") ;
+            info = GB_radix_sort ((vdim > 1) ? J_work : NULL, I_work,
+                K_work, nvals, vlen, vdim, nthreads) ;
+        }
+        else if (vdim > 1)
         {
 
             //------------------------------------------------------------------
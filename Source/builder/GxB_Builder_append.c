@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// GxB_Builder_append: append a batch of tuples to a GxB_Builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The batch is built into a new run with GB_build, in the same way as
+// GrB_Matrix_build, so the only sort is of the tuples in this batch.  Like
+// the matrix that GrB_Matrix_build uses to assemble duplicates, the run has
+// the type of the dup operator (builder->ztype); it is typecasted to the type
+// of the builder only by GxB_Builder_finish.  The new
+// run is then merged with the runs before it, newest first, while the older
+// run is no more than GB_BUILDER_RATIO times larger than the newer one.  The
+// sizes of the runs thus decrease geometrically, there are O(log(e)) runs
+// for e entries, and each entry takes part in O(log(e)) merges.  The merges
+// are done here, not in the background, so they are interleaved with the
+// arrival of the batches and the cost of each append is amortized.
+
+// The arrays I, J, and X are not modified and may be reused by the caller as
+// soon as this method returns.  If the batch cannot be built, the builder is
+// unchanged.  If a merge fails (out of memory, or duplicates across batches
+// when dup is NULL), the batch has been appended but the runs are left
+// unmerged, and the error is returned.
+
+#include "builder/GB_build.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&T) ;
+
+GrB_Info GxB_Builder_append         // append a batch of tuples to a builder
+(
+    GxB_Builder builder,            // builder to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    GB_WHERE1 ("GxB_Builder_append (builder, I, J, X, nvals)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (builder) ;
+
+    //--------------------------------------------------------------------------
+    // make room for a new run
+    //--------------------------------------------------------------------------
+
+    if (builder->nruns == GB_BUILDER_MAXRUNS)
+    { 
+        // this cannot occur, since each run has more than GB_BUILDER_RATIO
+        // times the entries of the next one, but is checked just in case
+        GB_OK (GB_Builder_merge (builder, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = the batch of tuples, in the format of the builder
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&T, // auto sparsity, new header
+        builder->ztype, builder->vlen, builder->vdim, GB_Ap_calloc,
+        builder->is_csc, GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ),
+        1)) ;
+    GB_OK (GB_build (T, I, J, X, nvals, builder->dup, builder->type,
+        true, false, Werk)) ;
+
+    if (GB_nnz (T) == 0)
+    { 
+        // nothing to append
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // push T onto the stack of runs, and merge while runs are similar in size
+    //--------------------------------------------------------------------------
+
+    builder->run [builder->nruns++] = T ;
+    T = NULL ;
+
+    while (builder->nruns >= 2)
+    {
+        int n = builder->nruns ;
+        int64_t older = GB_nnz (builder->run [n-2]) ;
+        int64_t newer = GB_nnz (builder->run [n-1]) ;
+        if (older > GB_BUILDER_RATIO * newer) break ;
+        GB_OK (GB_Builder_merge (builder, Werk)) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GxB_Builder_finish: return the matrix built from all batches of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All runs of the builder are merged into a single matrix, which is returned
+// as the new matrix C.  The runs have the type of the dup operator, which is
+// typecasted to the type of the builder here, once, just as GrB_Matrix_build
+// typecasts its assembled tuples only at the end.  The builder is then empty, and can be used to build
+// another matrix of the same type and size.  If an error occurs, C is
+// returned as NULL and the tuples appended so far are kept in the builder.
+
+#include "builder/GB_build.h"
+#include "convert/GB_convert.h"
+
+#define GB_FREE_ALL GB_Matrix_free (C) ;
+
+GrB_Info GxB_Builder_finish         // return the matrix built by a builder
+(
+    GrB_Matrix *C,                  // handle of matrix to create
+    GxB_Builder builder             // builder to finish (empty on output)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE1 ("GxB_Builder_finish (&C, builder)") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (builder) ;
+
+    //--------------------------------------------------------------------------
+    // merge all runs into one
+    //--------------------------------------------------------------------------
+
+    while (builder->nruns >= 2)
+    { 
+        GB_OK (GB_Builder_merge (builder, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    if (builder->nruns == 0)
+    { 
+        // no tuples were appended; C is empty
+        GB_OK (GB_new (C, // auto sparsity, new header
+            builder->type, builder->vlen, builder->vdim, GB_Ap_calloc,
+            builder->is_csc, GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ),
+            1)) ;
+    }
+    else
+    {
+        GrB_Matrix R = builder->run [0] ;
+        GB_OK (GB_conform (R, Werk)) ;
+        if (R->type == builder->type)
+        { 
+            // C is the single remaining run
+            (*C) = R ;
+            builder->run [0] = NULL ;
+            builder->nruns = 0 ;
+        }
+        else
+        { 
+            // C = (type) R, with the pattern of R
+            GB_OK (GB_dup_worker (C, R->iso, R, false, builder->type)) ;
+            GB_OK (GB_cast_matrix (*C, R)) ;
+            GB_Builder_clear (builder) ;
+        }
+    }
+
+    ASSERT_MATRIX_OK (*C, "C from builder", GB0) ;
+    return (GrB_SUCCESS) ;
+}
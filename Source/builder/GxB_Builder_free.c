@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GxB_Builder_free: free a builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Any tuples appended to the builder but not yet finished are discarded.
+
+#include "builder/GB_build.h"
+
+GrB_Info GxB_Builder_free           // free a builder
+(
+    GxB_Builder *builder_handle     // handle of builder to free
+)
+{
+
+    if (builder_handle != NULL)
+    {
+        GxB_Builder builder = *builder_handle ;
+        if (builder != NULL)
+        {
+            size_t header_size = builder->header_size ;
+            if (header_size > 0)
+            { 
+                GB_Builder_clear (builder) ;
+                builder->magic = GB_FREED ;  // to help detect dangling pointers
+                builder->header_size = 0 ;
+                GB_FREE (builder_handle, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
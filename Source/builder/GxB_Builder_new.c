@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// GxB_Builder_new: create a builder for a matrix from batches of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The builder holds no tuples until GxB_Builder_append is called.  The format
+// of the matrix it builds (by row or by column) is determined when the builder
+// is created, in the same way as GrB_Matrix_new.  The dup operator is
+// checked here, and again by GB_build for each batch.
+
+#include "builder/GB_build.h"
+
+GrB_Info GxB_Builder_new            // create a new builder
+(
+    GxB_Builder *builder_handle,    // handle of builder to create
+    GrB_Type type,                  // type of the matrix to build
+    GrB_Index nrows,                // # of rows of the matrix to build
+    GrB_Index ncols,                // # of columns of the matrix to build
+    const GrB_BinaryOp dup          // binary function to assemble duplicates
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Builder_new (&builder, type, nrows, ncols, dup)") ;
+    GB_RETURN_IF_NULL (builder_handle) ;
+    (*builder_handle) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+
+    if (nrows > GB_NMAX || ncols > GB_NMAX)
+    { 
+        // problem too large
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    if (dup != NULL && dup != GxB_IGNORE_DUP)
+    {
+        GB_RETURN_IF_FAULTY (dup) ;
+        if (GB_OP_IS_POSITIONAL (dup))
+        { 
+            // dup operator cannot be a positional op
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Positional op z=%s(x,y) "
+                "not supported as dup op\n", dup->name) ;
+        }
+        if (dup->xtype != dup->ztype || dup->ytype != dup->ztype
+            || !GB_Type_compatible (type, dup->ztype))
+        { 
+            // all 3 types of z = dup (x,y) must be the same, and compatible
+            // with the type of the matrix
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Operator [%s] for assembling "
+                "duplicates must have identical domains, compatible with "
+                "the type [%s] of the matrix", dup->name, type->name) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the builder
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GxB_Builder builder = GB_CALLOC (1, struct GB_Builder_opaque,
+        &header_size) ;
+    if (builder == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    builder->magic = GB_MAGIC ;
+    builder->header_size = header_size ;
+    builder->type = type ;
+    builder->dup = dup ;
+    builder->ztype = (dup == NULL || dup == GxB_IGNORE_DUP) ? type :
+        dup->ztype ;
+    builder->nruns = 0 ;
+
+    // the format is chosen as in GB_Matrix_new
+    bool is_csc = (ncols == 1) ? true :
+        ((nrows == 1) ? false : GB_Global_is_csc_get ( )) ;
+    builder->is_csc = is_csc ;
+    builder->vlen = (int64_t) (is_csc ? nrows : ncols) ;
+    builder->vdim = (int64_t) (is_csc ? ncols : nrows) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*builder_handle) = builder ;
+    return (GrB_SUCCESS) ;
+}
@@ -1039,6 +1039,11 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
     -1,                             // gpu_id
+    false,                          // numa_first_touch
+    // GxB_CONTEXT_WORLD is shared by all user threads, so it keeps no plans:
+    0, 0,                           // mxm_plan_max, mxm_plan_next
+    NULL, 0,                        // mxm_plans
+    false, NULL, 0,                 // mxm_workspace, mxm_werk
 } ;
 
 GxB_Context GxB_CONTEXT_WORLD = & GB_OPAQUE (CONTEXT_WORLD) ;
@@ -494,6 +494,9 @@ int sparsity_control ;  // controls sparsity structure: hypersparse,
 // saves memory, but shallow matrices are never passed back to the user
 // application.
 
+// The one exception is a matrix created by GrB_Matrix_dup or GrB_Vector_dup
+// when GxB_DUP_COPY_ON_WRITE is enabled (see A->shared, below).
+
 // If the following are true, then the corresponding component of the
 // object is a pointer into components of another object.  They must not
 // be freed when freeing this object.
@@ -540,6 +543,34 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// concurrent GrB_setElement
+//------------------------------------------------------------------------------
+
+// If GxB_CONCURRENT_SETELEMENT is enabled, several user threads can call
+// GrB_*_setElement on the same matrix at the same time.  Their tuples are
+// kept in A->concurrent, apart from A->Pending, until GB_Pending_gather moves
+// them into A->Pending.  A->concurrent_pending is true if A->concurrent may
+// hold any tuples; GB_PENDING (A) is true if it is set.
+
+struct GB_Concurrent_struct *concurrent ;   // per-thread pending tuples, or
+                        // NULL if GxB_CONCURRENT_SETELEMENT is disabled
+bool concurrent_pending ;   // true if A->concurrent may hold pending tuples
+
+//------------------------------------------------------------------------------
+// arrays shared by GrB_*_dup
+//------------------------------------------------------------------------------
+
+// If GxB_DUP_COPY_ON_WRITE is enabled, a matrix created by GrB_Matrix_dup or
+// GrB_Vector_dup and its source hold shallow pointers to the same A->p, A->h,
+// A->b, A->i, and A->x arrays, which are owned by the reference-counted
+// A->shared struct.  Each matrix gets its own copy of the arrays (GB_unshare)
+// before it is modified, and the arrays are freed when the last matrix that
+// shares them is freed.
+
+struct GB_Shared_struct *shared ;   // arrays shared with other matrices by
+                        // GrB_*_dup, or NULL if none
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
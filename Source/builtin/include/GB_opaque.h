@@ -480,6 +480,45 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // NUMA:
+    bool numa_first_touch ; // if true, first touch large blocks in parallel
+    // saxpy3 plans, for reuse by later calls to GrB_mxm (see GB_AxB_saxpy3.h):
+    int mxm_plan_max ;      // max # of plans to keep; if zero, keep none
+    int mxm_plan_next ;     // next plan to replace when all are in use
+    struct GB_saxpy3_plan_struct *mxm_plans ;   // size mxm_plan_max, or NULL
+    size_t mxm_plans_size ; // allocated size of mxm_plans
+    // saxpy3 workspace, for reuse by later calls to GrB_mxm:
+    bool mxm_workspace ;    // if true, keep the workspace
+    struct GB_saxpy3_werk_struct *mxm_werk ;    // workspace, or NULL
+    size_t mxm_werk_size ;  // allocated size of mxm_werk
+} ;
+
+//------------------------------------------------------------------------------
+// GxB_Builder: build a matrix from a stream of batches of tuples
+//------------------------------------------------------------------------------
+
+// Each batch of tuples appended to a GxB_Builder is built into a run, and the
+// two newest runs are merged while the older one is no more than
+// GB_BUILDER_RATIO times larger (see GxB_Builder_append.c).  The # of entries
+// in the runs thus decreases geometrically from oldest to newest.
+
+#define GB_BUILDER_MAXRUNS 64
+#define GB_BUILDER_RATIO 2
+
+struct GB_Builder_opaque    // content of GxB_Builder
+{
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    // ---------------------//
+    GrB_Type type ;         // type of the matrix to build
+    int64_t vlen ;          // dimensions of the matrix to build, and its
+    int64_t vdim ;          // format (the same as GrB_Matrix_new), fixed
+    bool is_csc ;           // when the builder is created
+    GrB_BinaryOp dup ;      // operator to assemble duplicates, or NULL
+    GrB_Type ztype ;        // type of the runs: dup->ztype, or type if dup
+                            // is NULL or GxB_IGNORE_DUP
+    int nruns ;             // # of runs
+    GrB_Matrix run [GB_BUILDER_MAXRUNS] ;   // runs, oldest first
 } ;
 
 //------------------------------------------------------------------------------
@@ -508,6 +547,65 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+//------------------------------------------------------------------------------
+// GB_Concurrent data structure: pending tuples from concurrent setElement
+//------------------------------------------------------------------------------
+
+// If GxB_CONCURRENT_SETELEMENT is enabled for a matrix, each user thread that
+// calls GrB_*_setElement on it claims a slot, and appends its tuples to the
+// pending tuples of that slot with no lock.  A thread that finds no free slot
+// appends its tuples to the spill list, in a critical section.  The slots
+// are moved into A->Pending by GB_Pending_gather.  See
+// GB_setElement_concurrent.c.
+
+#define GB_CONCURRENT_NSLOTS 64
+
+struct GB_Concurrent_struct     // pending tuples of concurrent setElement
+{
+    size_t header_size ;        // size of the malloc'd block for this struct
+    int64_t owner [GB_CONCURRENT_NSLOTS] ;  // user thread id of each slot,
+                                // or 0 if the slot is free
+    GB_Pending slot [GB_CONCURRENT_NSLOTS] ;    // pending tuples of each slot
+    GB_Pending spill ;          // pending tuples of threads with no slot
+} ;
+
+typedef struct GB_Concurrent_struct *GB_Concurrent ;
+
+//------------------------------------------------------------------------------
+// GB_Shared data structure: arrays shared by GrB_*_dup (copy-on-write)
+//------------------------------------------------------------------------------
+
+// If GxB_DUP_COPY_ON_WRITE is enabled, GrB_Matrix_dup and GrB_Vector_dup do
+// not copy the arrays of the input matrix.  Instead, the arrays are moved into
+// a GB_Shared struct, and both matrices point to them as shallow components.
+// The arrays are freed when refcount drops to zero.  See GB_dup_shared.c and
+// GB_unshare.c.  A matrix mapped from a file by GxB_Matrix_mmap_read holds
+// its arrays in the same way, inside a read-only mapping of the file
+// (mmap_base), which is unmapped instead (see GB_mmap_read.c).  A matrix
+// created by GxB_Matrix_deserialize_view points into a blob owned by the user
+// application (user_owned is true), which is never freed.
+
+struct GB_Shared_struct     // arrays shared by one or more matrices
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    int64_t refcount ;      // # of matrices that share these arrays
+    int64_t *p ;            // the arrays; see GB_matrix.h
+    size_t p_size ;
+    int64_t *h ;
+    size_t h_size ;
+    int8_t *b ;
+    size_t b_size ;
+    int64_t *i ;
+    size_t i_size ;
+    void *x ;
+    size_t x_size ;
+    void *mmap_base ;       // file mapping holding the arrays, or NULL
+    size_t mmap_size ;      // size of the mapping
+    bool user_owned ;       // true if the arrays are owned by the user
+} ;
+
+typedef struct GB_Shared_struct *GB_Shared ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
@@ -24,6 +24,7 @@
 // modified; in this case, GxB_Context_engage can return GrB_NOT_IMPLEMENTED.
 
 #include "GB.h"
+#include "mxm/GB_AxB_saxpy3.h"
 
 #if defined ( _OPENMP )
 
@@ -247,3 +248,156 @@ void GB_Context_gpu_id_set
     }
 }
 
+
+//------------------------------------------------------------------------------
+// Context->numa_first_touch: parallel first touch of large blocks of memory
+//------------------------------------------------------------------------------
+
+//  GB_Context_numa_first_touch_get: get numa_first_touch from a Context
+bool GB_Context_numa_first_touch_get (GxB_Context Context)
+{
+    bool numa_first_touch ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        numa_first_touch = GxB_CONTEXT_WORLD->numa_first_touch ;
+    }
+    else
+    { 
+        numa_first_touch = Context->numa_first_touch ;
+    }
+    return (numa_first_touch) ;
+}
+
+//  GB_Context_numa_first_touch: get numa_first_touch from the current Context
+bool GB_Context_numa_first_touch (void)
+{ 
+    return (GB_Context_numa_first_touch_get (GB_CONTEXT_THREAD)) ;
+}
+
+//  GB_Context_numa_first_touch_set: set numa_first_touch in a Context
+void GB_Context_numa_first_touch_set
+(
+    GxB_Context Context,
+    bool numa_first_touch
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->numa_first_touch = numa_first_touch ;
+    }
+    else
+    { 
+        Context->numa_first_touch = numa_first_touch ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Context->mxm_plan_max: # of saxpy3 plans to keep for reuse in GrB_mxm
+//------------------------------------------------------------------------------
+
+//  GB_Context_mxm_plan_max_get: get max # of saxpy3 plans kept by a Context
+int GB_Context_mxm_plan_max_get (GxB_Context Context)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        // GxB_CONTEXT_WORLD never keeps any plans
+        return (0) ;
+    }
+    else
+    { 
+        return (Context->mxm_plan_max) ;
+    }
+}
+
+//  GB_Context_mxm_plan_max_set: set max # of saxpy3 plans kept by a Context
+GrB_Info GB_Context_mxm_plan_max_set
+(
+    GxB_Context Context,
+    int mxm_plan_max
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        // GxB_CONTEXT_WORLD is shared by all user threads, so it cannot
+        // keep any plans
+        return (GrB_INVALID_VALUE) ;
+    }
+    mxm_plan_max = GB_IMAX (mxm_plan_max, 0) ;
+    mxm_plan_max = GB_IMIN (mxm_plan_max, GB_SAXPY3_PLAN_MAX) ;
+    if (mxm_plan_max != Context->mxm_plan_max)
+    { 
+        // discard all plans kept so far; the next GrB_mxm will create new ones
+        GB_AxB_saxpy3_plans_free (Context) ;
+        Context->mxm_plan_max = mxm_plan_max ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//  GB_Context_mxm_plans: get the Context of this user thread, if it keeps plans
+GxB_Context GB_Context_mxm_plans (void)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD ||
+        Context->mxm_plan_max <= 0)
+    { 
+        // no Context engaged by this user thread, or its plans are disabled
+        return (NULL) ;
+    }
+    return (Context) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->mxm_workspace: keep the saxpy3 workspace for reuse in GrB_mxm
+//------------------------------------------------------------------------------
+
+//  GB_Context_mxm_workspace_get: true if a Context keeps saxpy3 workspace
+bool GB_Context_mxm_workspace_get (GxB_Context Context)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        // GxB_CONTEXT_WORLD never keeps any workspace
+        return (false) ;
+    }
+    else
+    { 
+        return (Context->mxm_workspace) ;
+    }
+}
+
+//  GB_Context_mxm_workspace_set: keep the saxpy3 workspace in a Context
+GrB_Info GB_Context_mxm_workspace_set
+(
+    GxB_Context Context,
+    bool mxm_workspace
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        // GxB_CONTEXT_WORLD is shared by all user threads, so it cannot
+        // keep any workspace
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (!mxm_workspace)
+    { 
+        // free the workspace kept so far
+        GB_AxB_saxpy3_werk_free (Context) ;
+    }
+    Context->mxm_workspace = mxm_workspace ;
+    return (GrB_SUCCESS) ;
+}
+
+//  GB_Context_mxm_workspace: get the Context of this user thread, if it keeps
+//  saxpy3 workspace
+GxB_Context GB_Context_mxm_workspace (void)
+{
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD ||
+        !Context->mxm_workspace)
+    { 
+        // no Context engaged by this user thread, or it keeps no workspace
+        return (NULL) ;
+    }
+    return (Context) ;
+}
@@ -25,4 +25,18 @@ int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+bool   GB_Context_numa_first_touch (void) ;
+bool   GB_Context_numa_first_touch_get (GxB_Context Context) ;
+void   GB_Context_numa_first_touch_set (GxB_Context Context,
+    bool numa_first_touch) ;
+
+int      GB_Context_mxm_plan_max_get (GxB_Context Context) ;
+GrB_Info GB_Context_mxm_plan_max_set (GxB_Context Context, int mxm_plan_max);
+GxB_Context GB_Context_mxm_plans (void) ;
+
+bool     GB_Context_mxm_workspace_get (GxB_Context Context) ;
+GrB_Info GB_Context_mxm_workspace_set (GxB_Context Context,
+    bool mxm_workspace) ;
+GxB_Context GB_Context_mxm_workspace (void) ;
+
 #endif
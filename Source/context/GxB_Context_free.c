@@ -20,6 +20,7 @@
 // GxB_Context_disengage (GxB_CONTEXT_WORLD) ;  // disengages any Context
 
 #include "GB.h"
+#include "mxm/GB_AxB_saxpy3.h"
 
 GrB_Info GxB_Context_free           // free a Context
 (
@@ -36,6 +37,10 @@ GrB_Info GxB_Context_free           // free a Context
             size_t header_size = Context->header_size ;
             // free the Context user_name
             GB_FREE (&(Context->user_name), Context->user_name_size) ;
+            // free any saxpy3 plans kept in the Context
+            GB_AxB_saxpy3_plans_free (Context) ;
+            // free any saxpy3 workspace kept in the Context
+            GB_AxB_saxpy3_werk_free (Context) ;
             if (header_size > 0)
             { 
                 Context->magic = GB_FREED ;  // to help detect dangling pointers
@@ -48,6 +48,19 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->nthreads_max = GB_Context_nthreads_max_get (NULL) ;
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
+    Context->numa_first_touch = GB_Context_numa_first_touch_get (NULL) ;
+
+    // no saxpy3 plans are kept until enabled by GrB_set (..., GxB_MXM_PLAN)
+    Context->mxm_plan_max = 0 ;
+    Context->mxm_plan_next = 0 ;
+    Context->mxm_plans = NULL ;
+    Context->mxm_plans_size = 0 ;
+
+    // no saxpy3 workspace is kept until enabled by GrB_set (...,
+    // GxB_MXM_WORKSPACE)
+    Context->mxm_workspace = false ;
+    Context->mxm_werk = NULL ;
+    Context->mxm_werk_size = 0 ;
 
     // return the result
     (*Context_handle) = Context ;
@@ -28,5 +28,31 @@ GrB_Info GB_dup_worker      // make an exact copy of a matrix
     const GrB_Type ctype    // type of C, if numeric is false
 ) ;
 
+GrB_Info GB_dup_shared      // C = A, sharing the arrays of A (copy-on-write)
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix to copy
+    GB_Werk Werk
+) ;
+
+void GB_dup_shared_control_set (bool control) ;
+bool GB_dup_shared_control_get (void) ;
+
+GrB_Info GB_unshare         // give A its own copy of any shared arrays
+(
+    GrB_Matrix A,           // matrix to unshare
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_shared_create   // move the arrays of A into a new GB_Shared struct
+(
+    GrB_Matrix A            // matrix whose arrays are to be shared
+) ;
+
+void GB_shared_free         // release the arrays shared by A, if any
+(
+    GrB_Matrix A            // matrix to release
+) ;
+
 #endif
 
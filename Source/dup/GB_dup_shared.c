@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+// GB_dup_shared: C = A, sharing the arrays of A until either is modified
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If enabled by GrB_set (GrB_GLOBAL, true, GxB_DUP_COPY_ON_WRITE),
+// GrB_Matrix_dup and GrB_Vector_dup do not copy the arrays of the input
+// matrix A, which takes O(nnz(A)) time and memory.  Instead, the arrays of A
+// (A->p, A->h, A->b, A->i, and A->x) are moved into a reference-counted
+// GB_Shared struct, and A and the new matrix C both point to them as shallow
+// components.  A sequence of snapshots of A shares a single GB_Shared struct.
+
+// A matrix that shares its arrays is never modified in place.  All
+// user-callable methods that modify a matrix first call GB_unshare, via
+// GB_WHERE for the output of most methods, which gives the matrix its own
+// copy of the arrays (or takes them over, if no other matrix still shares
+// them).  A is finished first (see GB_dup), so a shared matrix has no zombies,
+// pending tuples, or jumbled vectors, and using it as an input to any method
+// never modifies the shared arrays.  C does not share the A->Y hyper_hash of
+// A, which is rebuilt for C when needed.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#define GB_FREE_ALL ;
+
+// true if GrB_*_dup shares the arrays of its input; false by default
+static bool GB_dup_shared_control = false ;
+
+//------------------------------------------------------------------------------
+// GB_dup_shared_control_set/get: enable or disable copy-on-write dup
+//------------------------------------------------------------------------------
+
+void GB_dup_shared_control_set (bool control)
+{
+    GB_ATOMIC_WRITE
+    GB_dup_shared_control = control ;
+}
+
+bool GB_dup_shared_control_get (void)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_dup_shared_control ;
+    return (control) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_dup_shared: C = A, sharing the arrays of A
+//------------------------------------------------------------------------------
+
+// The arrays of A are first moved into A->shared, if A owns all of them.
+// Each array of A must then be held in A->shared.  Otherwise (which does not
+// occur for a matrix owned by the user application), C = A is computed with a
+// deep copy instead.
+
+#define GB_SHAREABLE(X)                                                     \
+    (A->X == NULL || (A->X ## _shallow && A->X == A->shared->X))
+
+GrB_Info GB_dup_shared      // C = A, sharing the arrays of A (copy-on-write)
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix to copy
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to duplicate (shared)", GB0) ;
+    (*Chandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // delete any lingering zombies and assemble any pending tuples
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // move the arrays of A into a new GB_Shared struct, if not yet shared
+    //--------------------------------------------------------------------------
+
+    // A may be duplicated by several user threads at the same time; only one
+    // of them creates A->shared (see GB_unshare.c).
+
+    GB_OK (GB_shared_create (A)) ;
+
+    if (A->shared == NULL ||
+        !(GB_SHAREABLE (p) && GB_SHAREABLE (h) && GB_SHAREABLE (b) &&
+          GB_SHAREABLE (i) && GB_SHAREABLE (x)))
+    {
+        // A has shallow components owned by another matrix; copy them
+        return (GB_dup_worker (Chandle, A->iso, A, true, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the user_name of A, if present
+    //--------------------------------------------------------------------------
+
+    char *C_user_name = NULL ;
+    size_t C_user_name_size = 0 ;
+    if (A->user_name != NULL)
+    {
+        GB_OK (GB_user_name_set (&C_user_name, &C_user_name_size,
+            A->user_name, false)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the header of C, with no content
+    //--------------------------------------------------------------------------
+
+    info = GB_new (Chandle, // new header
+        A->type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_sparsity (A), A->hyper_switch, 0) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory; A keeps its shared arrays
+        GB_FREE (&C_user_name, C_user_name_size) ;
+        return (info) ;
+    }
+    GrB_Matrix C = (*Chandle) ;
+
+    //--------------------------------------------------------------------------
+    // C = A, with all its arrays shared with A
+    //--------------------------------------------------------------------------
+
+    ASSERT (C->magic == GB_MAGIC2) ;    // C not yet initialized
+    C->p = A->p ; C->p_shallow = (A->p != NULL) ; C->p_size = A->p_size ;
+    C->h = A->h ; C->h_shallow = (A->h != NULL) ; C->h_size = A->h_size ;
+    C->b = A->b ; C->b_shallow = (A->b != NULL) ; C->b_size = A->b_size ;
+    C->i = A->i ; C->i_shallow = (A->i != NULL) ; C->i_size = A->i_size ;
+    C->x = A->x ; C->x_shallow = (A->x != NULL) ; C->x_size = A->x_size ;
+    C->plen = A->plen ;
+    C->nvec = A->nvec ;
+    C->nvec_nonempty = A->nvec_nonempty ;
+    C->nvals = A->nvals ;
+    C->iso = A->iso ;                   // OK: C has the same iso property as A
+    C->sparsity_control = A->sparsity_control ;
+    C->no_hyper_hash = A->no_hyper_hash ;
+    C->user_name = C_user_name ;
+    C->user_name_size = C_user_name_size ;
+
+    GB_ATOMIC_UPDATE
+    A->shared->refcount++ ;
+    C->shared = A->shared ;
+    C->magic = GB_MAGIC ;
+
+    GB_BURBLE_MATRIX (A, "(%sdup shared) ", A->iso ? "iso " : "") ;
+    ASSERT_MATRIX_OK (C, "C = A, shared", GB0) ;
+    return (GrB_SUCCESS) ;
+}
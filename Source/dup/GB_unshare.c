@@ -0,0 +1,255 @@
+//------------------------------------------------------------------------------
+// GB_unshare: give a matrix its own copy of the arrays shared by GrB_*_dup
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GB_dup_shared, and the matrix it was copied from, share
+// their arrays in a reference-counted GB_Shared struct (A->shared).  Before
+// such a matrix is modified, GB_unshare gives it its own copy of each array
+// it still shares, and releases its reference to A->shared.  If A is the
+// last matrix that holds a reference, it takes over the arrays instead, with
+// no copy.  GB_unshare does nothing if A does not share any arrays, or if A
+// is not a valid matrix (a NULL or faulty matrix is detected by the caller).
+
+// A view created by GxB_Matrix_view (see GB_view.c) also holds a reference to
+// A->shared of its parent, but its shallow arrays can point inside the shared
+// arrays rather than to their start.  Those are always copied.  The arrays of
+// a matrix mapped from a file (see GB_mmap_read.c), or deserialized in place
+// from a blob owned by the user application (see GB_deserialize.c), are also
+// always copied, since they cannot be freed on their own.
+
+// GB_shared_create moves the arrays of a matrix into a new GB_Shared struct,
+// held by the matrix alone, if the matrix owns all of its arrays and does not
+// already share them.  The input matrix of GrB_*_dup or GxB_Matrix_view can
+// be used by several user threads at the same time, so the struct is created
+// and published in A->shared inside a critical section.  Once A->shared is
+// set, it and the shallow flags of A no longer change while A is only used as
+// an input, so the caller can read them after GB_shared_create returns.
+
+// GB_shared_free releases the reference of A to its shared arrays, and frees
+// them if A held the last reference.  It is called by GB_phybix_free, after
+// the arrays of A itself have been freed or cleared.
+
+// The refcount is updated atomically, since matrices that share their arrays
+// can be used by different user threads at the same time.  Two matrices that
+// share arrays can be unshared by two user threads at the same time; both
+// then copy the arrays, and the last one to release its reference frees them.
+
+#include "GB.h"
+#include "mmap/GB_mmap.h"
+
+//------------------------------------------------------------------------------
+// GB_unshare_array: copy one array, or take it over, if it is still shared
+//------------------------------------------------------------------------------
+
+static bool GB_unshare_array    // return false if out of memory
+(
+    void **X,               // A->p, A->h, A->b, A->i, or A->x
+    size_t *X_size,         // size of *X in bytes (may be zero for a view)
+    bool *X_shallow,        // true if *X is shallow
+    void **S,               // the same array in A->shared
+    size_t *S_size,         // its size
+    const bool last,        // if true, A holds the last reference to A->shared
+                            // and the array can be taken over
+    const int nthreads_max
+)
+{
+
+    if (!(*X_shallow) || (*X) == NULL)
+    {
+        // this array is not shared
+        return (true) ;
+    }
+
+    if (last && (*X) == (*S))
+    {
+        // take over the array from A->shared; it is not freed by
+        // GB_shared_free.  A view of the leading part of the array has a
+        // smaller *X_size, so the size of the whole array is taken as well.
+        (*X_size) = (*S_size) ;
+        (*S) = NULL ;
+        (*S_size) = 0 ;
+    }
+    else
+    {
+        // make a copy of the array
+        size_t size = 0 ;
+        void *C = GB_MALLOC (*X_size, GB_void, &size) ;
+        if (C == NULL)
+        {
+            // out of memory; A still shares this array
+            return (false) ;
+        }
+        GB_memcpy (C, *X, *X_size, nthreads_max) ;
+        (*X) = C ;
+        (*X_size) = size ;
+    }
+
+    (*X_shallow) = false ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_unshare: give A its own copy of any shared arrays
+//------------------------------------------------------------------------------
+
+GrB_Info GB_unshare         // give A its own copy of any shared arrays
+(
+    GrB_Matrix A,           // matrix to unshare
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->magic != GB_MAGIC || A->shared == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A to unshare", GB0) ;
+    GB_Shared shared = A->shared ;
+    int64_t refcount ;
+    GB_ATOMIC_READ
+    refcount = shared->refcount ;
+    const bool last = (refcount == 1) && (shared->mmap_base == NULL)
+        && !(shared->user_owned) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    GB_BURBLE_MATRIX (A, "(%s) ", last ? "unshare" : "copy on write") ;
+
+    //--------------------------------------------------------------------------
+    // copy or take over each array
+    //--------------------------------------------------------------------------
+
+    if (!GB_unshare_array ((void **) &(A->p), &(A->p_size), &(A->p_shallow),
+            (void **) &(shared->p), &(shared->p_size), last, nthreads_max) ||
+        !GB_unshare_array ((void **) &(A->h), &(A->h_size), &(A->h_shallow),
+            (void **) &(shared->h), &(shared->h_size), last, nthreads_max) ||
+        !GB_unshare_array ((void **) &(A->b), &(A->b_size), &(A->b_shallow),
+            (void **) &(shared->b), &(shared->b_size), last, nthreads_max) ||
+        !GB_unshare_array ((void **) &(A->i), &(A->i_size), &(A->i_shallow),
+            (void **) &(shared->i), &(shared->i_size), last, nthreads_max) ||
+        !GB_unshare_array ((void **) &(A->x), &(A->x_size), &(A->x_shallow),
+            (void **) &(shared->x), &(shared->x_size), last, nthreads_max))
+    {
+        // out of memory; A is still valid, and shares the arrays not yet
+        // copied
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // release the reference of A to its shared arrays
+    //--------------------------------------------------------------------------
+
+    GB_shared_free (A) ;
+    ASSERT_MATRIX_OK (A, "A unshared", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_shared_create: move the arrays of A into a new GB_Shared struct
+//------------------------------------------------------------------------------
+
+// A->shared is left unchanged if A already shares its arrays, or if it has
+// any shallow array (owned by another matrix, or by the user application).
+
+GrB_Info GB_shared_create   // move the arrays of A into a new GB_Shared struct
+(
+    GrB_Matrix A            // matrix whose arrays are to be shared
+)
+{
+
+    ASSERT (A != NULL) ;
+    GrB_Info info = GrB_SUCCESS ;
+
+    #pragma omp critical (GB_shared_create)
+    {
+        if (A->shared == NULL && !A->p_shallow && !A->h_shallow &&
+            !A->b_shallow && !A->i_shallow && !A->x_shallow)
+        {
+            size_t header_size ;
+            GB_Shared shared = GB_CALLOC (1, struct GB_Shared_struct,
+                &header_size) ;
+            if (shared == NULL)
+            { 
+                // out of memory
+                info = GrB_OUT_OF_MEMORY ;
+            }
+            else
+            { 
+                shared->header_size = header_size ;
+                shared->refcount = 1 ;
+                shared->p = A->p ; shared->p_size = A->p_size ;
+                shared->h = A->h ; shared->h_size = A->h_size ;
+                shared->b = A->b ; shared->b_size = A->b_size ;
+                shared->i = A->i ; shared->i_size = A->i_size ;
+                shared->x = A->x ; shared->x_size = A->x_size ;
+                A->p_shallow = (A->p != NULL) ;
+                A->h_shallow = (A->h != NULL) ;
+                A->b_shallow = (A->b != NULL) ;
+                A->i_shallow = (A->i != NULL) ;
+                A->x_shallow = (A->x != NULL) ;
+                A->shared = shared ;
+            }
+        }
+    }
+
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_shared_free: release the arrays shared by A, if any
+//------------------------------------------------------------------------------
+
+void GB_shared_free         // release the arrays shared by A, if any
+(
+    GrB_Matrix A            // matrix to release
+)
+{
+
+    if (A == NULL || A->shared == NULL)
+    {
+        // nothing to do
+        return ;
+    }
+
+    GB_Shared shared = A->shared ;
+    A->shared = NULL ;
+    int64_t refcount ;
+    GB_ATOMIC_CAPTURE
+    refcount = --(shared->refcount) ;
+
+    if (refcount == 0 && shared->mmap_base != NULL)
+    {
+        // A held the last reference to a file mapping; unmap it
+        GB_mmap_unmap (shared->mmap_base, shared->mmap_size) ;
+        size_t header_size = shared->header_size ;
+        GB_FREE (&shared, header_size) ;
+    }
+    else if (refcount == 0 && shared->user_owned)
+    {
+        // A held the last reference to arrays owned by the user application;
+        // free only the struct
+        size_t header_size = shared->header_size ;
+        GB_FREE (&shared, header_size) ;
+    }
+    else if (refcount == 0)
+    {
+        // A held the last reference; free the arrays and the struct
+        GB_FREE (&(shared->p), shared->p_size) ;
+        GB_FREE (&(shared->h), shared->h_size) ;
+        GB_FREE (&(shared->b), shared->b_size) ;
+        GB_FREE (&(shared->i), shared->i_size) ;
+        GB_FREE (&(shared->x), shared->x_size) ;
+        size_t header_size = shared->header_size ;
+        GB_FREE (&shared, header_size) ;
+    }
+}
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// C = A, making a deep copy
+// C = A, making a deep copy, or a copy that shares the arrays of A if
+// GxB_DUP_COPY_ON_WRITE is enabled (see GB_dup_shared.c)
 
 #include "GB.h"
 
@@ -31,7 +32,16 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     // duplicate the matrix
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup (C, A, Werk) ;
+    GrB_Info info ;
+    if (GB_dup_shared_control_get ( ))
+    { 
+        // C = A, sharing the arrays of A until either one is modified
+        info = GB_dup_shared (C, A, Werk) ;
+    }
+    else
+    { 
+        info = GB_dup (C, A, Werk) ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
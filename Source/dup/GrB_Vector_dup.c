@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// w = u, making a deep copy
+// w = u, making a deep copy, or a copy that shares the arrays of u if
+// GxB_DUP_COPY_ON_WRITE is enabled (see GB_dup_shared.c)
 
 #include "GB.h"
 
@@ -32,7 +33,16 @@ GrB_Info GrB_Vector_dup     // make an exact copy of a vector
     // duplicate the vector
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    GrB_Info info ;
+    if (GB_dup_shared_control_get ( ))
+    { 
+        // w = u, sharing the arrays of u until either one is modified
+        info = GB_dup_shared ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    }
+    else
+    { 
+        info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Werk) ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -22,6 +22,21 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GB_Werk Werk
 ) ;
 
+// true if GrB_*_setElement must use GB_setElement_concurrent
+#define GB_SETELEMENT_CONCURRENT(C) ((C) != NULL && (C)->concurrent != NULL)
+
+GrB_Info GB_setElement_concurrent   // C(row,col) = scalar, from any thread
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code, // type of the scalar
+    GB_Werk Werk
+) ;
+
+bool GB_setElement_concurrent_supported (void) ;
+
 GrB_Info GB_Vector_removeElement
 (
     GrB_Vector V,               // vector to remove entry from
@@ -37,5 +52,31 @@ GrB_Info GB_Matrix_removeElement
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_batch_check         // check the indices of a batch of tuples
+(
+    const GrB_Matrix C,         // matrix the tuples refer to
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int64_t nvals,        // # of tuples
+    const int nthreads,         // # of threads to use
+    GB_Werk Werk
+) ;
+
+void GB_batch_lookup            // find a batch of tuples in C
+(
+    int64_t *restrict Pos,      // size nvals; position of each tuple in C
+    const GrB_Matrix C,         // matrix to search
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int64_t nvals,        // # of tuples
+    const int nthreads          // # of threads to use
+) ;
+
+GrB_Info GB_batch_wait          // finish C if it has enough pending work
+(
+    GrB_Matrix C,               // matrix to check
+    GB_Werk Werk
+) ;
+
 #endif
 
@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_batch_lookup: find a batch of tuples in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Used by GxB_Matrix_insertTuples and GxB_Matrix_deleteTuples.
+// GB_batch_check checks the indices of all the tuples, before the matrix is
+// modified.  GB_batch_lookup then finds the position of each tuple C(i,j) in
+// C, in parallel, with the same search as GB_setElement and
+// GrB_Matrix_removeElement.  C is not modified by either method.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_batch_check: check the indices of a batch of tuples
+//------------------------------------------------------------------------------
+
+GrB_Info GB_batch_check         // check the indices of a batch of tuples
+(
+    const GrB_Matrix C,         // matrix the tuples refer to
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int64_t nvals,        // # of tuples
+    const int nthreads,         // # of threads to use
+    GB_Werk Werk
+)
+{
+
+    GrB_Index nrows = (GrB_Index) GB_NROWS (C) ;
+    GrB_Index ncols = (GrB_Index) GB_NCOLS (C) ;
+
+    int64_t nbad = 0 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < nvals ; k++)
+    {
+        nbad += (I [k] >= nrows || J [k] >= ncols) ;
+    }
+
+    if (nbad > 0)
+    {
+        // find the first tuple out of bounds, for the error message
+        for (k = 0 ; k < nvals ; k++)
+        {
+            if (I [k] >= nrows || J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+                    "index (" GBu "," GBu ") out of bounds,"
+                    " must be < (" GBu ", " GBu ")",
+                    I [k], J [k], nrows, ncols) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_batch_lookup: find the position of each tuple in C
+//------------------------------------------------------------------------------
+
+// Pos [k] is the position of C(I[k],J[k]) in C->i, C->b, or C->x, or -1 if
+// it is not in the pattern of C.  If C is sparse or hypersparse, the entry at
+// Pos [k] may be a zombie.  If C is bitmap or full, every tuple is found, but
+// the entry is not present if C->b [Pos [k]] is zero.  C must not be jumbled;
+// pending tuples are not searched.
+
+void GB_batch_lookup            // find a batch of tuples in C
+(
+    int64_t *restrict Pos,      // size nvals; position of each tuple in C
+    const GrB_Matrix C,         // matrix to search
+    const GrB_Index *I,         // row indices of the tuples
+    const GrB_Index *J,         // column indices of the tuples
+    const int64_t nvals,        // # of tuples
+    const int nthreads          // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Pos != NULL) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    // handle the CSR/CSC format: i is the index within vector j
+    const GrB_Index *restrict Ilist = (C->is_csc) ? I : J ;
+    const GrB_Index *restrict Jlist = (C->is_csc) ? J : I ;
+    const int64_t cvlen = C->vlen ;
+    int64_t k ;
+
+    if (GB_IS_BITMAP (C) || GB_IS_FULL (C))
+    {
+
+        //----------------------------------------------------------------------
+        // C is bitmap or full
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            Pos [k] = Ilist [k] + Jlist [k] * cvlen ;
+        }
+
+    }
+    else if (GB_nnz (C) == 0)
+    {
+
+        //----------------------------------------------------------------------
+        // C is empty
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            Pos [k] = -1 ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict Cp = C->p ;
+        const int64_t *restrict Ch = C->h ;
+        const int64_t *restrict Ci = C->i ;
+        const int64_t *restrict C_Yp = (C->Y == NULL) ? NULL : C->Y->p ;
+        const int64_t *restrict C_Yi = (C->Y == NULL) ? NULL : C->Y->i ;
+        const int64_t *restrict C_Yx = (C->Y == NULL) ? NULL : C->Y->x ;
+        const int64_t C_hash_bits = (C->Y == NULL) ? 0 : (C->Y->vdim - 1) ;
+        const int64_t cnvec = C->nvec ;
+        const int64_t nzombies = C->nzombies ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            int64_t i = Ilist [k] ;
+            int64_t j = Jlist [k] ;
+
+            // find C(:,j)
+            int64_t pC_start, pC_end ;
+            bool found ;
+            if (Ch != NULL)
+            {
+                // C is hypersparse
+                int64_t kC = GB_hyper_hash_lookup (Ch, cnvec, Cp, C_Yp, C_Yi,
+                    C_Yx, C_hash_bits, j, &pC_start, &pC_end) ;
+                found = (kC >= 0) ;
+            }
+            else
+            {
+                // C is sparse
+                pC_start = Cp [j] ;
+                pC_end   = Cp [j+1] ;
+                found = true ;
+            }
+
+            // find C(i,j) in C(:,j)
+            int64_t pleft = pC_start ;
+            if (found)
+            {
+                if (pC_end - pC_start == cvlen)
+                {
+                    // C(:,j) is as-if-full, so no binary search is needed
+                    pleft += i ;
+                }
+                else
+                {
+                    // binary search for C(i,j): time is O(log(cjnz))
+                    int64_t pright = pC_end - 1 ;
+                    bool is_zombie ;
+                    GB_BINARY_SEARCH_ZOMBIE (i, Ci, pleft, pright, found,
+                        nzombies, is_zombie) ;
+                }
+            }
+            Pos [k] = (found) ? pleft : -1 ;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GB_batch_wait: decide if a matrix should be finished after a batch update
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_insertTuples and GxB_Matrix_deleteTuples leave new entries as
+// pending tuples and deleted entries as zombies.  Finishing them with GB_wait
+// takes O(e + p*log(p)) time for a matrix with e entries and p pending tuples,
+// so waiting after every batch would make a stream of small batches take time
+// quadratic in the number of updates.  Leaving them for too long has a cost
+// as well: deleting a tuple not found in C requires a wait if C has pending
+// tuples, and every pending tuple takes memory until it is assembled.
+
+// The policy used here is to finish C when the pending work (the number of
+// pending tuples and zombies) reaches 1/GB_BATCH_WAIT_RATIO of the number of
+// live entries in C.  The cost of each wait is then spread over at least
+// e/GB_BATCH_WAIT_RATIO updates, for O(GB_BATCH_WAIT_RATIO + log(p)) amortized
+// time per update.  The hyper_hash of C is rebuilt after the wait, so the next
+// batch of lookups is fast.  Otherwise, GB_block finishes C if the mode is
+// blocking, or if there are many pending tuples.
+
+#include "pending/GB_Pending.h"
+
+#define GB_FREE_ALL ;
+
+#define GB_BATCH_WAIT_RATIO 4
+
+GrB_Info GB_batch_wait          // finish C if it has enough pending work
+(
+    GrB_Matrix C,               // matrix to check
+    GB_Werk Werk
+)
+{
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+
+    int64_t npending = GB_Pending_n (C) ;
+    int64_t nzombies = C->nzombies ;
+    int64_t nwork = npending + nzombies ;
+    int64_t nlive = GB_nnz (C) - nzombies ;
+
+    if (nwork > 0 && GB_BATCH_WAIT_RATIO * nwork >= nlive)
+    {
+        // assemble the pending tuples, delete the zombies, and rebuild the
+        // hyper_hash
+        GB_OK (GB_wait (C, "C (batch update)", Werk)) ;
+        GB_OK (GB_hyper_hash_build (C, Werk)) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // finish C if blocking mode is enabled, or if it has many pending tuples
+    return (GB_block (C, Werk)) ;
+}
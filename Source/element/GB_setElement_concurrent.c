@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+// GB_setElement_concurrent: C(row,col) = scalar, from many user threads
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_CONCURRENT_SETELEMENT is enabled for C, GrB_Matrix_setElement_TYPE
+// and GrB_Vector_setElement_TYPE call this method instead of GB_setElement,
+// and several user threads can call them on the same matrix C at the same
+// time.  C itself is not modified.  Instead, the scalar is typecast to the
+// type of C, and the tuple is appended to the list of pending tuples of the
+// slot owned by this user thread, in C->concurrent.  The first time a thread
+// adds a tuple to C (since the last GB_Pending_gather), it claims a free slot
+// with an atomic compare-and-exchange; after that it appends to its slot with
+// no lock and no atomic update.  If all GB_CONCURRENT_NSLOTS slots are owned
+// by other threads, the tuple is appended to the spill list of C->concurrent,
+// in a critical section.
+
+// The tuples are moved into C->Pending by GB_Pending_gather, when the next
+// method (other than this one) uses C, and are then assembled by GB_wait as
+// usual, with the implied SECOND operator.  If C(row,col) is already present
+// in C, it is overwritten by the pending tuple, as it would be by
+// GB_setElement.  The user application must ensure that all the threads have
+// finished calling GrB_*_setElement before C is used by any other method.
+
+// If this method runs out of memory, the tuples that this thread added to its
+// slot since the last GB_Pending_gather are lost.  C itself is not changed,
+// since other threads may be adding tuples to it.
+
+// GrB_BLOCKING mode is ignored; the tuples are assembled by the next method
+// that uses C.
+
+#include "pending/GB_Pending.h"
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// thread id of each user thread
+//------------------------------------------------------------------------------
+
+// Each user thread is given a unique id (1, 2, 3, ...) the first time it uses
+// this method, held in thread-local storage, in the same way as the GxB_Context
+// of the thread (see GB_Context.c).
+
+#if defined ( _OPENMP )
+
+    static int64_t GB_CONCURRENT_THREAD_ID = 0 ;
+    #pragma omp threadprivate (GB_CONCURRENT_THREAD_ID)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    static __thread int64_t GB_CONCURRENT_THREAD_ID = 0 ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    static __declspec ( thread ) int64_t GB_CONCURRENT_THREAD_ID = 0 ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    #include <threads.h>
+    static _Thread_local int64_t GB_CONCURRENT_THREAD_ID = 0 ;
+
+#else
+
+    // no thread-local storage: GxB_CONCURRENT_SETELEMENT cannot be enabled
+    #define GB_CONCURRENT_NO_THREAD_ID
+
+#endif
+
+// # of user threads given an id so far
+static int64_t GB_concurrent_nthreads = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_setElement_concurrent_supported: true if thread-local storage is present
+//------------------------------------------------------------------------------
+
+bool GB_setElement_concurrent_supported (void)
+{ 
+    #if defined ( GB_CONCURRENT_NO_THREAD_ID )
+    return (false) ;
+    #else
+    return (true) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_concurrent_slot: find or claim the slot of this user thread
+//------------------------------------------------------------------------------
+
+// Returns the slot owned by this user thread, or -1 if all slots are owned by
+// other threads.  A slot is released only by GB_Concurrent_clear, so once a
+// thread has claimed a slot, it finds the same one each time.
+
+static inline int GB_concurrent_slot
+(
+    GB_Concurrent Concurrent
+)
+{
+
+    #if defined ( GB_CONCURRENT_NO_THREAD_ID )
+    return (-1) ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // get the id of this user thread
+    //--------------------------------------------------------------------------
+
+    int64_t id = GB_CONCURRENT_THREAD_ID ;
+    if (id == 0)
+    { 
+        GB_ATOMIC_CAPTURE_INC64 (id, GB_concurrent_nthreads) ;
+        id++ ;
+        GB_CONCURRENT_THREAD_ID = id ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the slot owned by this thread, or claim a free one
+    //--------------------------------------------------------------------------
+
+    // Threads with consecutive ids start their search at different slots.
+    int s0 = (int) ((id - 1) % GB_CONCURRENT_NSLOTS) ;
+    for (int k = 0 ; k < GB_CONCURRENT_NSLOTS ; k++)
+    {
+        int s = (s0 + k) % GB_CONCURRENT_NSLOTS ;
+        int64_t owner ;
+        GB_ATOMIC_READ
+        owner = Concurrent->owner [s] ;
+        while (owner == 0)
+        {
+            // the slot is free; try to claim it.  The compare-and-exchange
+            // can fail spuriously, so try again until the slot is owned.
+            int64_t expected = 0 ;
+            if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Concurrent->owner [s]),
+                expected, id))
+            { 
+                owner = id ;
+            }
+            else
+            { 
+                GB_ATOMIC_READ
+                owner = Concurrent->owner [s] ;
+            }
+        }
+        if (owner == id)
+        { 
+            return (s) ;
+        }
+    }
+    return (-1) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_setElement_concurrent
+//------------------------------------------------------------------------------
+
+GrB_Info GB_setElement_concurrent   // C(row,col) = scalar, from any thread
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code, // type of the scalar
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C != NULL && C->concurrent != NULL) ;
+    GB_RETURN_IF_NULL (scalar) ;
+
+    if (row >= GB_NROWS (C))
+    { 
+        GB_ERROR (GrB_INVALID_INDEX,
+            "Row index " GBu " out of range; must be < " GBd,
+            row, GB_NROWS (C)) ;
+    }
+    if (col >= GB_NCOLS (C))
+    { 
+        GB_ERROR (GrB_INVALID_INDEX,
+            "Column index " GBu " out of range; must be < " GBd,
+            col, GB_NCOLS (C)) ;
+    }
+
+    ASSERT (scalar_code <= GB_UDT_code) ;
+
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+
+    // scalar_code and C must be compatible
+    if (!GB_code_compatible (scalar_code, ccode))
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input scalar of type [%s]\n"
+            "cannot be typecast to entry of type [%s]",
+            GB_code_string (scalar_code), ctype->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // typecast the scalar to the type of C
+    //--------------------------------------------------------------------------
+
+    size_t csize = ctype->size ;
+    GB_void cwork [GB_VLA(csize)] ;
+    GB_cast_scalar (cwork, ccode, scalar, scalar_code, csize) ;
+
+    //--------------------------------------------------------------------------
+    // append the tuple to the slot of this thread, or to the spill list
+    //--------------------------------------------------------------------------
+
+    int64_t i, j ;
+    if (C->is_csc)
+    { 
+        i = row ;
+        j = col ;
+    }
+    else
+    { 
+        i = col ;
+        j = row ;
+    }
+
+    GB_Concurrent Concurrent = C->concurrent ;
+    const bool is_matrix = (C->vdim > 1) ;
+    bool ok ;
+    int s = GB_concurrent_slot (Concurrent) ;
+    if (s >= 0)
+    { 
+        // no other thread uses this slot, so no lock is needed
+        ok = GB_Pending_add (&(Concurrent->slot [s]), false, cwork, ctype,
+            NULL, i, j, is_matrix, Werk) ;
+    }
+    else
+    { 
+        #pragma omp critical (GB_concurrent_spill)
+        ok = GB_Pending_add (&(Concurrent->spill), false, cwork, ctype,
+            NULL, i, j, is_matrix, Werk) ;
+    }
+
+    if (!ok)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // flag C as having pending tuples
+    //--------------------------------------------------------------------------
+
+    // C->concurrent_pending is written only if it is not already set, so that
+    // threads do not contend for the cache line of the header of C.
+    bool pending ;
+    GB_ATOMIC_READ
+    pending = C->concurrent_pending ;
+    if (!pending)
+    { 
+        GB_ATOMIC_WRITE
+        C->concurrent_pending = true ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -22,6 +22,16 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
     GrB_Index col                       /* column index                   */\
 )                                                                           \
 {                                                                           \
+    if (GB_SETELEMENT_CONCURRENT (C))                                       \
+    {                                                                       \
+        /* other user threads may be setting entries of C at the same     */\
+        /* time, so C must not be touched by GB_WHERE                     */\
+        GB_WHERE1 (GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)           \
+            " (C, row, col, x)") ;                                          \
+        GB_RETURN_IF_FAULTY (C) ;                                           \
+        return (GB_setElement_concurrent (C, ampersand x, row, col,         \
+            GB_ ## T ## _code, Werk)) ;                                     \
+    }                                                                       \
     GB_WHERE (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)             \
         " (C, row, col, x)") ;                                              \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
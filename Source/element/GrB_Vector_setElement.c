@@ -21,6 +21,15 @@ GrB_Info GB_EVAL3 (prefix, _Vector_setElement_, T)    /* w(row) = x */      \
     GrB_Index row                       /* row index                  */    \
 )                                                                           \
 {                                                                           \
+    if (GB_SETELEMENT_CONCURRENT (w))                                       \
+    {                                                                       \
+        /* other user threads may be setting entries of w at the same     */\
+        /* time, so w must not be touched by GB_WHERE                     */\
+        GB_WHERE1 ("GrB_Vector_setElement_" GB_STR(T) " (w, x, row)") ;     \
+        GB_RETURN_IF_FAULTY (w) ;                                           \
+        return (GB_setElement_concurrent ((GrB_Matrix) w, ampersand x, row, \
+            0, GB_ ## T ## _code, Werk)) ;                                  \
+    }                                                                       \
     GB_WHERE (w, "GrB_Vector_setElement_" GB_STR(T) " (w, x, row)") ;       \
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
     ASSERT (GB_VECTOR_OK (w)) ;                                             \
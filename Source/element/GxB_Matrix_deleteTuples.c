@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deleteTuples: remove a batch of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_deleteTuples (C, I, J, nvals) removes the entries C(I[k],J[k])
+// for k = 0 to nvals-1, with the same result as nvals calls to
+// GrB_Matrix_removeElement.  Tuples that are not present in C are ignored.
+
+// Each tuple is first found in C, in parallel, with GB_batch_lookup, and the
+// entries found are then turned into zombies (or cleared from the bitmap of C)
+// in parallel.  A tuple may appear more than once, so each entry is removed
+// with an atomic compare-and-exchange, and only the thread that succeeds
+// counts it.  If any tuple is not found and C has pending tuples, they are
+// assembled with GB_wait and the batch is searched again, as in
+// GrB_Matrix_removeElement.  GB_batch_wait then decides if the zombies should
+// be deleted.  If any index is out of bounds, GrB_INDEX_OUT_OF_BOUNDS is
+// returned and C is not modified.
+
+#include "GB.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Pos, Pos_size) ;         \
+}
+
+//------------------------------------------------------------------------------
+// GB_batch_delete: remove the entries found by GB_batch_lookup
+//------------------------------------------------------------------------------
+
+// Returns the # of tuples not found in C.
+
+static int64_t GB_batch_delete
+(
+    GrB_Matrix C,                   // matrix to modify
+    const int64_t *restrict Pos,    // position of each tuple in C, or -1
+    const int64_t nvals,            // number of tuples
+    const int nthreads              // # of threads to use
+)
+{
+
+    int64_t nmissing = 0 ;
+    int64_t ndeleted = 0 ;
+    int64_t k ;
+
+    if (GB_IS_BITMAP (C))
+    {
+
+        //----------------------------------------------------------------------
+        // C is bitmap: clear each entry from the bitmap
+        //----------------------------------------------------------------------
+
+        int8_t *restrict Cb = C->b ;
+        const int8_t none = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndeleted)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            int64_t p = Pos [k] ;
+            int8_t cb ;
+            GB_ATOMIC_READ
+            cb = Cb [p] ;
+            while (cb != 0)
+            {
+                // C(i,j) is present: try to remove it.  The compare-and-
+                // exchange can fail spuriously, so try again until C(i,j) is
+                // removed, by this thread or another one.
+                int8_t expected = cb ;
+                if (GB_ATOMIC_COMPARE_EXCHANGE_8 (&(Cb [p]), expected, none))
+                {
+                    ndeleted++ ;
+                    break ;
+                }
+                GB_ATOMIC_READ
+                cb = Cb [p] ;
+            }
+        }
+        C->nvals -= ndeleted ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse: each entry becomes a zombie
+        //----------------------------------------------------------------------
+
+        int64_t *restrict Ci = C->i ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndeleted) reduction(+:nmissing)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            int64_t p = Pos [k] ;
+            if (p < 0)
+            {
+                // C(i,j) is not in the pattern of C
+                nmissing++ ;
+                continue ;
+            }
+            int64_t i ;
+            GB_ATOMIC_READ
+            i = Ci [p] ;
+            while (!GB_IS_ZOMBIE (i))
+            {
+                // C(i,j) is a live entry: try to turn it into a zombie.  The
+                // compare-and-exchange can fail spuriously, so try again until
+                // C(i,j) is a zombie.
+                int64_t expected = i ;
+                int64_t zombie = GB_ZOMBIE (i) ;
+                if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Ci [p]), expected,
+                    zombie))
+                {
+                    ndeleted++ ;
+                    break ;
+                }
+                GB_ATOMIC_READ
+                i = Ci [p] ;
+            }
+        }
+        C->nzombies += ndeleted ;
+    }
+
+    return (nmissing) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Matrix_deleteTuples: remove C(I[k],J[k]) for all k
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_Matrix_deleteTuples
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int64_t nvals,            // number of tuples
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Pos = NULL ; size_t Pos_size = 0 ;
+
+    ASSERT_MATRIX_OK (C, "C for deleteTuples", GB0) ;
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    GB_OK (GB_batch_check (C, I, J, nvals, nthreads, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (C))
+    {
+        // convert C from full to sparse
+        GB_OK (GB_convert_to_nonfull (C, Werk)) ;
+    }
+    else if (C->jumbled)
+    {
+        GB_OK (GB_wait (C, "C (deleteTuples:jumbled)", Werk)) ;
+    }
+
+    ASSERT (!GB_IS_FULL (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+
+    if (GB_nnz (C) == 0 && C->Pending == NULL)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find each tuple in C and remove it
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_hyper_hash_build (C, Werk)) ;
+    Pos = GB_MALLOC_WORK (nvals, int64_t, &Pos_size) ;
+    if (Pos == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_batch_lookup (Pos, C, I, J, nvals, nthreads) ;
+    int64_t nmissing = GB_batch_delete (C, Pos, nvals, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // assemble any pending tuples and look again for the missing tuples
+    //--------------------------------------------------------------------------
+
+    // A tuple not found in C may be one of its pending tuples.  The entries
+    // removed above are deleted by GB_wait and so are not found again.
+
+    if (nmissing > 0 && C->Pending != NULL)
+    {
+        GB_OK (GB_wait (C, "C (deleteTuples:pending tuples)", Werk)) ;
+        if (GB_IS_FULL (C))
+        { 
+            // C has all its entries, and has become full
+            GB_OK (GB_convert_to_nonfull (C, Werk)) ;
+        }
+        GB_OK (GB_hyper_hash_build (C, Werk)) ;
+        ASSERT (!GB_ZOMBIES (C)) ;
+        ASSERT (!GB_JUMBLED (C)) ;
+        ASSERT (!GB_PENDING (C)) ;
+        GB_batch_lookup (Pos, C, I, J, nvals, nthreads) ;
+        GB_batch_delete (C, Pos, nvals, nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace, and finish C if it has enough pending work
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    ASSERT_MATRIX_OK (C, "C after deleteTuples", GB0) ;
+    return (GB_batch_wait (C, Werk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_deleteTuples: remove a batch of entries from a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_deleteTuples    // remove C(I[k],J[k]) for all k
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_deleteTuples (C, I, J, nvals)") ;
+    GB_BURBLE_START ("GxB_Matrix_deleteTuples") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    if (nvals > GB_NMAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: nvals " GBu
+            " exceeds " GBu, nvals, GB_NMAX) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // delete the tuples
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_Matrix_deleteTuples (C, I, J, (int64_t) nvals, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
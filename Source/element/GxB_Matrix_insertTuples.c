@@ -0,0 +1,326 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_insertTuples: set a batch of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_insertTuples (C, I, J, X, nvals) sets C(I[k],J[k]) = X[k] for
+// k = 0 to nvals-1, with the same result as nvals calls to
+// GrB_Matrix_setElement, in that order: if a tuple appears more than once,
+// its last value is kept.  X has the type of C.
+
+// Each tuple is first found in C, in parallel, with GB_batch_lookup.  Tuples
+// found in C (live entries or zombies) are then written into C in the order
+// they appear, so the last one of any duplicates wins.  The remaining tuples
+// are appended to the pending tuples of C, in parallel, all at once.
+// GB_batch_wait then decides if the pending tuples should be assembled.  If
+// any index is out of bounds, GrB_INDEX_OUT_OF_BOUNDS is returned and C is
+// not modified.
+
+#include "pending/GB_Pending.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (Count, int64_t) ;          \
+    GB_FREE_WORK (&Pos, Pos_size) ;         \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+//------------------------------------------------------------------------------
+// GB_Matrix_insertTuples: C(I[k],J[k]) = X[k] for all k
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_Matrix_insertTuples
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GB_void *X,               // array of values of tuples
+    const int64_t nvals,            // number of tuples
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Pos = NULL ; size_t Pos_size = 0 ;
+    GB_WERK_DECLARE (Count, int64_t) ;
+
+    ASSERT_MATRIX_OK (C, "C for insertTuples", GB0) ;
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    GB_OK (GB_batch_check (C, I, J, nvals, nthreads, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // sort C if needed; do not assemble pending tuples or kill zombies yet
+    //--------------------------------------------------------------------------
+
+    if (C->jumbled)
+    {
+        GB_OK (GB_wait (C, "C (insertTuples:jumbled)", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if C needs to convert to non-iso, or if C is a new iso matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = C->type ;
+    size_t csize = ctype->size ;
+    bool C_is_new = (GB_nnz (C) == 0 && !GB_IS_FULL (C) && C->Pending == NULL);
+
+    if (C->iso || C_is_new)
+    {
+        // compare each value with the iso value of C, or with X [0]
+        const GB_void *restrict x0 = (C->iso) ? ((GB_void *) C->x) : X ;
+        bool X_iso = true ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:X_iso)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            X_iso = X_iso && (memcmp (X + k * csize, x0, csize) == 0) ;
+        }
+
+        if (C->iso && !X_iso)
+        {
+            // assemble all pending tuples and convert C to non-iso
+            if (C->Pending != NULL)
+            {
+                GB_OK (GB_wait (C, "C (insertTuples:to non-iso)", Werk)) ;
+            }
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+        else if (C_is_new && X_iso)
+        {
+            // C is empty and all the tuples have the same value
+            GB_OK (GB_convert_any_to_iso (C, (GB_void *) X)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wait if the prior pending tuples are not compatible with the new ones
+    //--------------------------------------------------------------------------
+
+    // The new pending tuples have the type of C and the implied SECOND_ctype
+    // operator, as in GB_setElement with no accum.
+
+    if (C->Pending != NULL && (C->Pending->type != ctype ||
+        !GB_op_is_second (C->Pending->op, ctype)))
+    {
+        GB_OK (GB_wait (C, "C (insertTuples:incompatible pending tuples)",
+            Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find each tuple in C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_hyper_hash_build (C, Werk)) ;
+    Pos = GB_MALLOC_WORK (nvals, int64_t, &Pos_size) ;
+    GB_WERK_PUSH (Count, nthreads + 1, int64_t) ;
+    if (Pos == NULL || Count == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_batch_lookup (Pos, C, I, J, nvals, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // write the tuples found in C, in order, and count the new tuples
+    //--------------------------------------------------------------------------
+
+    const bool C_iso = C->iso ;
+    const bool C_is_bitmap = GB_IS_BITMAP (C) ;
+    int8_t  *restrict Cb = C->b ;
+    int64_t *restrict Ci = C->i ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t kstart, kend, nnew = 0 ;
+        GB_PARTITION (kstart, kend, nvals, tid, nthreads) ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t p = Pos [k] ;
+            if (p < 0)
+            {
+                // C(i,j) is not in C: it becomes a pending tuple
+                nnew++ ;
+                continue ;
+            }
+            if (!C_iso)
+            {
+                // C(i,j) = X [k]
+                memcpy (Cx + p * csize, X + k * csize, csize) ;
+            }
+            if (C_is_bitmap)
+            {
+                // set the entry in the C bitmap
+                C->nvals += (Cb [p] == 0) ;
+                Cb [p] = 1 ;
+            }
+            else if (Ci != NULL && GB_IS_ZOMBIE (Ci [p]))
+            {
+                // bring the zombie back to life
+                Ci [p] = GB_DEZOMBIE (Ci [p]) ;
+                C->nzombies-- ;
+            }
+        }
+        Count [tid] = nnew ;
+    }
+
+    GB_cumsum1 (Count, nthreads) ;
+    int64_t nnew = Count [nthreads] ;
+
+    //--------------------------------------------------------------------------
+    // append the new tuples to the pending tuples of C
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // make room for the new pending tuples
+        //----------------------------------------------------------------------
+
+        ASSERT (!GB_IS_FULL (C) && !C_is_bitmap) ;
+        if (!GB_Pending_ensure (&(C->Pending), C_iso, ctype, NULL,
+            C->vdim > 1, nnew, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (C) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        GB_Pending Pending = C->Pending ;
+        ASSERT (Pending->type == ctype) ;
+        ASSERT (C_iso == (Pending->x == NULL)) ;
+        const int64_t n0 = Pending->n ;
+        int64_t *restrict Pending_i = Pending->i ;
+        int64_t *restrict Pending_j = Pending->j ;
+        GB_void *restrict Pending_x = Pending->x ;
+
+        //----------------------------------------------------------------------
+        // copy the new tuples into the list, in parallel
+        //----------------------------------------------------------------------
+
+        // handle the CSR/CSC format: i is the index within vector j
+        const GrB_Index *restrict Ilist = (C->is_csc) ? I : J ;
+        const GrB_Index *restrict Jlist = (C->is_csc) ? J : I ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, nvals, tid, nthreads) ;
+            int64_t pn = n0 + Count [tid] ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                if (Pos [k] >= 0) continue ;
+                Pending_i [pn] = Ilist [k] ;
+                if (Pending_j != NULL)
+                {
+                    Pending_j [pn] = Jlist [k] ;
+                }
+                if (Pending_x != NULL)
+                {
+                    memcpy (Pending_x + pn * csize, X + k * csize, csize) ;
+                }
+                pn++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // keep track of whether or not the pending tuples are still sorted
+        //----------------------------------------------------------------------
+
+        bool sorted = Pending->sorted ;
+        if (sorted)
+        {
+            int64_t p ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(&&:sorted)
+            for (p = GB_IMAX (n0, 1) ; p < n0 + nnew ; p++)
+            {
+                int64_t jlast = (Pending_j != NULL) ? Pending_j [p-1] : 0 ;
+                int64_t j     = (Pending_j != NULL) ? Pending_j [p  ] : 0 ;
+                sorted = sorted && ((jlast < j) ||
+                    (jlast == j && Pending_i [p-1] <= Pending_i [p])) ;
+            }
+        }
+        Pending->sorted = sorted ;
+        Pending->n += nnew ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace, and finish C if it has enough pending work
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C after insertTuples", GB0) ;
+    return (GB_batch_wait (C, Werk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_insertTuples: set a batch of entries in a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_insertTuples    // C(I[k],J[k]) = X[k] for all k
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_insertTuples (C, I, J, X, nvals)") ;
+    GB_BURBLE_START ("GxB_Matrix_insertTuples") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    GB_RETURN_IF_NULL (X) ;
+    if (nvals > GB_NMAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: nvals " GBu
+            " exceeds " GBu, nvals, GB_NMAX) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the tuples
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_Matrix_insertTuples (C, I, J, (const GB_void *) X,
+        (int64_t) nvals, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
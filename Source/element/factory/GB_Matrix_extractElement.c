@@ -44,7 +44,7 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     // tuples exist, wait and then extractElement again.
 
     // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
+    if (GB_ANY_PENDING_WORK (A))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
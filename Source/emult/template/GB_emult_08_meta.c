@@ -34,6 +34,9 @@
     const int64_t *restrict Ai = A->i ;
     const int64_t vlen = A->vlen ;
 
+    // method for the intersection of A(:,j) and B(:,j) when both are sparse
+    GB_DECLARE_INTERSECT_METHOD (intersect_method) ;
+
     #ifdef GB_JIT_KENEL
     #define A_is_hyper  GB_A_IS_HYPER
     #define A_is_sparse GB_A_IS_SPARSE
@@ -33,10 +33,10 @@
         for ( ; pB < pB_end ; pB++)
         {
             int64_t i = Bi [pB] ;
-            // find i in A(:,j)
+            // find i in A(:,j), starting at the last entry found
             int64_t pright = pA_end - 1 ;
             bool found ;
-            GB_BINARY_SEARCH (i, Ai, pA, pright, found) ;
+            GB_GALLOP_SEARCH (i, Ai, pA, pright, found) ;
             if (found)
             { 
                 // C (i,j) = A (i,j) .* B (i,j)
@@ -71,10 +71,10 @@
         for ( ; pA < pA_end ; pA++)
         {
             int64_t i = Ai [pA] ;
-            // find i in B(:,j)
+            // find i in B(:,j), starting at the last entry found
             int64_t pright = pB_end - 1 ;
             bool found ;
-            GB_BINARY_SEARCH (i, Bi, pB, pright, found) ;
+            GB_GALLOP_SEARCH (i, Bi, pB, pright, found) ;
             if (found)
             { 
                 // C (i,j) = A (i,j) .* B (i,j)
@@ -106,43 +106,32 @@
         // Method8(d): A(:,j) and B(:,j) about the sparsity
         //----------------------------------------------------------
 
-        // linear-time scan of A(:,j) and B(:,j)
-
-        while (pA < pA_end && pB < pB_end)
-        {
-            int64_t iA = Ai [pA] ;
-            int64_t iB = Bi [pB] ;
-            if (iA < iB)
-            { 
-                // A(i,j) exists but not B(i,j)
-                pA++ ;
-            }
-            else if (iB < iA)
-            { 
-                // B(i,j) exists but not A(i,j)
-                pB++ ;
-            }
-            else
-            { 
-                // both A(i,j) and B(i,j) exist
-                // C (i,j) = A (i,j) .* B (i,j)
-                #if ( GB_EMULT_08_PHASE == 1 )
-                cjnz++ ;
-                #else
-                ASSERT (pC < pC_end) ;
-                Ci [pC] = iB ;
-                #ifndef GB_ISO_EMULT
-                GB_DECLAREA (aij) ;
-                GB_GETA (aij, Ax, pA, A_iso) ;
-                GB_DECLAREB (bij) ;
-                GB_GETB (bij, Bx, pB, B_iso) ;
-                GB_EWISEOP (Cx, pC, aij, bij, iB, j) ;
-                #endif
-                pC++ ;
-                #endif
-                pA++ ;
-                pB++ ;
-            }
+        // linear-time scan of A(:,j) and B(:,j), with blocks of 4 or 8
+        // entries compared at once if the cpu has AVX2 or AVX512F (see
+        // GB_intersect.h)
+
+        while (GB_intersect_next (intersect_method,
+            Ai, &pA, pA_end, Bi, &pB, pB_end))
+        { 
+            // both A(i,j) and B(i,j) exist
+            // C (i,j) = A (i,j) .* B (i,j)
+            #if ( GB_EMULT_08_PHASE == 1 )
+            cjnz++ ;
+            #else
+            int64_t i = Bi [pB] ;
+            ASSERT (pC < pC_end) ;
+            Ci [pC] = i ;
+            #ifndef GB_ISO_EMULT
+            GB_DECLAREA (aij) ;
+            GB_GETA (aij, Ax, pA, A_iso) ;
+            GB_DECLAREB (bij) ;
+            GB_GETB (bij, Bx, pB, B_iso) ;
+            GB_EWISEOP (Cx, pC, aij, bij, i, j) ;
+            #endif
+            pC++ ;
+            #endif
+            pA++ ;
+            pB++ ;
         }
 
         #if ( GB_EMULT_08_PHASE == 2 )
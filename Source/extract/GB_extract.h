@@ -28,5 +28,14 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_view            // C = A(:,kfirst:klast), sharing the arrays of A
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix, with no pending work
+    const int64_t kfirst,   // first vector of A in C
+    const int64_t klast,    // last vector of A in C
+    GB_Werk Werk
+) ;
+
 #endif
 
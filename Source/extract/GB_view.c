@@ -0,0 +1,259 @@
+//------------------------------------------------------------------------------
+// GB_view: C = a range of vectors of A, sharing the arrays of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A(:,kfirst:klast) if A is held by column, or A(kfirst:klast,:) if A is
+// held by row, where C has the same format as A.  The entries of a range of
+// vectors of A are contiguous in A->i, A->x, and A->b, so C can point inside
+// those arrays instead of copying them.  If A is sparse or hypersparse, C gets
+// its own C->p (and C->h) array, of size O(klast-kfirst+1) (or the number of
+// vectors of A in the range, if A is hypersparse), since the offsets in A->p
+// must be shifted so that Cp [0] is zero.  The values are shared if A is iso.
+
+// The arrays of A are moved into A->shared (see GB_dup_shared.c), and C holds
+// a reference to them, so A can be modified or freed while C remains valid.
+// C is a regular matrix that can be used as an input to any method.  If C is
+// modified, it gets its own copy of its arrays first (see GB_unshare.c).
+
+// A must have no pending work.  GrB_NO_VALUE is returned, with C not created,
+// if A has shallow arrays that it cannot share (which does not occur for a
+// matrix owned by the user application).  The caller then uses GB_extract.
+
+#include "extract/GB_extract.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE (&Cp, Cp_size) ;                \
+    GB_FREE (&Ch, Ch_size) ;                \
+}
+
+GrB_Info GB_view            // C = A(:,kfirst:klast), sharing the arrays of A
+(
+    GrB_Matrix *Chandle,    // handle of output matrix to create
+    const GrB_Matrix A,     // input matrix, with no pending work
+    const int64_t kfirst,   // first vector of A in C
+    const int64_t klast,    // last vector of A in C
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for view", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (0 <= kfirst && kfirst <= klast && klast < A->vdim) ;
+    (*Chandle) = NULL ;
+
+    int64_t *Cp = NULL ; size_t Cp_size = 0 ;
+    int64_t *Ch = NULL ; size_t Ch_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // move the arrays of A into a new GB_Shared struct, if not yet shared
+    //--------------------------------------------------------------------------
+
+    // A may be used by several user threads at the same time; only one of
+    // them creates A->shared (see GB_unshare.c).  A->shared and the shallow
+    // flags of A do not change after GB_shared_create returns.
+
+    GB_OK (GB_shared_create (A)) ;
+
+    // A must hold A->b, A->i, and A->x in A->shared
+    if (A->shared == NULL ||
+        (A->b != NULL && !A->b_shallow) || (A->i != NULL && !A->i_shallow) ||
+        (A->x != NULL && !A->x_shallow))
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
+    const int sparsity = GB_sparsity (A) ;
+
+    //--------------------------------------------------------------------------
+    // construct C->p and C->h, and find the range of entries of A in C
+    //--------------------------------------------------------------------------
+
+    int64_t cvdim = klast - kfirst + 1 ;
+    int64_t cnvec = cvdim, cplen = cvdim ;
+    int64_t cnvec_nonempty = 0 ;
+    int64_t pfirst, cnz ;   // C holds entries pfirst:pfirst+cnz-1 of A
+
+    if (sparsity == GxB_SPARSE || sparsity == GxB_HYPERSPARSE)
+    {
+
+        //----------------------------------------------------------------------
+        // find the vectors of A in the range kfirst:klast
+        //----------------------------------------------------------------------
+
+        int64_t hfirst = kfirst, hend = klast + 1 ;
+        if (sparsity == GxB_HYPERSPARSE)
+        {
+            // hfirst: first k with Ah [k] >= kfirst
+            bool found ;
+            int64_t pleft = 0, pright = anvec - 1 ;
+            GB_SPLIT_BINARY_SEARCH (kfirst, Ah, pleft, pright, found) ;
+            hfirst = pleft ;
+            // hend: first k with Ah [k] > klast
+            pleft = hfirst ; pright = anvec - 1 ;
+            GB_SPLIT_BINARY_SEARCH (klast+1, Ah, pleft, pright, found) ;
+            hend = pleft ;
+            cnvec = hend - hfirst ;
+            cplen = GB_IMAX (cnvec, 1) ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate C->p and C->h
+        //----------------------------------------------------------------------
+
+        Cp = GB_MALLOC (cplen+1, int64_t, &Cp_size) ;
+        if (sparsity == GxB_HYPERSPARSE)
+        {
+            Ch = GB_MALLOC (cplen, int64_t, &Ch_size) ;
+        }
+        if (Cp == NULL || (sparsity == GxB_HYPERSPARSE && Ch == NULL))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Cp = Ap [hfirst:hend] - Ap [hfirst], and Ch = Ah [hfirst:hend-1]
+        //----------------------------------------------------------------------
+
+        pfirst = Ap [hfirst] ;
+        cnz = Ap [hend] - pfirst ;
+        int nthreads = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:cnvec_nonempty)
+        for (k = 0 ; k < cnvec ; k++)
+        {
+            int64_t pA = Ap [hfirst + k] ;
+            int64_t pA_end = Ap [hfirst + k + 1] ;
+            Cp [k] = pA - pfirst ;
+            if (pA_end > pA) cnvec_nonempty++ ;
+            if (Ch != NULL)
+            {
+                Ch [k] = Ah [hfirst + k] - kfirst ;
+            }
+        }
+        Cp [cnvec] = cnz ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // A is bitmap or full: C holds a contiguous block of A
+        //----------------------------------------------------------------------
+
+        pfirst = kfirst * avlen ;
+        cnz = cvdim * avlen ;
+        cnvec_nonempty = (avlen > 0) ? cvdim : 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the entries in C, if A is bitmap
+    //--------------------------------------------------------------------------
+
+    int64_t cnvals = cnz ;
+    if (sparsity == GxB_BITMAP)
+    {
+        cnvals = 0 ;
+        int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:cnvals)
+        for (p = 0 ; p < cnz ; p++)
+        {
+            cnvals += Ab [pfirst + p] ;
+        }
+        cnvec_nonempty = -1 ;       // computed when needed
+    }
+
+    //--------------------------------------------------------------------------
+    // create the header of C, with no content
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (Chandle, // new header
+        A->type, avlen, cvdim, GB_Ap_null, A->is_csc, sparsity,
+        A->hyper_switch, 0)) ;
+    GrB_Matrix C = (*Chandle) ;
+    ASSERT (C->magic == GB_MAGIC2) ;    // C not yet initialized
+
+    //--------------------------------------------------------------------------
+    // C = A(:,kfirst:klast), pointing inside the shared arrays of A
+    //--------------------------------------------------------------------------
+
+    C->p = Cp ; C->p_size = Cp_size ;
+    C->h = Ch ; C->h_size = Ch_size ;
+    Cp = NULL ;
+    Ch = NULL ;
+
+    if (A->b != NULL)
+    {
+        C->b = A->b + pfirst ;
+        C->b_size = cnz * sizeof (int8_t) ;
+        C->b_shallow = true ;
+    }
+    if (A->i != NULL)
+    {
+        C->i = A->i + pfirst ;
+        C->i_size = cnz * sizeof (int64_t) ;
+        C->i_shallow = true ;
+    }
+    if (A->x != NULL)
+    {
+        if (A_iso)
+        {
+            // all of C shares the single value of A
+            C->x = A->x ;
+            C->x_size = A->x_size ;
+        }
+        else
+        {
+            C->x = ((GB_void *) A->x) + pfirst * asize ;
+            C->x_size = cnz * asize ;
+        }
+        C->x_shallow = true ;
+    }
+
+    C->plen = (sparsity == GxB_SPARSE || sparsity == GxB_HYPERSPARSE) ?
+        cplen : -1 ;
+    C->nvec = cnvec ;
+    C->nvec_nonempty = cnvec_nonempty ;
+    C->nvals = cnvals ;
+    C->iso = A_iso ;                    // OK: C has the same iso property as A
+    C->sparsity_control = A->sparsity_control ;
+
+    GB_ATOMIC_UPDATE
+    A->shared->refcount++ ;
+    C->shared = A->shared ;
+    C->magic = GB_MAGIC ;
+
+    GB_BURBLE_MATRIX (C, "(%sview) ", A_iso ? "iso " : "") ;
+    ASSERT_MATRIX_OK (C, "C = view of A", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_view: C = A(I,J), sharing the arrays of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A(I,J) is created as a new matrix.  If the submatrix is a contiguous
+// range of whole vectors of A (a range of columns of a matrix held by column,
+// or a range of rows of a matrix held by row), C is constructed in O(1) time
+// and memory if A is bitmap or full, or in O(length of the range) if A is
+// sparse or hypersparse, and it shares the entries of A (see GB_view).
+// Otherwise, C = A(I,J) is computed with GrB_extract, as a regular matrix.
+
+// In either case, C is a regular matrix that can be used in any method.  It is
+// not modified if A is later modified or freed, since each of them first gets
+// its own copy of the arrays they share (see GB_unshare).
+
+#include "extract/GB_extract.h"
+#include "ij/GB_ij.h"
+#define GB_FREE_ALL GB_Matrix_free (&C) ;
+
+//------------------------------------------------------------------------------
+// GB_view_range: determine if an index list is a contiguous range
+//------------------------------------------------------------------------------
+
+// Returns true if the list I is the contiguous range kfirst:klast, with
+// 0 <= kfirst <= klast < limit.  Returns false if I is empty, out of bounds,
+// or is not contiguous.
+
+static bool GB_view_range
+(
+    const GrB_Index *I,     // list of indices
+    const int64_t ni,       // length of I, or special
+    const int64_t limit,    // indices must be in the range 0 to limit-1
+    int64_t *kfirst,        // first index in I
+    int64_t *klast          // last index in I
+)
+{
+
+    int64_t nI, Icolon [3] ;
+    int Ikind ;
+    GB_ijlength (I, ni, limit, &nI, &Ikind, Icolon) ;
+    if (nI == 0)
+    {
+        // an empty list is not viewed
+        return (false) ;
+    }
+
+    if (Ikind == GB_ALL || Ikind == GB_RANGE)
+    {
+        (*kfirst) = Icolon [GxB_BEGIN] ;
+        (*klast ) = Icolon [GxB_END  ] ;
+    }
+    else if (Ikind == GB_LIST)
+    {
+        // check if the explicit list is ibegin:ibegin+nI-1
+        int64_t ibegin = (int64_t) GB_IMIN (I [0], INT64_MAX) ;
+        if (ibegin >= limit) return (false) ;
+        for (int64_t k = 1 ; k < nI ; k++)
+        {
+            if (I [k] != (GrB_Index) (ibegin + k))
+            {
+                return (false) ;
+            }
+        }
+        (*kfirst) = ibegin ;
+        (*klast ) = ibegin + nI - 1 ;
+    }
+    else
+    {
+        // a strided or backwards list is not viewed
+        return (false) ;
+    }
+
+    return (0 <= (*kfirst) && (*kfirst) <= (*klast) && (*klast) < limit) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_view: C = A(I,J), sharing the arrays of A if possible
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_view            // C = A(I,J), sharing the arrays of A
+(
+    GrB_Matrix *Chandle,            // handle of output matrix to create
+    const GrB_Matrix A,             // input matrix
+    const GrB_Index *I,             // row indices
+    GrB_Index ni,                   // number of row indices
+    const GrB_Index *J,             // column indices
+    GrB_Index nj                    // number of column indices
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WHERE1 ("GxB_Matrix_view (&C, A, I, ni, J, nj)") ;
+    GB_BURBLE_START ("GxB_Matrix_view") ;
+    GB_RETURN_IF_NULL (Chandle) ;
+    (*Chandle) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    GrB_Matrix C = NULL ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work in A
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // C = A(I,J) with no copy, if I and J select a range of vectors of A
+    //--------------------------------------------------------------------------
+
+    int64_t ifirst, ilast, jfirst, jlast ;
+    bool I_ok = GB_view_range (I, ni, GB_NROWS (A), &ifirst, &ilast) ;
+    bool J_ok = GB_view_range (J, nj, GB_NCOLS (A), &jfirst, &jlast) ;
+    bool I_all = I_ok && ifirst == 0 && ilast == GB_NROWS (A) - 1 ;
+    bool J_all = J_ok && jfirst == 0 && jlast == GB_NCOLS (A) - 1 ;
+
+    info = GrB_NO_VALUE ;
+    if (A->is_csc && I_all && J_ok)
+    {
+        // C = A(:,jfirst:jlast) where A is held by column
+        info = GB_view (Chandle, A, jfirst, jlast, Werk) ;
+    }
+    else if (!A->is_csc && J_all && I_ok)
+    {
+        // C = A(ifirst:ilast,:) where A is held by row
+        info = GB_view (Chandle, A, ifirst, ilast, Werk) ;
+    }
+
+    if (info != GrB_NO_VALUE)
+    {
+        // the view has been created, or an out-of-memory error occurred
+        GB_BURBLE_END ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // otherwise, C = A(I,J) with GrB_extract
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(view copied) ") ;
+    int64_t nI, nJ, Icolon [3], Jcolon [3] ;
+    int Ikind, Jkind ;
+    GB_ijlength (I, ni, GB_NROWS (A), &nI, &Ikind, Icolon) ;
+    GB_ijlength (J, nj, GB_NCOLS (A), &nJ, &Jkind, Jcolon) ;
+    GB_OK (GB_Matrix_new (&C, A->type, nI, nJ)) ;
+    GB_OK (GB_extract (C, false, NULL, false, false, NULL, A, false,
+        I, ni, J, nj, Werk)) ;
+    (*Chandle) = C ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
@@ -25,6 +25,13 @@ GrB_Info GB_matvec_set
     GrB_Info info ;
     GB_BURBLE_START ("GrB_set") ;
 
+    // A may be modified below, so it must not share its arrays with another
+    // matrix
+    GB_OK (GB_unshare (A, Werk)) ;
+
+    // and any tuples from concurrent setElement must be assembled
+    GB_OK (GB_Concurrent_wait (A, Werk)) ;
+
     int format = ivalue ;
 
     switch (field)
@@ -54,6 +61,34 @@ GrB_Info GB_matvec_set
             A->sparsity_control = GB_sparsity_control (ivalue, (int64_t) (-1)) ;
             break ;
 
+        case GxB_CONCURRENT_SETELEMENT : 
+
+            if (ivalue && A->concurrent == NULL)
+            {
+                // allow user threads to call GrB_*_setElement on A at the
+                // same time (see GB_setElement_concurrent.c)
+                if (!GB_setElement_concurrent_supported ( ))
+                { 
+                    // no thread-local storage
+                    return (GrB_NOT_IMPLEMENTED) ;
+                }
+                size_t header_size ;
+                A->concurrent = GB_CALLOC (1, struct GB_Concurrent_struct,
+                    &header_size) ;
+                if (A->concurrent == NULL)
+                { 
+                    // out of memory
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                A->concurrent->header_size = header_size ;
+            }
+            else if (!ivalue)
+            { 
+                // the tuples of A->concurrent have been assembled above
+                GB_Concurrent_free (&(A->concurrent)) ;
+            }
+            break ;
+
         case GrB_STORAGE_ORIENTATION_HINT : 
 
             format = (ivalue == GrB_COLMAJOR) ? GxB_BY_COL : GxB_BY_ROW ;
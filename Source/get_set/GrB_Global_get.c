@@ -9,6 +9,8 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "sort/GB_sort.h"
+#include "builder/GB_build.h"
 
 //------------------------------------------------------------------------------
 // GrB_Global: an object defining the global state
@@ -98,6 +100,11 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_Context_gpu_id_get (NULL) ;
             break ;
 
+        case GxB_GLOBAL_NUMA_FIRST_TOUCH :  // same as GxB_NUMA_FIRST_TOUCH
+
+            (*value) = (int) GB_Context_numa_first_touch_get (NULL) ;
+            break ;
+
         case GxB_BURBLE : 
 
             (*value) = (int) GB_Global_burble_get ( ) ;
@@ -127,6 +134,41 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            (*value) = (int) GB_jitifyer_get_async ( ) ;
+            break ;
+
+        case GxB_JIT_TUNE_REDUCE_PANEL : 
+
+            (*value) = (int) GB_jitifyer_get_tune_reduce_panel ( ) ;
+            break ;
+
+        case GxB_MEMORY_POOL_CONTROL : 
+
+            (*value) = (int) GB_memory_pool_control_get ( ) ;
+            break ;
+
+        case GxB_MEMORY_HUGE_PAGES : 
+
+            (*value) = (int) GB_memory_huge_pages_control_get ( ) ;
+            break ;
+
+        case GxB_DUP_COPY_ON_WRITE : 
+
+            (*value) = (int) GB_dup_shared_control_get ( ) ;
+            break ;
+
+        case GxB_BUILD_RADIX_SORT : 
+
+            (*value) = (int) GB_radix_sort_control_get ( ) ;
+            break ;
+
+        case GxB_BUILD_HASH : 
+
+            (*value) = (int) GB_build_hash_control_get ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -201,6 +243,13 @@ GrB_Info GrB_Global_get_Scalar
                         GB_INT64_code, Werk) ;
                     break ;
 
+                case GxB_MEMORY_POOL_MAX_BYTES : 
+
+                    i64 = GB_memory_pool_max_bytes_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
                 default : 
 
                     info = GrB_INVALID_VALUE ;
@@ -321,6 +370,11 @@ static GrB_Info GB_global_string_get (const char **value, int field)
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_RECORD_FILE : 
+
+            (*value) = GB_jitifyer_get_record_file ( ) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
@@ -455,6 +509,18 @@ GrB_Info GrB_Global_get_SIZE
                     info = GrB_SUCCESS ;
                     break ;
 
+                case GxB_MEMORY_POOL_LIMITS : 
+
+                    (*value) = sizeof (int64_t) * GxB_NMEMORY_POOL ;
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                case GxB_MEMORY_POOL_STATS : 
+
+                    (*value) = sizeof (int64_t) * GxB_NMEMORY_POOL_STATS ;
+                    info = GrB_SUCCESS ;
+                    break ;
+
                 case GxB_COMPILER_VERSION : 
 
                     (*value) = sizeof (int32_t) * 3 ;
@@ -524,6 +590,18 @@ GrB_Info GrB_Global_get_VOID
                 info = GrB_SUCCESS ;
                 break ;
 
+            case GxB_MEMORY_POOL_LIMITS : 
+
+                GB_memory_pool_limits_get ((int64_t *) value) ;
+                info = GrB_SUCCESS ;
+                break ;
+
+            case GxB_MEMORY_POOL_STATS : 
+
+                GB_memory_pool_stats_get ((int64_t *) value) ;
+                info = GrB_SUCCESS ;
+                break ;
+
             case GxB_COMPILER_VERSION : 
 
                 {
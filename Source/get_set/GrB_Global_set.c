@@ -9,6 +9,8 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "sort/GB_sort.h"
+#include "builder/GB_build.h"
 
 //------------------------------------------------------------------------------
 // GB_global_enum_set: get an enum value from the global state
@@ -51,6 +53,11 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_Context_gpu_id_set (NULL, value) ;
             break ;
 
+        case GxB_GLOBAL_NUMA_FIRST_TOUCH :  // same as GxB_NUMA_FIRST_TOUCH
+
+            GB_Context_numa_first_touch_set (NULL, (bool) value) ;
+            break ;
+
         case GxB_BURBLE : 
 
             GB_Global_burble_set ((bool) value) ;
@@ -66,11 +73,46 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_use_cmake ((bool) value) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            GB_jitifyer_set_async ((bool) value) ;
+            break ;
+
+        case GxB_JIT_TUNE_REDUCE_PANEL : 
+
+            GB_jitifyer_set_tune_reduce_panel ((bool) value) ;
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             GB_jitifyer_set_control (value) ;
             break ;
 
+        case GxB_MEMORY_POOL_CONTROL : 
+
+            GB_memory_pool_control_set ((bool) value) ;
+            break ;
+
+        case GxB_MEMORY_HUGE_PAGES : 
+
+            GB_memory_huge_pages_control_set ((bool) value) ;
+            break ;
+
+        case GxB_DUP_COPY_ON_WRITE : 
+
+            GB_dup_shared_control_set ((bool) value) ;
+            break ;
+
+        case GxB_BUILD_RADIX_SORT : 
+
+            GB_radix_sort_control_set ((bool) value) ;
+            break ;
+
+        case GxB_BUILD_HASH : 
+
+            GB_build_hash_control_set ((bool) value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -140,6 +182,15 @@ GrB_Info GrB_Global_set_Scalar
                 }
                 break ;
 
+            case GxB_MEMORY_POOL_MAX_BYTES : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    GB_memory_pool_max_bytes_set (i64value) ;
+                }
+                break ;
+
             default : 
 
                 info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
@@ -225,6 +276,11 @@ GrB_Info GrB_Global_set_String
                 info = GB_jitifyer_set_error_log (value) ;
                 break ;
 
+            case GxB_JIT_RECORD_FILE : 
+
+                info = GB_jitifyer_set_record_file (value) ;
+                break ;
+
             case GxB_JIT_CACHE_PATH : 
 
                 info = GB_jitifyer_set_cache_path (value) ;
@@ -329,6 +385,29 @@ GrB_Info GrB_Global_set_VOID
                 }
                 break ;
 
+            case GxB_MEMORY_POOL_LIMITS : 
+
+                if (value == NULL)
+                { 
+                    // use the default limits
+                    GB_memory_pool_limits_set (NULL) ;
+                }
+                else if (size < sizeof (int64_t) * GxB_NMEMORY_POOL)
+                { 
+                    info = GrB_INVALID_VALUE ;
+                }
+                else
+                { 
+                    GB_memory_pool_limits_set ((int64_t *) value) ;
+                }
+                break ;
+
+            case GxB_MEMORY_POOL_STATS : 
+
+                // clear the hit and miss counts
+                GB_memory_pool_stats_clear ( ) ;
+                break ;
+
             case GxB_PRINTF : 
 
                 if (size != sizeof (GB_printf_function_t))
@@ -56,6 +56,21 @@ GrB_Info GxB_Context_get_Scalar
             ivalue= GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_FIRST_TOUCH : // same as GxB_NUMA_FIRST_TOUCH
+
+            ivalue = (int) GB_Context_numa_first_touch_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_MXM_PLAN :         // same as GxB_MXM_PLAN
+
+            ivalue = GB_Context_mxm_plan_max_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_MXM_WORKSPACE :    // same as GxB_MXM_WORKSPACE
+
+            ivalue = (int) GB_Context_mxm_workspace_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -163,6 +178,21 @@ GrB_Info GxB_Context_get_INT
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_FIRST_TOUCH : // same as GxB_NUMA_FIRST_TOUCH
+
+            (*value) = (int) GB_Context_numa_first_touch_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_MXM_PLAN :         // same as GxB_MXM_PLAN
+
+            (*value) = GB_Context_mxm_plan_max_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_MXM_WORKSPACE :    // same as GxB_MXM_WORKSPACE
+
+            (*value) = (int) GB_Context_mxm_workspace_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
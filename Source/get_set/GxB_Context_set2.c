@@ -43,6 +43,9 @@ GrB_Info GxB_Context_set_Scalar
 
         case GxB_CONTEXT_NTHREADS :         // same as GxB_NTHREADS
         case GxB_CONTEXT_GPU_ID :           // same as GxB_GPU_ID
+        case GxB_CONTEXT_NUMA_FIRST_TOUCH : // same as GxB_NUMA_FIRST_TOUCH
+        case GxB_CONTEXT_MXM_PLAN :         // same as GxB_MXM_PLAN
+        case GxB_CONTEXT_MXM_WORKSPACE :    // same as GxB_MXM_WORKSPACE
             info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
             break ;
 
@@ -74,10 +77,23 @@ GrB_Info GxB_Context_set_Scalar
             GB_Context_gpu_id_set (Context, ivalue) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_FIRST_TOUCH : // same as GxB_NUMA_FIRST_TOUCH
+
+            GB_Context_numa_first_touch_set (Context, (bool) ivalue) ;
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             GB_Context_chunk_set (Context, dvalue) ;
             break ;
+
+        case GxB_CONTEXT_MXM_PLAN :         // same as GxB_MXM_PLAN
+
+            return (GB_Context_mxm_plan_max_set (Context, ivalue)) ;
+
+        case GxB_CONTEXT_MXM_WORKSPACE :    // same as GxB_MXM_WORKSPACE
+
+            return (GB_Context_mxm_workspace_set (Context, (bool) ivalue)) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -155,6 +171,19 @@ GrB_Info GxB_Context_set_INT
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_FIRST_TOUCH : // same as GxB_NUMA_FIRST_TOUCH
+
+            GB_Context_numa_first_touch_set (Context, (bool) value) ;
+            break ;
+
+        case GxB_CONTEXT_MXM_PLAN :         // same as GxB_MXM_PLAN
+
+            return (GB_Context_mxm_plan_max_set (Context, value)) ;
+
+        case GxB_CONTEXT_MXM_WORKSPACE :    // same as GxB_MXM_WORKSPACE
+
+            return (GB_Context_mxm_workspace_set (Context, (bool) value)) ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
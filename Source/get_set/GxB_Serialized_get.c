@@ -49,6 +49,11 @@ static GrB_Info GB_blob_header_get
     GB_BLOB_READ (blob_size2, uint64_t) ;
     GB_BLOB_READ (typecode, int32_t) ;
     uint64_t blob_size1 = (uint64_t) blob_size ;
+    if (typecode >= GB_BLOB_FILTERED)
+    { 
+        // the blob has filtered arrays (see GB_serialize.h)
+        typecode -= GB_BLOB_FILTERED ;
+    }
 
     if (blob_size1 != blob_size2
         || typecode < GB_BOOL_code || typecode > GB_UDT_code
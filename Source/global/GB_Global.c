@@ -16,6 +16,13 @@
 #include "GB.h"
 #include "cpu/GB_cpu_features.h"
 
+// # of 64-bit words needed for one bit per cpu feature
+#if GBX86 && !defined ( GBNCPUFEAT )
+#define GB_CPU_ISA_NWORDS ((X86_LAST_ + 63) / 64)
+#else
+#define GB_CPU_ISA_NWORDS 1
+#endif
+
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
 //------------------------------------------------------------------------------
@@ -131,6 +138,8 @@ typedef struct
 
     bool cpu_features_avx2 ;        // x86_64 with AVX2
     bool cpu_features_avx512f ;     // x86_64 with AVX512f
+    uint64_t cpu_features_isa [GB_CPU_ISA_NWORDS] ; // bit mask of the
+                                    // instruction set extensions
 
     //--------------------------------------------------------------------------
     // CUDA (DRAFT: in progress):
@@ -215,6 +224,7 @@ static GB_Global_struct GB_Global =
     // CPU features
     .cpu_features_avx2 = false,         // x86_64 with AVX2
     .cpu_features_avx512f = false,      // x86_64 with AVX512f
+    .cpu_features_isa = { 0 },          // no cpu features known
 
     // CUDA environment (DRAFT: in progress)
     .gpu_count = 0,                     // # of GPUs in the system
@@ -262,6 +272,32 @@ bool GB_Global_GrB_init_called_get (void)
 // Once these two flags are set, they are saved in the GB_Global struct, and
 // can then be queried later by GB_Global_cpu_features_avx*.
 
+// The cpu_features_isa array is a bit mask of the instruction set extensions
+// reported by the cpu_features package (SSE*, AVX*, FMA, BMI*, and so on),
+// with one bit per feature in as many 64-bit words as needed, or just AVX2
+// and AVX512F if the package is not available.  It is used by the JIT to keep
+// the compiled kernels for different classes of cpus in different folders
+// (see GB_jitifyer_set_lib_folder).  Features that do not change the
+// instructions a compiler may use (ERMS, self-snoop, direct cache access, and
+// the # of AVX512 FMA units) are excluded, so that cpus that differ only in
+// those features share their compiled kernels.
+
+#if GBX86 && !defined ( GBNCPUFEAT )
+static bool GB_cpu_feature_is_isa (X86FeaturesEnum k)
+{
+    switch (k)
+    {
+        case X86_ERMS :                 // fast REP MOVSB
+        case X86_SS :                   // self-snoop
+        case X86_DCA :                  // direct cache access
+        case X86_AVX512_SECOND_FMA :    // # of AVX512 FMA units
+            return (false) ;
+        default :
+            return (true) ;
+    }
+}
+#endif
+
 void GB_Global_cpu_features_query (void)
 { 
     #if GBX86
@@ -277,6 +313,17 @@ void GB_Global_cpu_features_query (void)
             X86Features features = GetX86Info ( ).features ;
             GB_Global.cpu_features_avx2 = (bool) (features.avx2) ;
             GB_Global.cpu_features_avx512f = (bool) (features.avx512f) ;
+            memset (GB_Global.cpu_features_isa, 0,
+                sizeof (GB_Global.cpu_features_isa)) ;
+            for (int k = 0 ; k < X86_LAST_ ; k++)
+            {
+                if (GB_cpu_feature_is_isa ((X86FeaturesEnum) k) &&
+                    GetX86FeaturesEnumValue (&features, (X86FeaturesEnum) k))
+                { 
+                    GB_Global.cpu_features_isa [k / 64] |=
+                        ((uint64_t) 1) << (k % 64) ;
+                }
+            }
         }
         #else
         {
@@ -303,6 +350,9 @@ void GB_Global_cpu_features_query (void)
                 GB_Global.cpu_features_avx512f = false ;
             }
             #endif
+            GB_Global.cpu_features_isa [0] =
+                ((uint64_t) GB_Global.cpu_features_avx2) |
+                ((uint64_t) GB_Global.cpu_features_avx512f << 1) ;
         }
         #endif
 
@@ -316,6 +366,7 @@ void GB_Global_cpu_features_query (void)
 
         GB_Global.cpu_features_avx2 = false ;
         GB_Global.cpu_features_avx512f = false ;
+        GB_Global.cpu_features_isa [0] = 0 ;
 
     }
     #endif
@@ -331,6 +382,12 @@ bool GB_Global_cpu_features_avx512f (void)
     return (GB_Global.cpu_features_avx512f) ;
 }
 
+const uint64_t *GB_Global_cpu_features_isa (int *nwords)
+{ 
+    (*nwords) = GB_CPU_ISA_NWORDS ;
+    return (GB_Global.cpu_features_isa) ;
+}
+
 //------------------------------------------------------------------------------
 // hyper_switch
 //------------------------------------------------------------------------------
@@ -56,6 +56,13 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y_shallow = false ;
     C->no_hyper_hash = false ;  // C is sparse, this flag is not necessary
 
+    // C does not hold a reference to any arrays shared by GrB_*_dup
+    C->shared = NULL ;
+
+    // C has no pending tuples from concurrent setElement
+    C->concurrent = NULL ;
+    C->concurrent_pending = false ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
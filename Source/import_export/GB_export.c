@@ -173,6 +173,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
     printf ("export A->x from memtable: %p\n", (*A)->x) ;   // MEMDUMP
     #endif
     GB_Global_memtable_remove ((*A)->x) ;
+    GB_memory_pool_forget ((*A)->x) ;
     (*Ax) = (*A)->x ; (*A)->x = NULL ;
     (*Ax_size) = (*A)->x_size ;
 
@@ -186,6 +187,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
             printf ("export A->h from memtable: %p\n", (*A)->h) ;   // MEMDUMP
             #endif
             GB_Global_memtable_remove ((*A)->h) ;
+            GB_memory_pool_forget ((*A)->h) ;
             (*Ah) = (GrB_Index *) ((*A)->h) ; (*A)->h = NULL ;
             (*Ah_size) = (*A)->h_size ;
             // fall through to the sparse case
@@ -207,6 +209,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
                 printf ("export A->p from memtable: %p\n", (*A)->p) ; // MEMDUMP
                 #endif
                 GB_Global_memtable_remove ((*A)->p) ;
+                GB_memory_pool_forget ((*A)->p) ;
                 (*Ap) = (GrB_Index *) ((*A)->p) ; (*A)->p = NULL ;
                 (*Ap_size) = (*A)->p_size ;
             }
@@ -216,6 +219,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
             printf ("export A->i from memtable: %p\n", (*A)->i) ;   // MEMDUMP
             #endif
             GB_Global_memtable_remove ((*A)->i) ;
+            GB_memory_pool_forget ((*A)->i) ;
             (*Ai) = (GrB_Index *) ((*A)->i) ; (*A)->i = NULL ;
             (*Ai_size) = (*A)->i_size ;
             break ;
@@ -228,6 +232,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
             printf ("export A->b from memtable: %p\n", (*A)->b) ;   // MEMDUMP
             #endif
             GB_Global_memtable_remove ((*A)->b) ;
+            GB_memory_pool_forget ((*A)->b) ;
             (*Ab) = (*A)->b ; (*A)->b = NULL ;
             (*Ab_size) = (*A)->b_size ;
 
@@ -323,6 +323,23 @@ GrB_Info GB_import      // import/pack a matrix in any format
         }
     }
 
+    //--------------------------------------------------------------------------
+    // do not keep the user's arrays in the memory pool
+    //--------------------------------------------------------------------------
+
+    if (add_to_memtable)
+    { 
+        // the arrays were allocated by the user application, not GraphBLAS
+        GB_memory_pool_import ((*A)->h, (*A)->h_size) ;
+        if (!is_sparse_vector)
+        { 
+            GB_memory_pool_import ((*A)->p, (*A)->p_size) ;
+        }
+        GB_memory_pool_import ((*A)->i, (*A)->i_size) ;
+        GB_memory_pool_import ((*A)->b, (*A)->b_size) ;
+        GB_memory_pool_import ((*A)->x, (*A)->x_size) ;
+    }
+
     //--------------------------------------------------------------------------
     // fast vs secure import
     //--------------------------------------------------------------------------
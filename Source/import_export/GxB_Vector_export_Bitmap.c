@@ -38,6 +38,7 @@ GrB_Info GxB_Vector_export_Bitmap   // export and free a bitmap vector
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_OK (GB_unshare ((GrB_Matrix) (*v), Werk)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
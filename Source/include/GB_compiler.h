@@ -229,6 +229,16 @@
 
 #endif
 
+//------------------------------------------------------------------------------
+// GB_PREFETCH: prefetch a cache line for reading and writing
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_GCC || GB_COMPILER_ICX || GB_COMPILER_ICC || GB_COMPILER_CLANG
+    #define GB_PREFETCH(p) __builtin_prefetch (p, 1)
+#else
+    #define GB_PREFETCH(p)
+#endif
+
 //------------------------------------------------------------------------------
 // determine the target architecture
 //------------------------------------------------------------------------------
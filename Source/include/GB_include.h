@@ -92,6 +92,7 @@
     #include "include/GB_assert_kernels.h"
     #include "include/GB_nthreads.h"
     #include "include/GB_log2.h"
+    #include "include/GB_intersect.h"
     #include "include/GB_wait_macros.h"
     #include "include/GB_AxB_macros.h"
     #include "include/GB_ek_slice_kernels.h"
@@ -136,6 +137,7 @@
     #include "ok/include/GB_assert_kernels.h"
     #include "omp/include/GB_nthreads.h"
     #include "math/include/GB_log2.h"
+    #include "math/include/GB_intersect.h"
     #include "wait/include/GB_wait_macros.h"
     #include "mxm/include/GB_AxB_macros.h"
     #include "slice/include/GB_ek_slice_kernels.h"
@@ -18,6 +18,7 @@
 GrB_Info GrB_finalize ( )
 { 
     GB_jitifyer_finalize ( ) ;
+    GB_memory_pool_finalize ( ) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -81,7 +81,9 @@
     #define GB_GETA(a,Ax,p,iso) a = Ax [p]
 
     // panel size for reduction:
+    #ifndef GB_PANEL
     #define GB_PANEL 32
+    #endif
 
     #include "include/GB_monoid_shared_definitions.h"
     #ifndef GB_JIT_RUNTIME
@@ -12,6 +12,35 @@
 
 typedef GB_JIT_KERNEL_REDUCE_PROTO ((*GB_jit_dl_function)) ;
 
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar_trial: run a reduce kernel, for tuning
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GB_void *z ;                // result, initialized by the trial
+    const GB_void *z_input ;    // input value of the result
+    size_t zsize ;              // size of the result
+    GrB_Matrix A ;              // matrix to reduce
+    GB_void *W ;                // workspace
+    bool *F ;                   // workspace
+    int ntasks ;                // # of tasks to use
+    int nthreads ;              // # of threads to use
+}
+GB_reduce_to_scalar_trial_args ;
+
+static GrB_Info GB_reduce_to_scalar_trial (void *dl_function, void *trial_args)
+{ 
+    GB_reduce_to_scalar_trial_args *args = trial_args ;
+    memcpy (args->z, args->z_input, args->zsize) ;
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (args->z, args->A, args->W, args->F, args->ntasks,
+        args->nthreads)) ;
+}
+
+// panel sizes to try, for GB_PANEL in GB_jit_kernel_reduce.c
+static const int GB_reduce_panel_sizes [5] = { 1, 8, 16, 32, 64 } ;
+
 GrB_Info GB_reduce_to_scalar_jit    // z = reduce_to_scalar (A) via the JIT
 (
     // output:
@@ -46,6 +75,24 @@ GrB_Info GB_reduce_to_scalar_jit    // z = reduce_to_scalar (A) via the JIT
         NULL, A->type, NULL, NULL) ;
     if (info != GrB_SUCCESS) return (info) ;
 
+    //--------------------------------------------------------------------------
+    // tune the panel size, if requested
+    //--------------------------------------------------------------------------
+
+    // The panel is only used if A is not bitmap and has no zombies.  It is
+    // held on the stack, so only small types are tuned.
+
+    size_t zsize = monoid->op->ztype->size ;
+    if (!GB_IS_BITMAP (A) && A->nzombies == 0 && zsize <= 16)
+    { 
+        GB_void z_trial [16] ;
+        GB_reduce_to_scalar_trial_args args =
+            { z_trial, z, zsize, A, W, F, ntasks, nthreads } ;
+        GB_jitifyer_tune_panel (&dl_function, GB_jit_reduce_family, "reduce",
+            hash, &encoding, suffix, NULL, monoid, NULL, "GB_PANEL",
+            GB_reduce_panel_sizes, 5, GB_reduce_to_scalar_trial, &args) ;
+    }
+
     //--------------------------------------------------------------------------
     // call the jit kernel and return result
     //--------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 #include "zstd_wrapper/GB_zstd.h"
 #include "JITpackage/GB_JITpackage.h"
 #include "jitifyer/GB_file.h"
+#include <ctype.h>
 
 typedef GB_JIT_KERNEL_USER_OP_PROTO ((*GB_user_op_f)) ;
 typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
@@ -39,8 +40,25 @@ static GB_jit_entry *GB_jit_table = NULL ;
 static int64_t  GB_jit_table_size = 0 ;  // always a power of 2
 static uint64_t GB_jit_table_bits = 0 ;  // hash mask (0xFFFF if size is 2^16)
 static int64_t  GB_jit_table_populated = 0 ;
+static int64_t  GB_jit_table_tombstones = 0 ;
 static size_t   GB_jit_table_allocated = 0 ;
 
+// Kernels already in the hash table can be found outside the critical section
+// (see GB_jitifyer_load), so an entry removed from the table is left as a
+// tombstone, which keeps the probe sequences of the entries after it intact.
+// Tombstones are not reused; they are dropped when the table is rehashed.
+// Each search outside the critical section is counted in GB_jit_nreaders.
+// The suffix of a removed entry, and a table replaced by a larger one, may
+// still be in use by those searches, so they are retired (see
+// GB_jitifyer_retire), and only freed once no search is in progress.  The
+// libraries of a removed entry are closed once the searches in progress have
+// finished, since the same library may be compiled and loaded again right
+// away.
+static int64_t  GB_jit_nreaders = 0 ;
+static void   **GB_jit_retired = NULL ;
+static int64_t  GB_jit_nretired = 0 ;
+static size_t   GB_jit_retired_allocated = 0 ;
+
 static bool GB_jit_use_cmake =
     #if defined (_MSC_VER)
     true ;      // MSVC requires cmake
@@ -48,6 +66,31 @@ static bool GB_jit_use_cmake =
     false ;     // otherwise, default is to skip cmake and compile directly
     #endif
 
+// If true, new CPU kernels are compiled in a background process, and the
+// generic method is used until the compiled kernel is ready.  Not used for
+// cmake (including MSVC), CUDA, or user-defined types and operators.
+static bool GB_jit_async = false ;
+
+// If true, the reduce-to-scalar kernels are compiled for several values of
+// their panel size, and the fastest one is kept (see GB_jitifyer_tune_panel).
+static bool GB_jit_tune_reduce_panel = false ;
+
+// A kernel compiled in the background has an entry in the hash table with no
+// kernel: its dl_function is GB_JIT_COMPILING until the compiler finishes, and
+// GB_JIT_COMPILE_FAILED if the compiler fails.  At most GB_JIT_PENDING_MAX
+// kernels are compiled in the background at the same time.
+// The dl_function of a removed entry is GB_JIT_TOMBSTONE.
+static char GB_jit_no_kernel [3] ;
+#define GB_JIT_COMPILING      ((void *) &(GB_jit_no_kernel [0]))
+#define GB_JIT_COMPILE_FAILED ((void *) &(GB_jit_no_kernel [1]))
+#define GB_JIT_TOMBSTONE      ((void *) &(GB_jit_no_kernel [2]))
+#define GB_JIT_HAS_KERNEL(dl_function)                                      \
+    ((dl_function) != NULL && (dl_function) != GB_JIT_COMPILING &&          \
+     (dl_function) != GB_JIT_COMPILE_FAILED &&                              \
+     (dl_function) != GB_JIT_TOMBSTONE)
+#define GB_JIT_PENDING_MAX 64
+static int GB_jit_npending = 0 ;    // # of entries that are GB_JIT_COMPILING
+
 // path to user cache folder:
 static char    *GB_jit_cache_path = NULL ;
 static size_t   GB_jit_cache_path_allocated = 0 ;
@@ -56,6 +99,10 @@ static size_t   GB_jit_cache_path_allocated = 0 ;
 static char    *GB_jit_error_log = NULL ;
 static size_t   GB_jit_error_log_allocated = 0 ;
 
+// record file: the name of each CPU JIT kernel loaded is appended to this file
+static char    *GB_jit_record_file = NULL ;
+static size_t   GB_jit_record_file_allocated = 0 ;
+
 // name of the C compiler:
 static char    *GB_jit_C_compiler = NULL ;
 static size_t   GB_jit_C_compiler_allocated = 0 ;
@@ -84,10 +131,18 @@ static size_t   GB_jit_C_preface_allocated = 0 ;
 static char    *GB_jit_CUDA_preface = NULL ;
 static size_t   GB_jit_CUDA_preface_allocated = 0 ;
 
+// folder for the compiled kernels, "lib/" and a fingerprint of the cpu
+// features, C compiler, and C flags (see GB_jitifyer_set_lib_folder):
+static char     GB_jit_lib_folder [32] = "lib" ;
+
 // temporary workspace for filenames and system commands:
 static char    *GB_jit_temp = NULL ;
 static size_t   GB_jit_temp_allocated = 0 ;
 
+// PreJIT kernels already considered for the hash table (registered or ignored)
+static bool    *GB_jit_prejit_done = NULL ;
+static size_t   GB_jit_prejit_done_allocated = 0 ;
+
 // compile with -DJITINIT=4 (for example) to set the initial JIT C control
 #ifdef JITINIT
 #define GB_JIT_C_CONTROL_INIT JITINIT
@@ -105,21 +160,24 @@ static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 #ifdef GB_DEBUG
 static void check_table (void)
 {
-    int64_t populated = 0 ;
+    int64_t populated = 0, tombstones = 0 ;
     if (GB_jit_table != NULL)
     {
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
             GB_jit_entry *e = &(GB_jit_table [k]) ;
-            if (e->dl_function != NULL)
+            if (e->dl_function == GB_JIT_TOMBSTONE)
+            {
+                tombstones++ ;
+            }
+            else if (e->dl_function != NULL)
             {
-                uint64_t hash = e->hash ;
-                uint64_t k2 = (hash & GB_jit_table_bits) ;
                 populated++ ;
             }
         }
     }
     ASSERT (populated == GB_jit_table_populated) ;
+    ASSERT (tombstones == GB_jit_table_tombstones) ;
 }
 #define ASSERT_TABLE_OK check_table ( ) ;
 #else
@@ -203,6 +261,122 @@ static void check_table (void)
     strncpy (X, src, X ## _allocated) ;                 \
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_reader_begin/end: count a search outside the critical section
+//------------------------------------------------------------------------------
+
+static inline void GB_jitifyer_reader_begin (void)
+{ 
+    GB_ATOMIC_UPDATE
+    GB_jit_nreaders++ ;
+    #pragma omp flush
+}
+
+static inline void GB_jitifyer_reader_end (void)
+{ 
+    #pragma omp flush
+    GB_ATOMIC_UPDATE
+    GB_jit_nreaders-- ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_wait_for_readers: wait for searches in progress to finish
+//------------------------------------------------------------------------------
+
+// Searches outside the critical section are short (a single hash table probe
+// sequence), so this wait is brief.
+
+static void GB_jitifyer_wait_for_readers (void)
+{
+    int64_t nreaders ;
+    do
+    { 
+        #pragma omp flush
+        GB_ATOMIC_READ
+        nreaders = GB_jit_nreaders ;
+    }
+    while (nreaders > 0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_reclaim: free the retired items if no search is in progress
+//------------------------------------------------------------------------------
+
+// Items are retired inside the critical section, after they are removed from
+// the hash table, so a search that starts later cannot find them.  They can
+// be freed once no search is in progress.  If wait is true, this method waits
+// for the searches in progress to finish.
+
+static void GB_jitifyer_reclaim (bool wait)
+{
+
+    if (wait)
+    { 
+        GB_jitifyer_wait_for_readers ( ) ;
+    }
+    else
+    {
+        int64_t nreaders ;
+        #pragma omp flush
+        GB_ATOMIC_READ
+        nreaders = GB_jit_nreaders ;
+        if (nreaders > 0)
+        { 
+            // a search is in progress; try again later
+            return ;
+        }
+    }
+
+    for (int64_t k = 0 ; k < GB_jit_nretired ; k++)
+    { 
+        GB_FREE_PERSISTENT (GB_jit_retired [k]) ;
+    }
+    GB_jit_nretired = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_retire: free a table or suffix once no search is in progress
+//------------------------------------------------------------------------------
+
+// p is no longer reachable from the hash table.
+
+static void GB_jitifyer_retire (void *p)
+{
+
+    if (p == NULL)
+    { 
+        return ;
+    }
+
+    size_t nmax = GB_jit_retired_allocated / sizeof (void *) ;
+    if (GB_jit_nretired == nmax)
+    {
+        // double the size of the list of retired items
+        size_t siz = GB_IMAX (2 * nmax, 64) * sizeof (void *) ;
+        void **new_retired ;
+        GB_MALLOC_PERSISTENT (new_retired, siz) ;
+        if (new_retired == NULL)
+        { 
+            // out of memory: wait for the searches in progress to finish,
+            // and free the item now
+            GB_jitifyer_wait_for_readers ( ) ;
+            GB_FREE_PERSISTENT (p) ;
+            return ;
+        }
+        if (GB_jit_nretired > 0)
+        { 
+            memcpy (new_retired, GB_jit_retired,
+                GB_jit_nretired * sizeof (void *)) ;
+        }
+        GB_FREE_PERSISTENT (GB_jit_retired) ;
+        GB_jit_retired = new_retired ;
+        GB_jit_retired_allocated = siz ;
+    }
+
+    GB_jit_retired [GB_jit_nretired++] = p ;
+    GB_jitifyer_reclaim (false) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_finalize: free the JIT table and all the strings
 //------------------------------------------------------------------------------
@@ -210,8 +384,11 @@ static void check_table (void)
 void GB_jitifyer_finalize (void)
 { 
     GB_jitifyer_table_free (true) ;
+    GB_jitifyer_reclaim (true) ;
+    GB_FREE_STUFF (GB_jit_retired) ;
     GB_FREE_STUFF (GB_jit_cache_path) ;
     GB_FREE_STUFF (GB_jit_error_log) ;
+    GB_FREE_STUFF (GB_jit_record_file) ;
     GB_FREE_STUFF (GB_jit_C_compiler) ;
     GB_FREE_STUFF (GB_jit_C_flags) ;
     GB_FREE_STUFF (GB_jit_C_link_flags) ;
@@ -220,6 +397,7 @@ void GB_jitifyer_finalize (void)
     GB_FREE_STUFF (GB_jit_C_preface) ;
     GB_FREE_STUFF (GB_jit_CUDA_preface) ;
     GB_FREE_STUFF (GB_jit_temp) ;
+    GB_FREE_STUFF (GB_jit_prejit_done) ;
 }
 
 //------------------------------------------------------------------------------
@@ -270,6 +448,287 @@ void GB_jitifyer_sanitize (char *string, size_t len)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_insert: insert a PreJIT kernel into the hash table
+//------------------------------------------------------------------------------
+
+// Returns GrB_SUCCESS if the kernel is inserted as an unchecked PreJIT kernel,
+// GrB_NO_VALUE if the kernel is invalid, stale, or a duplicate (and thus
+// ignored), or GrB_OUT_OF_MEMORY.  Must be called in the critical section (or
+// in GrB_init).
+
+static GrB_Info GB_jitifyer_prejit_insert
+(
+    int k,                  // index of the PreJIT kernel
+    void **Kernels,
+    void **Queries,
+    char **Names
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the name and function pointer of the PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    void *dl_function = Kernels [k] ;
+    GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
+    ASSERT (dl_function != NULL && dl_query != NULL && Names [k] != NULL) ;
+    char kernel_name [GB_KLEN+1] ;
+    strncpy (kernel_name, Names [k], GB_KLEN) ;
+    kernel_name [GB_KLEN] = '\0' ;
+
+    //--------------------------------------------------------------------------
+    // parse the kernel name
+    //--------------------------------------------------------------------------
+
+    char *name_space = NULL ;
+    char *kname = NULL ;
+    uint64_t method_code = 0 ;
+    char *suffix = NULL ;
+    GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
+        &method_code, &suffix) ;
+
+    if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
+    {
+        // PreJIT error: kernel_name is invalid; ignore this kernel
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the kcode of the kname
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding_struct ;
+    GB_jit_encoding *encoding = &encoding_struct ;
+    memset (encoding, 0, sizeof (GB_jit_encoding)) ;
+
+    #define IS(kernel) GB_STRING_MATCH (kname, kernel)
+
+    GB_jit_kcode c = 0 ;
+    if      (IS ("add"          )) c = GB_JIT_KERNEL_ADD ;
+    else if (IS ("apply_bind1st")) c = GB_JIT_KERNEL_APPLYBIND1 ;
+    else if (IS ("apply_bind2nd")) c = GB_JIT_KERNEL_APPLYBIND2 ;
+    else if (IS ("apply_unop"   )) c = GB_JIT_KERNEL_APPLYUNOP ;
+    else if (IS ("AxB_dot2"     )) c = GB_JIT_KERNEL_AXB_DOT2 ;
+    else if (IS ("AxB_dot2n"    )) c = GB_JIT_KERNEL_AXB_DOT2N ;
+    else if (IS ("AxB_dot3"     )) c = GB_JIT_KERNEL_AXB_DOT3 ;
+    else if (IS ("AxB_dot4"     )) c = GB_JIT_KERNEL_AXB_DOT4 ;
+    else if (IS ("AxB_saxbit"   )) c = GB_JIT_KERNEL_AXB_SAXBIT ;
+    else if (IS ("AxB_saxpy3"   )) c = GB_JIT_KERNEL_AXB_SAXPY3 ;
+    else if (IS ("AxB_saxpy4"   )) c = GB_JIT_KERNEL_AXB_SAXPY4 ;
+    else if (IS ("AxB_saxpy5"   )) c = GB_JIT_KERNEL_AXB_SAXPY5 ;
+    else if (IS ("build"        )) c = GB_JIT_KERNEL_BUILD ;
+    else if (IS ("colscale"     )) c = GB_JIT_KERNEL_COLSCALE ;
+    else if (IS ("concat_bitmap")) c = GB_JIT_KERNEL_CONCAT_BITMAP ;
+    else if (IS ("concat_full"  )) c = GB_JIT_KERNEL_CONCAT_FULL ;
+    else if (IS ("concat_sparse")) c = GB_JIT_KERNEL_CONCAT_SPARSE ;
+    else if (IS ("convert_s2b"  )) c = GB_JIT_KERNEL_CONVERT_S2B ;
+    else if (IS ("emult_02"     )) c = GB_JIT_KERNEL_EMULT2 ;
+    else if (IS ("emult_03"     )) c = GB_JIT_KERNEL_EMULT3 ;
+    else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
+    else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
+    else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
+    else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
+    else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
+    else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
+    else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
+    else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
+    else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
+    else if (IS ("select_phase2")) c = GB_JIT_KERNEL_SELECT2 ;
+    else if (IS ("split_bitmap" )) c = GB_JIT_KERNEL_SPLIT_BITMAP ;
+    else if (IS ("split_full"   )) c = GB_JIT_KERNEL_SPLIT_FULL ;
+    else if (IS ("split_sparse" )) c = GB_JIT_KERNEL_SPLIT_SPARSE ;
+
+    else if (IS ("subassign_05d")) c = GB_JIT_KERNEL_SUBASSIGN_05d ;
+    else if (IS ("subassign_06d")) c = GB_JIT_KERNEL_SUBASSIGN_06d ;
+    else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
+    else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
+    else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
+
+    else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
+    else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
+    else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
+    else if (IS ("union"        )) c = GB_JIT_KERNEL_UNION ;
+    else if (IS ("user_op"      )) c = GB_JIT_KERNEL_USEROP ;
+    else if (IS ("user_type"    )) c = GB_JIT_KERNEL_USERTYPE ;
+
+    // added for v9.4.1:
+    else if (IS ("subassign_01" )) c = GB_JIT_KERNEL_SUBASSIGN_01 ;
+    else if (IS ("subassign_02" )) c = GB_JIT_KERNEL_SUBASSIGN_02 ;
+    else if (IS ("subassign_03" )) c = GB_JIT_KERNEL_SUBASSIGN_03 ;
+    else if (IS ("subassign_04" )) c = GB_JIT_KERNEL_SUBASSIGN_04 ;
+    else if (IS ("subassign_05" )) c = GB_JIT_KERNEL_SUBASSIGN_05 ;
+    else if (IS ("subassign_06n")) c = GB_JIT_KERNEL_SUBASSIGN_06n ;
+    else if (IS ("subassign_06s")) c = GB_JIT_KERNEL_SUBASSIGN_06s ;
+    else if (IS ("subassign_07" )) c = GB_JIT_KERNEL_SUBASSIGN_07 ;
+    else if (IS ("subassign_08n")) c = GB_JIT_KERNEL_SUBASSIGN_08n ;
+    else if (IS ("subassign_08s")) c = GB_JIT_KERNEL_SUBASSIGN_08s ;
+    else if (IS ("subassign_09" )) c = GB_JIT_KERNEL_SUBASSIGN_09 ;
+    else if (IS ("subassign_10" )) c = GB_JIT_KERNEL_SUBASSIGN_10 ;
+    else if (IS ("subassign_11" )) c = GB_JIT_KERNEL_SUBASSIGN_11 ;
+    else if (IS ("subassign_12" )) c = GB_JIT_KERNEL_SUBASSIGN_12 ;
+    else if (IS ("subassign_13" )) c = GB_JIT_KERNEL_SUBASSIGN_13 ;
+    else if (IS ("subassign_15" )) c = GB_JIT_KERNEL_SUBASSIGN_15 ;
+    else if (IS ("subassign_17" )) c = GB_JIT_KERNEL_SUBASSIGN_17 ;
+    else if (IS ("subassign_19" )) c = GB_JIT_KERNEL_SUBASSIGN_19 ;
+
+    else if (IS ("bitmap_assign_1"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_1 ;
+    else if (IS ("bitmap_assign_1_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_1_WHOLE ;
+    else if (IS ("bitmap_assign_2"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_2 ;
+    else if (IS ("bitmap_assign_2_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_2_WHOLE ;
+    else if (IS ("bitmap_assign_3"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_3 ;
+    else if (IS ("bitmap_assign_3_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_3_WHOLE ;
+    else if (IS ("bitmap_assign_4"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_4 ;
+    else if (IS ("bitmap_assign_4_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_4_WHOLE ;
+    else if (IS ("bitmap_assign_5"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_5 ;
+    else if (IS ("bitmap_assign_5_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_5_WHOLE ;
+    else if (IS ("bitmap_assign_6"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_6 ;
+    else if (IS ("bitmap_assign_6b_whole")) c = GB_JIT_KERNEL_BITMAP_ASSIGN_6b_WHOLE ;
+    else if (IS ("bitmap_assign_7"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_7 ;
+    else if (IS ("bitmap_assign_7_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_7_WHOLE ;
+    else if (IS ("bitmap_assign_8"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_8 ;
+    else if (IS ("bitmap_assign_8_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_8_WHOLE  ;
+
+    else if (IS ("masker_phase1")) c = GB_JIT_KERNEL_MASKER_PHASE1 ;
+    else if (IS ("masker_phase2")) c = GB_JIT_KERNEL_MASKER_PHASE2 ;
+
+    else if (IS ("subref_sparse")) c = GB_JIT_KERNEL_SUBREF_SPARSE ;
+    else if (IS ("subref_bitmap")) c = GB_JIT_KERNEL_BITMAP_SUBREF ;
+
+    else if (IS ("iso_expand"   )) c = GB_JIT_KERNEL_ISO_EXPAND ;
+    else if (IS ("unjumble"     )) c = GB_JIT_KERNEL_UNJUMBLE ;
+    else if (IS ("convert_b2s"  )) c = GB_JIT_KERNEL_CONVERT_B2S ;
+    else if (IS ("kroner"       )) c = GB_JIT_KERNEL_KRONER ;
+    else if (IS ("sort"         )) c = GB_JIT_KERNEL_SORT ;
+
+    // add CUDA PreJIT kernels here (future):
+//      else if (IS ("cuda_reduce"  )) c = GB_JIT_CUDA_KERNEL_REDUCE ;
+    else
+    {
+        // PreJIT error: kernel_name is invalid; ignore this kernel
+        return (GrB_NO_VALUE) ;
+    }
+
+    #undef IS
+    encoding->kcode = c ;
+    encoding->code = method_code ;
+    encoding->suffix_len = (int32_t) GB_STRLEN (suffix) ;
+
+    //--------------------------------------------------------------------------
+    // get the hash of this PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    // Query the kernel for its hash and version number.  The hash is needed
+    // now so the PreJIT kernel can be added to the hash table.
+
+    // The type/op definitions and monoid id/term values for user-defined
+    // types/ops/ monoids are ignored, because the user-defined objects may not
+    // yet have been created.  These definitions are checked the first time
+    // the kernel is run.
+
+    uint64_t hash = 0 ;
+    const char *ignored [5] ;
+    int version [3] ;
+    (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
+
+    if (hash == 0 || hash == UINT64_MAX ||
+        (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
+        (version [1] != GxB_IMPLEMENTATION_MINOR) ||
+        (version [2] != GxB_IMPLEMENTATION_SUB))
+    {
+        // PreJIT error: the kernel is stale; ignore it
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make sure this kernel is not a duplicate
+    //--------------------------------------------------------------------------
+
+    int64_t k1 = -1, kk = -1 ;
+    if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
+    {
+        // PreJIT error: the kernel is a duplicate; ignore it
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the PreJIT kernel in the hash table
+    //--------------------------------------------------------------------------
+
+    if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function, k))
+    { 
+        // PreJIT error: out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_find: find the first PreJIT kernel with a given hash
+//------------------------------------------------------------------------------
+
+// The PreJIT kernels are sorted by their hash at build time, so the kernel is
+// found by binary search.  Returns the index of the first PreJIT kernel with
+// the given hash, or -1 if there is none.  This method only accesses the
+// static tables of PreJIT kernels, so it does not need a critical section.
+
+static int64_t GB_jitifyer_prejit_find (uint64_t hash)
+{ 
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    uint64_t *Hashes = NULL ;
+    int32_t nkernels = 0 ;
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names, &Hashes) ;
+    if (nkernels == 0)
+    { 
+        return (-1) ;
+    }
+    int64_t pleft = 0, pright = nkernels - 1 ;
+    GB_TRIM_BINARY_SEARCH (hash, Hashes, pleft, pright) ;
+    return ((pleft == pright && Hashes [pleft] == hash) ? pleft : -1) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_register: register the PreJIT kernels with a given hash
+//------------------------------------------------------------------------------
+
+// Each PreJIT kernel is inserted into the hash table the first time a kernel
+// with its hash is needed, as an unchecked PreJIT kernel.  It is checked when
+// it is first used, just as if it had been registered by GrB_init.  A kernel
+// that is ignored (invalid, stale, or duplicate) is not considered again.
+// Returns GrB_SUCCESS or GrB_OUT_OF_MEMORY.  Must be called in the critical
+// section.
+
+static GrB_Info GB_jitifyer_prejit_register (uint64_t hash)
+{
+    int64_t k = GB_jitifyer_prejit_find (hash) ;
+    if (k < 0 || GB_jit_prejit_done == NULL)
+    { 
+        // no PreJIT kernel has this hash
+        return (GrB_SUCCESS) ;
+    }
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    uint64_t *Hashes = NULL ;
+    int32_t nkernels = 0 ;
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names, &Hashes) ;
+    for ( ; k < nkernels && Hashes [k] == hash ; k++)
+    {
+        if (!GB_jit_prejit_done [k])
+        { 
+            GB_jit_prejit_done [k] = true ;
+            if (GB_jitifyer_prejit_insert (k, Kernels, Queries, Names) ==
+                GrB_OUT_OF_MEMORY)
+            { 
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_init: initialize the JIT folders, flags, etc
 //------------------------------------------------------------------------------
@@ -358,6 +817,7 @@ GrB_Info GB_jitifyer_init (void)
     //--------------------------------------------------------------------------
 
     GB_COPY_STUFF (GB_jit_error_log,    "") ;
+    GB_COPY_STUFF (GB_jit_record_file,  "") ;
     GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
     GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
     GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
@@ -367,12 +827,6 @@ GrB_Info GB_jitifyer_init (void)
     GB_COPY_STUFF (GB_jit_CUDA_preface, "") ;
     OK (GB_jitifyer_alloc_space ( )) ;
 
-    //--------------------------------------------------------------------------
-    // establish the cache path and src path, and make sure they exist
-    //--------------------------------------------------------------------------
-
-    OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
-
     //--------------------------------------------------------------------------
     // remove "-arch arm64" if compiling JIT kernels for MATLAB
     //--------------------------------------------------------------------------
@@ -400,210 +854,39 @@ GrB_Info GB_jitifyer_init (void)
     #endif
 
     //--------------------------------------------------------------------------
-    // hash all PreJIT kernels
+    // establish the cache path and src path, and make sure they exist
+    //--------------------------------------------------------------------------
+
+    OK (GB_jitifyer_establish_paths (GrB_SUCCESS)) ;
+
+    //--------------------------------------------------------------------------
+    // prepare the PreJIT kernels
     //--------------------------------------------------------------------------
 
+    // PreJIT kernels are registered in the hash table the first time they are
+    // needed (see GB_jitifyer_prejit_register), except for any kernel whose
+    // hash is not known at build time.
+
     void **Kernels = NULL ;
     void **Queries = NULL ;
     char **Names = NULL ;
+    uint64_t *Hashes = NULL ;
     int32_t nkernels = 0 ;
-    GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
-
-    for (int k = 0 ; k < nkernels ; k++)
-    {
-
-        //----------------------------------------------------------------------
-        // get the name and function pointer of the PreJIT kernel
-        //----------------------------------------------------------------------
-
-        void *dl_function = Kernels [k] ;
-        GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
-        ASSERT (dl_function != NULL && dl_query != NULL && Names [k] != NULL) ;
-        char kernel_name [GB_KLEN+1] ;
-        strncpy (kernel_name, Names [k], GB_KLEN) ;
-        kernel_name [GB_KLEN] = '\0' ;
-
-        //----------------------------------------------------------------------
-        // parse the kernel name
-        //----------------------------------------------------------------------
-
-        char *name_space = NULL ;
-        char *kname = NULL ;
-        uint64_t method_code = 0 ;
-        char *suffix = NULL ;
-        GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
-            &method_code, &suffix) ;
-
-        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // find the kcode of the kname
-        //----------------------------------------------------------------------
-
-        GB_jit_encoding encoding_struct ;
-        GB_jit_encoding *encoding = &encoding_struct ;
-        memset (encoding, 0, sizeof (GB_jit_encoding)) ;
-
-        #define IS(kernel) GB_STRING_MATCH (kname, kernel)
-
-        GB_jit_kcode c = 0 ;
-        if      (IS ("add"          )) c = GB_JIT_KERNEL_ADD ;
-        else if (IS ("apply_bind1st")) c = GB_JIT_KERNEL_APPLYBIND1 ;
-        else if (IS ("apply_bind2nd")) c = GB_JIT_KERNEL_APPLYBIND2 ;
-        else if (IS ("apply_unop"   )) c = GB_JIT_KERNEL_APPLYUNOP ;
-        else if (IS ("AxB_dot2"     )) c = GB_JIT_KERNEL_AXB_DOT2 ;
-        else if (IS ("AxB_dot2n"    )) c = GB_JIT_KERNEL_AXB_DOT2N ;
-        else if (IS ("AxB_dot3"     )) c = GB_JIT_KERNEL_AXB_DOT3 ;
-        else if (IS ("AxB_dot4"     )) c = GB_JIT_KERNEL_AXB_DOT4 ;
-        else if (IS ("AxB_saxbit"   )) c = GB_JIT_KERNEL_AXB_SAXBIT ;
-        else if (IS ("AxB_saxpy3"   )) c = GB_JIT_KERNEL_AXB_SAXPY3 ;
-        else if (IS ("AxB_saxpy4"   )) c = GB_JIT_KERNEL_AXB_SAXPY4 ;
-        else if (IS ("AxB_saxpy5"   )) c = GB_JIT_KERNEL_AXB_SAXPY5 ;
-        else if (IS ("build"        )) c = GB_JIT_KERNEL_BUILD ;
-        else if (IS ("colscale"     )) c = GB_JIT_KERNEL_COLSCALE ;
-        else if (IS ("concat_bitmap")) c = GB_JIT_KERNEL_CONCAT_BITMAP ;
-        else if (IS ("concat_full"  )) c = GB_JIT_KERNEL_CONCAT_FULL ;
-        else if (IS ("concat_sparse")) c = GB_JIT_KERNEL_CONCAT_SPARSE ;
-        else if (IS ("convert_s2b"  )) c = GB_JIT_KERNEL_CONVERT_S2B ;
-        else if (IS ("emult_02"     )) c = GB_JIT_KERNEL_EMULT2 ;
-        else if (IS ("emult_03"     )) c = GB_JIT_KERNEL_EMULT3 ;
-        else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
-        else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
-        else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
-        else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
-        else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
-        else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
-        else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
-        else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
-        else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
-        else if (IS ("select_phase2")) c = GB_JIT_KERNEL_SELECT2 ;
-        else if (IS ("split_bitmap" )) c = GB_JIT_KERNEL_SPLIT_BITMAP ;
-        else if (IS ("split_full"   )) c = GB_JIT_KERNEL_SPLIT_FULL ;
-        else if (IS ("split_sparse" )) c = GB_JIT_KERNEL_SPLIT_SPARSE ;
-
-        else if (IS ("subassign_05d")) c = GB_JIT_KERNEL_SUBASSIGN_05d ;
-        else if (IS ("subassign_06d")) c = GB_JIT_KERNEL_SUBASSIGN_06d ;
-        else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
-        else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
-        else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
-
-        else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
-        else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
-        else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
-        else if (IS ("union"        )) c = GB_JIT_KERNEL_UNION ;
-        else if (IS ("user_op"      )) c = GB_JIT_KERNEL_USEROP ;
-        else if (IS ("user_type"    )) c = GB_JIT_KERNEL_USERTYPE ;
-
-        // added for v9.4.1:
-        else if (IS ("subassign_01" )) c = GB_JIT_KERNEL_SUBASSIGN_01 ;
-        else if (IS ("subassign_02" )) c = GB_JIT_KERNEL_SUBASSIGN_02 ;
-        else if (IS ("subassign_03" )) c = GB_JIT_KERNEL_SUBASSIGN_03 ;
-        else if (IS ("subassign_04" )) c = GB_JIT_KERNEL_SUBASSIGN_04 ;
-        else if (IS ("subassign_05" )) c = GB_JIT_KERNEL_SUBASSIGN_05 ;
-        else if (IS ("subassign_06n")) c = GB_JIT_KERNEL_SUBASSIGN_06n ;
-        else if (IS ("subassign_06s")) c = GB_JIT_KERNEL_SUBASSIGN_06s ;
-        else if (IS ("subassign_07" )) c = GB_JIT_KERNEL_SUBASSIGN_07 ;
-        else if (IS ("subassign_08n")) c = GB_JIT_KERNEL_SUBASSIGN_08n ;
-        else if (IS ("subassign_08s")) c = GB_JIT_KERNEL_SUBASSIGN_08s ;
-        else if (IS ("subassign_09" )) c = GB_JIT_KERNEL_SUBASSIGN_09 ;
-        else if (IS ("subassign_10" )) c = GB_JIT_KERNEL_SUBASSIGN_10 ;
-        else if (IS ("subassign_11" )) c = GB_JIT_KERNEL_SUBASSIGN_11 ;
-        else if (IS ("subassign_12" )) c = GB_JIT_KERNEL_SUBASSIGN_12 ;
-        else if (IS ("subassign_13" )) c = GB_JIT_KERNEL_SUBASSIGN_13 ;
-        else if (IS ("subassign_15" )) c = GB_JIT_KERNEL_SUBASSIGN_15 ;
-        else if (IS ("subassign_17" )) c = GB_JIT_KERNEL_SUBASSIGN_17 ;
-        else if (IS ("subassign_19" )) c = GB_JIT_KERNEL_SUBASSIGN_19 ;
-
-        else if (IS ("bitmap_assign_1"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_1 ;
-        else if (IS ("bitmap_assign_1_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_1_WHOLE ;
-        else if (IS ("bitmap_assign_2"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_2 ;
-        else if (IS ("bitmap_assign_2_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_2_WHOLE ;
-        else if (IS ("bitmap_assign_3"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_3 ;
-        else if (IS ("bitmap_assign_3_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_3_WHOLE ;
-        else if (IS ("bitmap_assign_4"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_4 ;
-        else if (IS ("bitmap_assign_4_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_4_WHOLE ;
-        else if (IS ("bitmap_assign_5"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_5 ;
-        else if (IS ("bitmap_assign_5_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_5_WHOLE ;
-        else if (IS ("bitmap_assign_6"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_6 ;
-        else if (IS ("bitmap_assign_6b_whole")) c = GB_JIT_KERNEL_BITMAP_ASSIGN_6b_WHOLE ;
-        else if (IS ("bitmap_assign_7"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_7 ;
-        else if (IS ("bitmap_assign_7_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_7_WHOLE ;
-        else if (IS ("bitmap_assign_8"       )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_8 ;
-        else if (IS ("bitmap_assign_8_whole" )) c = GB_JIT_KERNEL_BITMAP_ASSIGN_8_WHOLE  ;
-
-        else if (IS ("masker_phase1")) c = GB_JIT_KERNEL_MASKER_PHASE1 ;
-        else if (IS ("masker_phase2")) c = GB_JIT_KERNEL_MASKER_PHASE2 ;
-
-        else if (IS ("subref_sparse")) c = GB_JIT_KERNEL_SUBREF_SPARSE ;
-        else if (IS ("subref_bitmap")) c = GB_JIT_KERNEL_BITMAP_SUBREF ;
-
-        else if (IS ("iso_expand"   )) c = GB_JIT_KERNEL_ISO_EXPAND ;
-        else if (IS ("unjumble"     )) c = GB_JIT_KERNEL_UNJUMBLE ;
-        else if (IS ("convert_b2s"  )) c = GB_JIT_KERNEL_CONVERT_B2S ;
-        else if (IS ("kroner"       )) c = GB_JIT_KERNEL_KRONER ;
-        else if (IS ("sort"         )) c = GB_JIT_KERNEL_SORT ;
-
-        // add CUDA PreJIT kernels here (future):
-//      else if (IS ("cuda_reduce"  )) c = GB_JIT_CUDA_KERNEL_REDUCE ;
-        else
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
-
-        #undef IS
-        encoding->kcode = c ;
-        encoding->code = method_code ;
-        encoding->suffix_len = (int32_t) GB_STRLEN (suffix) ;
-
-        //----------------------------------------------------------------------
-        // get the hash of this PreJIT kernel
-        //----------------------------------------------------------------------
-
-        // Query the kernel for its hash and version number.  The hash is
-        // needed now so the PreJIT kernel can be added to the hash table.
-
-        // The type/op definitions and monoid id/term values for user-defined
-        // types/ops/ monoids are ignored, because the user-defined objects
-        // have not yet been created during this use of GraphBLAS (this method
-        // is called by GrB_init).  These definitions are checked the first
-        // time the kernel is run.
-
-        uint64_t hash = 0 ;
-        const char *ignored [5] ;
-        int version [3] ;
-        (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
-
-        if (hash == 0 || hash == UINT64_MAX ||
-            (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
-            (version [1] != GxB_IMPLEMENTATION_MINOR) ||
-            (version [2] != GxB_IMPLEMENTATION_SUB))
-        {
-            // PreJIT error: the kernel is stale; ignore it
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // make sure this kernel is not a duplicate
-        //----------------------------------------------------------------------
-
-        int64_t k1 = -1, kk = -1 ;
-        if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
-        {
-            // PreJIT error: the kernel is a duplicate; ignore it
-            continue ;
-        }
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names, &Hashes) ;
 
-        //----------------------------------------------------------------------
-        // insert the PreJIT kernel in the hash table
-        //----------------------------------------------------------------------
+    if (nkernels > 0)
+    { 
+        GB_MALLOC_STUFF (GB_jit_prejit_done, nkernels) ;
+        memset (GB_jit_prejit_done, 0, nkernels * sizeof (bool)) ;
+    }
 
-        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function, k))
-        {
+    for (int k = 0 ; k < nkernels && Hashes [k] == 0 ; k++)
+    { 
+        // register a PreJIT kernel with an unknown hash now
+        GB_jit_prejit_done [k] = true ;
+        if (GB_jitifyer_prejit_insert (k, Kernels, Queries, Names) ==
+            GrB_OUT_OF_MEMORY)
+        { 
             // PreJIT error: out of memory
             GB_jit_control = GxB_JIT_PAUSE ;
             return (GrB_OUT_OF_MEMORY) ;
@@ -635,6 +918,57 @@ bool GB_jitifyer_path_256 (char *folder)
     return (ok) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_lib_folder: determine the folder for the compiled kernels
+//------------------------------------------------------------------------------
+
+// Compiled kernels are placed in [cache_path]/lib/[fingerprint]/[bucket],
+// where the fingerprint is a hash of the instruction set extensions of this
+// machine (all the words of GB_Global_cpu_features_isa), the C compiler, and
+// the C flags.  A cache path on a shared file system can then be used by
+// machines with different cpus (with and without AVX512F, for example), even
+// if the kernels are compiled with -march=native.  Each class of machine
+// compiles its own kernels, and never loads a kernel compiled for another.
+// The kernel sources in [cache_path]/c are shared by all machines.
+
+static void GB_jitifyer_set_lib_folder (void)
+{ 
+    int nwords ;
+    const uint64_t *isa = GB_Global_cpu_features_isa (&nwords) ;
+    size_t len = 0 ;
+    for (int w = 0 ; w < nwords && len < GB_jit_temp_allocated ; w++)
+    { 
+        len += snprintf (GB_jit_temp + len, GB_jit_temp_allocated - len,
+            "%016" PRIx64 "\n", isa [w]) ;
+    }
+    if (len < GB_jit_temp_allocated)
+    { 
+        snprintf (GB_jit_temp + len, GB_jit_temp_allocated - len, "%s\n%s",
+            GB_jit_C_compiler, GB_jit_C_flags) ;
+    }
+    uint64_t fingerprint = GB_jitifyer_hash (GB_jit_temp,
+        strlen (GB_jit_temp), true) ;
+    snprintf (GB_jit_lib_folder, sizeof (GB_jit_lib_folder),
+        "lib/%016" PRIx64, fingerprint) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_establish_lib_folder: make sure the lib folder exists
+//------------------------------------------------------------------------------
+
+// Called when the C compiler or C flags change, which may change the lib
+// folder.  If the folder cannot be created, kernels will fail to compile, and
+// the generic kernels are used instead.
+
+static void GB_jitifyer_establish_lib_folder (void)
+{
+    GB_jitifyer_set_lib_folder ( ) ;
+    if (GB_STRLEN (GB_jit_cache_path) > 0)
+    { 
+        GB_jitifyer_path_256 (GB_jit_lib_folder) ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_establish_paths: make sure cache and its folders exist
 //------------------------------------------------------------------------------
@@ -657,8 +991,9 @@ GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition)
     bool ok = GB_file_mkdir (GB_jit_cache_path) ;
 
     // construct the c, lib, and lock paths and their 256 subfolders
+    GB_jitifyer_set_lib_folder ( ) ;
     ok = ok && GB_jitifyer_path_256 ("c") ;
-    ok = ok && GB_jitifyer_path_256 ("lib") ;
+    ok = ok && GB_jitifyer_path_256 (GB_jit_lib_folder) ;
     ok = ok && GB_jitifyer_path_256 ("lock") ;
 
     // construct the src path and its subfolders
@@ -912,10 +1247,11 @@ GrB_Info GB_jitifyer_alloc_space (void)
         2 * GB_jit_C_flags_allocated +
         GB_jit_C_link_flags_allocated +
         strlen (GB_OMP_INC) +
-        5 * GB_jit_cache_path_allocated + 7 * GB_KLEN +
+        8 * GB_jit_cache_path_allocated + 10 * GB_KLEN +
         GB_jit_C_libraries_allocated +
         GB_jit_C_cmake_libs_allocated +
         GB_jit_error_log_allocated +
+        4 * sizeof (GB_jit_lib_folder) +
         300 ;
     GB_MALLOC_STUFF (GB_jit_temp, len) ;
 
@@ -1042,28 +1378,132 @@ GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log)
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_get_C_compiler: return the current C compiler
+// GB_jitifyer_get_record_file: return the current record file
 //------------------------------------------------------------------------------
 
-const char *GB_jitifyer_get_C_compiler (void)
+const char *GB_jitifyer_get_record_file (void)
 { 
     const char *s ;
     #pragma omp critical (GB_jitifyer_worker)
     {
-        s = GB_jit_C_compiler ;
+        s = GB_jit_record_file ;
     }
     return (s) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_set_C_compiler: set a new C compiler
+// GB_jitifyer_copy_record_file: return a copy of the current record file
 //------------------------------------------------------------------------------
 
-GrB_Info GB_jitifyer_set_C_compiler (const char *new_C_compiler)
+// The copy is made in the critical section, so it remains valid if another
+// user thread sets a new record file.  The caller must free it with
+// GB_FREE_WORK.
+
+GrB_Info GB_jitifyer_copy_record_file
+(
+    char **record_file,         // copy of the record file
+    size_t *record_file_size    // size of the copy
+)
 { 
+    GrB_Info info = GrB_SUCCESS ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        size_t len = GB_STRLEN (GB_jit_record_file) ;
+        (*record_file) = GB_MALLOC_WORK (len + 1, char, record_file_size) ;
+        if ((*record_file) == NULL)
+        { 
+            info = GrB_OUT_OF_MEMORY ;
+        }
+        else
+        { 
+            memcpy (*record_file, (len == 0) ? "" : GB_jit_record_file, len) ;
+            (*record_file) [len] = '\0' ;
+        }
+    }
+    return (info) ;
+}
 
-    //--------------------------------------------------------------------------
-    // check inputs
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_record_file: set a new record file
+//------------------------------------------------------------------------------
+
+// If the new_record_file is NULL or the empty string, JIT kernels are not
+// recorded.  Otherwise, the name of each CPU JIT kernel loaded from the cache
+// folder is appended to this file, one per line, when it is first loaded by
+// this process.  The file can be passed to GxB_JIT_warmup or GxB_JIT_export
+// as a manifest.
+
+GrB_Info GB_jitifyer_set_record_file (const char *new_record_file)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the record file in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        // free the old record file
+        GB_FREE_STUFF (GB_jit_record_file) ;
+        // allocate the new GB_jit_record_file
+        size_t len = (new_record_file == NULL) ? 0 : strlen (new_record_file) ;
+        GB_MALLOC_PERSISTENT (GB_jit_record_file, len + 2) ;
+        if (GB_jit_record_file == NULL)
+        { 
+            info = GrB_OUT_OF_MEMORY ;
+        }
+        else
+        { 
+            GB_jit_record_file_allocated = len + 2 ;
+            strncpy (GB_jit_record_file,
+                (new_record_file == NULL) ? "" : new_record_file, len + 2) ;
+        }
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_record: append the name of a kernel to the record file
+//------------------------------------------------------------------------------
+
+// Must be called in the critical section.
+
+static void GB_jitifyer_record (const char *kernel_name)
+{
+    if (GB_STRLEN (GB_jit_record_file) > 0)
+    { 
+        FILE *fp = fopen (GB_jit_record_file, "a") ;
+        if (fp != NULL)
+        { 
+            fprintf (fp, "%s\n", kernel_name) ;
+            fclose (fp) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_C_compiler: return the current C compiler
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_C_compiler (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_C_compiler ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_compiler: set a new C compiler
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_C_compiler (const char *new_C_compiler)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
     //--------------------------------------------------------------------------
 
     if (new_C_compiler == NULL)
@@ -1094,7 +1534,11 @@ GrB_Info GB_jitifyer_set_C_compiler_worker (const char *new_C_compiler)
     // allocate the new GB_jit_C_compiler
     GB_COPY_STUFF (GB_jit_C_compiler, new_C_compiler) ;
     // allocate workspace
-    return (GB_jitifyer_alloc_space ( )) ;
+    GrB_Info info = GB_jitifyer_alloc_space ( ) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    // the compiled kernels go in a new folder
+    GB_jitifyer_establish_lib_folder ( ) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -1150,7 +1594,11 @@ GrB_Info GB_jitifyer_set_C_flags_worker (const char *new_C_flags)
     // allocate the new GB_jit_C_flags
     GB_COPY_STUFF (GB_jit_C_flags, new_C_flags) ;
     // allocate workspace
-    return (GB_jitifyer_alloc_space ( )) ;
+    GrB_Info info = GB_jitifyer_alloc_space ( ) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    // the compiled kernels go in a new folder
+    GB_jitifyer_establish_lib_folder ( ) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -1300,6 +1748,58 @@ void GB_jitifyer_set_use_cmake (bool use_cmake)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_async: return true if kernels are compiled in the background
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_get_async (void)
+{ 
+    bool async ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        async = GB_jit_async ;
+    }
+    return (async) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_async: set controls true/false to compile in the background
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_set_async (bool async)
+{ 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jit_async = async ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_tune_reduce_panel: return true if reduce panels are tuned
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_get_tune_reduce_panel (void)
+{ 
+    bool tune ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        tune = GB_jit_tune_reduce_panel ;
+    }
+    return (tune) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_tune_reduce_panel: set true/false to tune reduce panels
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_set_tune_reduce_panel (bool tune)
+{ 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jit_tune_reduce_panel = tune ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_cmake_libs: return the current cmake libs
 //------------------------------------------------------------------------------
@@ -1617,20 +2117,26 @@ GrB_Info GB_jitifyer_load
     }
 
     //--------------------------------------------------------------------------
-    // handle the GxB_JIT_RUN case: critical section not required
+    // look up the kernel in the hash table: critical section not required
     //--------------------------------------------------------------------------
 
-    if ((GB_jit_control == GxB_JIT_RUN) &&
-        (family != GB_jit_user_op_family) &&
-        (family != GB_jit_user_type_family))
+    // Kernels already loaded are found without entering the critical section,
+    // so that many user threads can use them at the same time.  The entries
+    // for user-defined types and operators must be checked in the critical
+    // section, as must unchecked PreJIT kernels.  Entries are only changed
+    // inside the critical section, and an entry for a kernel with a suffix
+    // (user-defined types or operators) can be freed there if its definition
+    // changes, so those kernels are only found outside the critical section
+    // if the JIT cannot load or compile any kernels (GxB_JIT_RUN).
+
+    if ((family != GB_jit_user_op_family) &&
+        (family != GB_jit_user_type_family) &&
+        (GB_jit_control == GxB_JIT_RUN || encoding->suffix_len == 0))
     {
-
-        //----------------------------------------------------------------------
-        // look up the kernel in the hash table
-        //----------------------------------------------------------------------
-
         int64_t k1 = -1, kk = -1 ;
+        GB_jitifyer_reader_begin ( ) ;
         (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
+        GB_jitifyer_reader_end ( ) ;
         if (k1 >= 0)
         { 
             // an unchecked PreJIT kernel; check it inside critical section
@@ -1640,11 +2146,13 @@ GrB_Info GB_jitifyer_load
             // found the kernel in the hash table
             return (GrB_SUCCESS) ;
         }
-        else
+        else if (GB_jit_control == GxB_JIT_RUN &&
+            GB_jitifyer_prejit_find (hash) < 0)
         { 
             // No kernels may be loaded or compiled, but existing kernels
             // already loaded may be run (handled above if dl_function was
-            // found).  This kernel was not loaded, so punt to generic.
+            // found).  This kernel was not loaded, and it is not a PreJIT
+            // kernel that has yet to be registered, so punt to generic.
             // This is not a JIT failure since the JIT control is already
             // set to 'run', and the kernel is not already loaded.  So always
             // fallback to the generic kernel.
@@ -1665,6 +2173,118 @@ GrB_Info GB_jitifyer_load
     return (info) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_name: construct the name of a kernel
+//------------------------------------------------------------------------------
+
+// Also returns the operators op1 and op2 for GB_macrofy_query, and the monoid
+// of the semiring for the mxm family.
+
+#ifndef NJIT
+static void GB_jitifyer_kernel_name
+(
+    // output:
+    char *kernel_name,          // size GB_KLEN
+    GB_Operator *op1,
+    GB_Operator *op2,
+    // input/output:
+    GrB_Monoid *monoid,
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    GrB_Semiring semiring,
+    GB_Operator op
+)
+{
+    (*op1) = NULL ;
+    (*op2) = NULL ;
+    int method_code_digits = 0 ;
+
+    switch (family)
+    {
+        case GB_jit_apply_family  : 
+            (*op1) = op ;
+            method_code_digits = 10 ;
+            break ;
+
+        case GB_jit_assign_family : 
+            (*op1) = op ;
+            method_code_digits = 12 ;
+            break ;
+
+        case GB_jit_build_family  : 
+            (*op1) = op ;
+            method_code_digits = 7 ;
+            break ;
+
+        case GB_jit_ewise_family  : 
+            (*op1) = op ;
+            method_code_digits = 12 ;
+            break ;
+
+        case GB_jit_mxm_family    : 
+            (*monoid) = semiring->add ;
+            (*op1) = (GB_Operator) semiring->add->op ;
+            (*op2) = (GB_Operator) semiring->multiply ;
+            method_code_digits = 13 ;
+            break ;
+
+        case GB_jit_reduce_family : 
+            (*op1) = (GB_Operator) (*monoid)->op ;
+            method_code_digits = 5 ;
+            break ;
+
+        case GB_jit_select_family : 
+            (*op1) = op ;
+            method_code_digits = 10 ;
+            break ;
+
+        case GB_jit_user_type_family : 
+            method_code_digits = 1 ;
+            break ;
+
+        case GB_jit_user_op_family : 
+            method_code_digits = 1 ;
+            (*op1) = op ;
+            break ;
+
+        case GB_jit_masker_family  : 
+            method_code_digits = 5 ;
+            break ;
+
+        case GB_jit_subref_family  : 
+            method_code_digits = 4 ;
+            break ;
+
+        case GB_jit_sort_family  : 
+            method_code_digits = 4 ;
+            break ;
+
+        default: ;
+    }
+
+    GB_macrofy_name (kernel_name, "GB_jit", kname, method_code_digits,
+        encoding->code, suffix) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_file_exists: check if a file exists
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_file_exists (const char *filename)
+{
+    FILE *fp = fopen (filename, "r") ;
+    if (fp == NULL)
+    { 
+        return (false) ;
+    }
+    fclose (fp) ;
+    return (true) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_load2_worker: do the work for GB_jitifyer_load in a critical section
 //------------------------------------------------------------------------------
@@ -1698,6 +2318,16 @@ GrB_Info GB_jitifyer_load2_worker
     // ensure that e->prejit_index is >= 0, to denote that it's unchecked:
     #define GB_PREJIT_UNCHECKED(i) (((i) < 0) ? GB_PREJIT_CHECKED(i) : (i))
 
+    // register any PreJIT kernel with this hash, if this is the first time
+    // it is needed
+    GrB_Info info = GB_jitifyer_prejit_register (hash) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // PreJIT error: out of memory
+        GB_jit_control = GxB_JIT_PAUSE ;
+        return (info) ;
+    }
+
     int64_t k1 = -1, kk = -1 ;
     (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
     if ((*dl_function) != NULL)
@@ -1710,8 +2340,9 @@ GrB_Info GB_jitifyer_load2_worker
             void **Kernels = NULL ;
             void **Queries = NULL ;
             char **Names = NULL ;
+            uint64_t *Hashes = NULL ;
             int32_t nkernels = 0 ;
-            GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+            GB_prejit (&nkernels, &Kernels, &Queries, &Names, &Hashes) ;
             GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k1] ;
             bool builtin = (encoding->suffix_len == 0) ;
             bool ok = GB_jitifyer_query (dl_query, builtin, hash, semiring,
@@ -1799,107 +2430,95 @@ GrB_Info GB_jitifyer_load2_worker
     //--------------------------------------------------------------------------
 
     #ifndef NJIT
-    GB_Operator op1 = NULL ;
-    GB_Operator op2 = NULL ;
-    int method_code_digits = 0 ;
+    GB_Operator op1, op2 ;
+    char kernel_name [GB_KLEN] ;
+    GB_jitifyer_kernel_name (kernel_name, &op1, &op2, &monoid, family, kname,
+        encoding, suffix, semiring, op) ;
+    uint32_t bucket = hash & 0xFF ;
 
-    switch (family)
+    //--------------------------------------------------------------------------
+    // check a kernel compiled in the background
+    //--------------------------------------------------------------------------
+
+    if (kk >= 0 && (*dl_function) == NULL)
     {
-        case GB_jit_apply_family  : 
-            op1 = op ;
-            method_code_digits = 10 ;
-            break ;
+        // The kernel has an entry in the hash table but no kernel, so it has
+        // been compiled in the background.  The compiler renames the lib*.so
+        // file when it is done, or writes a *.failed file if it fails, so
+        // there is no need to lock the kernel or to load it to check it.
+        GB_jit_entry *e = &(GB_jit_table [kk]) ;
+        if (e->dl_function == GB_JIT_COMPILING)
+        {
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+                GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+                kernel_name, GB_LIB_SUFFIX) ;
+            if (GB_jitifyer_file_exists (GB_jit_temp))
+            { 
+                // the kernel has been compiled; load it below
+                GB_jit_npending-- ;
+                GB_jitifyer_entry_free (e) ;
+            }
+            else
+            {
+                snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                    "%s/c/%02x/%s.failed", GB_jit_cache_path, bucket,
+                    kernel_name) ;
+                if (GB_jitifyer_file_exists (GB_jit_temp))
+                { 
+                    // the compiler failed; do not try again until the hash
+                    // table is freed
+                    GB_jit_npending-- ;
+                    remove (GB_jit_temp) ;
+                    GB_ATOMIC_WRITE
+                    e->dl_function = GB_JIT_COMPILE_FAILED ;
+                    GBURBLE ("(jit: background compile failed) ") ;
+                    return (GrB_NO_VALUE) ;
+                }
+                else
+                { 
+                    // the compiler is still running; use the generic kernel
+                    GBURBLE ("(jit: compile pending) ") ;
+                    return (GrB_NO_VALUE) ;
+                }
+            }
+        }
+        else
+        { 
+            // the compiler failed earlier; use the generic kernel
+            ASSERT (e->dl_function == GB_JIT_COMPILE_FAILED) ;
+            return (GrB_NO_VALUE) ;
+        }
+    }
 
-        case GB_jit_assign_family : 
-            op1 = op ;
-            method_code_digits = 12 ;
-            break ;
+    //--------------------------------------------------------------------------
+    // lock the kernel
+    //--------------------------------------------------------------------------
 
-        case GB_jit_build_family  : 
-            op1 = op ;
-            method_code_digits = 7 ;
-            break ;
+    // TODO: add kernel_name to the lock filename.  If the lock fails,
+    // sleep for 1 second and try again repeatedly, with a timeout limit of
+    // (say) 60 seconds.
 
-        case GB_jit_ewise_family  : 
-            op1 = op ;
-            method_code_digits = 12 ;
-            break ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
+    FILE *fp_klock = NULL ;
+    int fd_klock = -1 ;
+    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    {
+        // JIT failure: unable to lock the kernel
+        // disable the JIT to avoid repeated load errors
+        GB_jit_control = GxB_JIT_RUN ;
+        // report the error: punt to generic or panic
+        GBURBLE ("\n(jit failure: cannot create a file I/O lock)\n") ;
+        return (GxB_JIT_ERROR) ;
+    }
 
-        case GB_jit_mxm_family    : 
-            monoid = semiring->add ;
-            op1 = (GB_Operator) semiring->add->op ;
-            op2 = (GB_Operator) semiring->multiply ;
-            method_code_digits = 13 ;
-            break ;
+    //--------------------------------------------------------------------------
+    // load the kernel, compiling it if needed
+    //--------------------------------------------------------------------------
 
-        case GB_jit_reduce_family : 
-            op1 = (GB_Operator) monoid->op ;
-            method_code_digits = 5 ;
-            break ;
-
-        case GB_jit_select_family : 
-            op1 = op ;
-            method_code_digits = 10 ;
-            break ;
-
-        case GB_jit_user_type_family : 
-            method_code_digits = 1 ;
-            break ;
-
-        case GB_jit_user_op_family : 
-            method_code_digits = 1 ;
-            op1 = op ;
-            break ;
-
-        case GB_jit_masker_family  : 
-            method_code_digits = 5 ;
-            break ;
-
-        case GB_jit_subref_family  : 
-            method_code_digits = 4 ;
-            break ;
-
-        case GB_jit_sort_family  : 
-            method_code_digits = 4 ;
-            break ;
-
-        default: ;
-    }
-
-    char kernel_name [GB_KLEN] ;
-    GB_macrofy_name (kernel_name, "GB_jit", kname, method_code_digits,
-        encoding->code, suffix) ;
-
-    //--------------------------------------------------------------------------
-    // lock the kernel
-    //--------------------------------------------------------------------------
-
-    // TODO: add kernel_name to the lock filename.  If the lock fails,
-    // sleep for 1 second and try again repeatedly, with a timeout limit of
-    // (say) 60 seconds.
-
-    uint32_t bucket = hash & 0xFF ;
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
-    FILE *fp_klock = NULL ;
-    int fd_klock = -1 ;
-    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
-    {
-        // JIT failure: unable to lock the kernel
-        // disable the JIT to avoid repeated load errors
-        GB_jit_control = GxB_JIT_RUN ;
-        // report the error: punt to generic or panic
-        GBURBLE ("\n(jit failure: cannot create a file I/O lock)\n") ;
-        return (GxB_JIT_ERROR) ;
-    }
-
-    //--------------------------------------------------------------------------
-    // load the kernel, compiling it if needed
-    //--------------------------------------------------------------------------
-
-    GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
-        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
-        type1, type2, type3) ;
+    info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
+        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
+        type1, type2, type3) ;
 
     //--------------------------------------------------------------------------
     // unlock the kernel
@@ -1910,6 +2529,21 @@ GrB_Info GB_jitifyer_load2_worker
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_tune_file: construct the name of the file for a tuned kernel
+//------------------------------------------------------------------------------
+
+// When a kernel is tuned, the fastest variant replaces the lib*.so file of
+// the kernel, and a [kernel_name].tune file is placed beside it, so that the
+// kernel is not tuned again.  The file is removed whenever the kernel is
+// compiled.  The filename is returned in GB_jit_temp.
+
+static void GB_jitifyer_tune_file (const char *kernel_name, uint32_t bucket)
+{ 
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s.tune",
+        GB_jit_cache_path, GB_jit_lib_folder, bucket, kernel_name) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_load_worker: load/compile a kernel
 //------------------------------------------------------------------------------
@@ -1948,8 +2582,9 @@ GrB_Info GB_jitifyer_load_worker
     //--------------------------------------------------------------------------
 
     uint32_t bucket = hash & 0xFF ;
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
-        GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+        GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+        kernel_name, GB_LIB_SUFFIX) ;
     void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
     GB_jit_kcode kcode = encoding->kcode ;
 
@@ -1999,14 +2634,31 @@ GrB_Info GB_jitifyer_load_worker
             return (GrB_NO_VALUE) ;
         }
 
+        //----------------------------------------------------------------------
+        // quick return if the kernel is already being compiled
+        //----------------------------------------------------------------------
+
+        bool async = GB_jit_async && !GB_jit_use_cmake &&
+            (kcode < GB_JIT_CUDA_KERNEL) &&
+            (family != GB_jit_user_op_family) &&
+            (family != GB_jit_user_type_family) ;
+
+        // compile now if too many kernels are being compiled in the background
+        async = async && (GB_jit_npending < GB_JIT_PENDING_MAX) ;
+
         //----------------------------------------------------------------------
         // create the source, compile it, and load it
         //----------------------------------------------------------------------
 
-        GBURBLE ("(jit: compile and load) ") ;
+        GBURBLE (async ? "(jit: compile in background) " :
+                         "(jit: compile and load) ") ;
         const char *kernel_filetype =
             (kcode < GB_JIT_CUDA_KERNEL) ? "c" : "cu" ;
 
+        // the new kernel has not been tuned
+        GB_jitifyer_tune_file (kernel_name, bucket) ;
+        remove (GB_jit_temp) ;
+
         // create (or recreate) the kernel source, compile it, and load it
         snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.%s",
             GB_jit_cache_path, bucket, kernel_name, kernel_filetype) ;
@@ -2049,16 +2701,35 @@ GrB_Info GB_jitifyer_load_worker
             // use cmake to compile the CPU kernel
             GB_jitifyer_cmake_compile (kernel_name, hash) ;
         }
+        else if (async)
+        { 
+            // start the compiler in a background process, and use the generic
+            // kernel until the lib*.so file appears.  It is loaded the next
+            // time this kernel is needed (see GB_jitifyer_load2_worker).
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.failed",
+                GB_jit_cache_path, bucket, kernel_name) ;
+            remove (GB_jit_temp) ;
+            GB_jitifyer_direct_compile (kernel_name, bucket, true) ;
+            if (!GB_jitifyer_insert (hash, encoding, suffix, NULL,
+                GB_JIT_COMPILING, -1))
+            { 
+                // JIT error: out of memory
+                GB_jit_control = GxB_JIT_PAUSE ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_jit_npending++ ;
+            return (GrB_NO_VALUE) ;
+        }
         else
         { 
             // use the compiler to directly compile the CPU kernel
-            GB_jitifyer_direct_compile (kernel_name, bucket) ;
+            GB_jitifyer_direct_compile (kernel_name, bucket, false) ;
         }
 
         // load the kernel from the lib*.so file
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
-            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
-            GB_LIB_SUFFIX) ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            kernel_name, GB_LIB_SUFFIX) ;
         dl_handle = GB_file_dlopen (GB_jit_temp) ;
 
         //----------------------------------------------------------------------
@@ -2120,6 +2791,12 @@ GrB_Info GB_jitifyer_load_worker
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    // record the kernel, for GxB_JIT_warmup and GxB_JIT_export
+    if (kcode < GB_JIT_CUDA_KERNEL)
+    { 
+        GB_jitifyer_record (kernel_name) ;
+    }
+
     return (GrB_SUCCESS) ;
     #else
     (*dl_function) = NULL ;
@@ -2127,6 +2804,374 @@ GrB_Info GB_jitifyer_load_worker
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_tune_panel: compile variants of a kernel and keep the fastest
+//------------------------------------------------------------------------------
+
+// If GxB_JIT_TUNE_REDUCE_PANEL is true, a CPU JIT reduce-to-scalar kernel is
+// compiled once for each of the given values of its panel size (GB_PANEL),
+// and each variant is timed on the inputs of the problem, via the trial
+// function.  No other kernel is tuned.  A variant is a short source file,
+// [kernel_name]__tune[value].c, that defines the parameter and then includes
+// the source of the kernel, which must define the parameter only if it is not
+// already defined.  The fastest variant replaces the lib*.so file of the
+// kernel in the cache, for use by this and later processes, and a
+// [kernel_name].tune file records the result.
+
+// A kernel is tuned at most once, and only if the JIT control is GxB_JIT_ON.
+// PreJIT kernels are not tuned.  If the problem is too small to be timed
+// reliably, the kernel is tuned later, with a larger problem.  The timer
+// requires OpenMP.
+
+// On input, dl_function is the kernel returned by GB_jitifyer_load.  On
+// output, it is the tuned kernel.  No error is returned; a variant that
+// cannot be compiled or loaded is skipped.  The trial function must not have
+// any side effects other than on its own workspace, since it is called
+// several times for each variant.
+
+// minimum run time of the kernel for tuning, in seconds
+#define GB_TUNE_PANEL_MIN_TIME 1e-3
+
+// number of trials of each variant; the fastest trial is used
+#define GB_TUNE_PANEL_NTRIALS 2
+
+#ifndef NJIT
+static double GB_jitifyer_trial_time
+(
+    void *dl_function,
+    GB_jit_trial_func trial,
+    void *trial_args
+)
+{
+    double tbest = INFINITY ;
+    for (int t = 0 ; t < GB_TUNE_PANEL_NTRIALS ; t++)
+    {
+        double t0 = GB_omp_get_wtime ( ) ;
+        if (trial (dl_function, trial_args) != GrB_SUCCESS)
+        { 
+            // the variant failed; do not use it
+            return (INFINITY) ;
+        }
+        tbest = fmin (tbest, GB_omp_get_wtime ( ) - t0) ;
+    }
+    return (tbest) ;
+}
+#endif
+
+static void GB_jitifyer_tune_panel_worker
+(
+    // input/output:
+    void **dl_function,
+    // input:
+    GB_jit_family family,
+    const char *kname,
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix,
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    const char *param,
+    const int *values,
+    int nvalues,
+    GB_jit_trial_func trial,
+    void *trial_args
+)
+{
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // find the kernel in the hash table
+    //--------------------------------------------------------------------------
+
+    int64_t k1 = -1, kk = -1 ;
+    void *dl_kernel = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
+    if (dl_kernel == NULL)
+    { 
+        // the kernel has been freed by another user thread
+        return ;
+    }
+    GB_jit_entry *e = &(GB_jit_table [kk]) ;
+    (*dl_function) = dl_kernel ;
+    if (e->tuned)
+    { 
+        // the kernel was tuned by another user thread
+        return ;
+    }
+    if (e->dl_handle == NULL)
+    { 
+        // PreJIT kernels are not tuned
+        e->tuned = true ;
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if the kernel was tuned by an earlier process
+    //--------------------------------------------------------------------------
+
+    GB_Operator op1, op2 ;
+    char kernel_name [GB_KLEN] ;
+    GB_jitifyer_kernel_name (kernel_name, &op1, &op2, &monoid, family, kname,
+        encoding, suffix, semiring, op) ;
+    uint32_t bucket = hash & 0xFF ;
+    GB_jitifyer_tune_file (kernel_name, bucket) ;
+    FILE *fp = fopen (GB_jit_temp, "r") ;
+    if (fp != NULL)
+    { 
+        fclose (fp) ;
+        e->tuned = true ;
+        return ;
+    }
+
+    if (GB_jit_control < GxB_JIT_ON || GB_STRLEN (GB_jit_cache_path) == 0 ||
+        strlen (kernel_name) + 16 >= GB_KLEN)
+    { 
+        // the variants cannot be compiled; try again later
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time the kernel as it is
+    //--------------------------------------------------------------------------
+
+    double tbest = GB_jitifyer_trial_time (dl_kernel, trial, trial_args) ;
+    if (tbest < GB_TUNE_PANEL_MIN_TIME || tbest == INFINITY)
+    { 
+        // the problem is too small to time reliably; try again later
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // lock the kernel
+    //--------------------------------------------------------------------------
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
+    FILE *fp_klock = NULL ;
+    int fd_klock = -1 ;
+    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    { 
+        // unable to lock the kernel; try again later
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compile and time each variant
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(jit: tune %s) ", param) ;
+    int best = -1 ;
+    void *best_handle = NULL ;
+    void *best_function = NULL ;
+    char variant_name [GB_KLEN] ;
+
+    for (int k = 0 ; k < nvalues ; k++)
+    {
+
+        // create the variant source file
+        snprintf (variant_name, GB_KLEN, "%s__tune%d", kernel_name,
+            values [k]) ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+            GB_jit_cache_path, bucket, variant_name) ;
+        fp = fopen (GB_jit_temp, "w") ;
+        if (fp == NULL) continue ;
+        fprintf (fp, "// %s: %s = %d, for tuning\n"
+            "#define %s %d\n"
+            "#include \"%s.c\"\n",
+            variant_name, param, values [k], param, values [k], kernel_name) ;
+        fclose (fp) ;
+
+        // compile the variant
+        if (GB_jit_use_cmake)
+        { 
+            GB_jitifyer_cmake_compile (variant_name, hash + k + 1) ;
+        }
+        else
+        { 
+            GB_jitifyer_direct_compile (variant_name, bucket, false) ;
+        }
+
+        // the variant source is no longer needed
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+            GB_jit_cache_path, bucket, variant_name) ;
+        remove (GB_jit_temp) ;
+
+        // load the variant
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            variant_name, GB_LIB_SUFFIX) ;
+        void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
+        void *dl_variant = NULL ;
+        if (dl_handle != NULL)
+        { 
+            dl_variant = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
+        }
+
+        // time the variant
+        double t = INFINITY ;
+        if (dl_variant != NULL)
+        { 
+            t = GB_jitifyer_trial_time (dl_variant, trial, trial_args) ;
+        }
+        GBURBLE ("(%s %d: %g sec) ", param, values [k], t) ;
+
+        if (t < tbest)
+        { 
+            // this variant is the fastest so far; keep it loaded
+            if (best_handle != NULL)
+            { 
+                GB_file_dlclose (best_handle) ;
+                snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                    "%s/%s/%02x/%s%s__tune%d%s", GB_jit_cache_path,
+                    GB_jit_lib_folder, bucket, GB_LIB_PREFIX, kernel_name,
+                    values [best], GB_LIB_SUFFIX) ;
+                remove (GB_jit_temp) ;
+            }
+            tbest = t ;
+            best = k ;
+            best_handle = dl_handle ;
+            best_function = dl_variant ;
+        }
+        else
+        { 
+            // discard the variant
+            if (dl_handle != NULL) GB_file_dlclose (dl_handle) ;
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+                GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+                variant_name, GB_LIB_SUFFIX) ;
+            remove (GB_jit_temp) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // keep the fastest variant
+    //--------------------------------------------------------------------------
+
+    if (best >= 0)
+    { 
+        // replace the lib*.so file of the kernel with the fastest variant
+        char *kernel_lib = GB_jit_temp + GB_jit_temp_allocated / 2 ;
+        size_t kernel_lib_size = GB_jit_temp_allocated / 2 ;
+        snprintf (kernel_lib, kernel_lib_size, "%s/%s/%02x/%s%s%s",
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            kernel_name, GB_LIB_SUFFIX) ;
+        snprintf (GB_jit_temp, kernel_lib_size, "%s/%s/%02x/%s%s__tune%d%s",
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            kernel_name, values [best], GB_LIB_SUFFIX) ;
+        rename (GB_jit_temp, kernel_lib) ;
+        // use the variant in this process.  Other user threads may still be
+        // using the old kernel, so it is not unloaded until the hash entry is
+        // freed.
+        e->dl_tuned_handle = best_handle ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
+        e->dl_function = best_function ;
+        #pragma omp flush
+        (*dl_function) = best_function ;
+    }
+
+    // record the result, so the kernel is not tuned again
+    GB_jitifyer_tune_file (kernel_name, bucket) ;
+    fp = fopen (GB_jit_temp, "w") ;
+    if (fp != NULL)
+    { 
+        if (best >= 0)
+        { 
+            fprintf (fp, "%s %d\n", param, values [best]) ;
+        }
+        else
+        { 
+            fprintf (fp, "%s default\n", param) ;
+        }
+        fclose (fp) ;
+    }
+    e->tuned = true ;
+
+    //--------------------------------------------------------------------------
+    // unlock the kernel
+    //--------------------------------------------------------------------------
+
+    GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+    #endif
+}
+
+void GB_jitifyer_tune_panel
+(
+    // input/output:
+    void **dl_function,         // kernel from GB_jitifyer_load on input;
+                                // the tuned kernel on output
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    // operator definitions, for the kernel_name
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    // tuning parameter:
+    const char *param,          // name of the tuning parameter
+    const int *values,          // values of the parameter to try
+    int nvalues,                // # of values to try
+    GB_jit_trial_func trial,    // runs a kernel on the inputs of the problem
+    void *trial_args            // inputs of the problem, for trial
+)
+{
+
+    //--------------------------------------------------------------------------
+    // quick return if the kernel does not need to be tuned
+    //--------------------------------------------------------------------------
+
+    if (!GB_jit_tune_reduce_panel || GB_jit_control < GxB_JIT_LOAD)
+    { 
+        return ;
+    }
+
+    int64_t k1 = -1, kk = -1 ;
+    int32_t tuned = false ;
+    GB_jitifyer_reader_begin ( ) ;
+    bool found = (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL);
+    if (found && k1 < 0)
+    { 
+        // If the table was just replaced by another user thread, this may be
+        // a different entry, and the kernel is tuned later (or checked again
+        // in the critical section).  The bits are read before the table, as
+        // in GB_jitifyer_lookup.
+        uint64_t bits ;
+        GB_ATOMIC_READ
+        bits = GB_jit_table_bits ;
+        #pragma omp flush
+        GB_jit_entry *table ;
+        GB_ATOMIC_READ
+        table = GB_jit_table ;
+        if (table != NULL && kk <= bits)
+        { 
+            GB_ATOMIC_READ
+            tuned = table [kk].tuned ;
+        }
+    }
+    GB_jitifyer_reader_end ( ) ;
+    if (!found || k1 >= 0 || tuned)
+    { 
+        // the kernel is not loaded, it is an unchecked PreJIT kernel, or it
+        // has already been tuned
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // tune the kernel inside the critical section
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_jitifyer_worker)
+    { 
+        GB_jitifyer_tune_panel_worker (dl_function, family, kname, hash,
+            encoding, suffix, semiring, monoid, op, param, values, nvalues,
+            trial, trial_args) ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_lookup:  find a jit entry in the hash table
 //------------------------------------------------------------------------------
@@ -2145,7 +3190,26 @@ void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
 
     (*k1) = -1 ;
 
-    if (GB_jit_table == NULL)
+    // This method may be called outside the critical section, while another
+    // thread inserts an entry or replaces the table with a larger one.  The
+    // table bits are read before the table itself, and GB_jitifyer_insert
+    // writes them in the opposite order, so the bits never exceed the size of
+    // the table read here.  With a new table but old bits, the entry may not
+    // be found, and the caller then searches again in the critical section.
+    // A new entry is published by writing its dl_function last.  A removed
+    // entry is a tombstone, and the search continues past it.  The caller
+    // must count the search with GB_jitifyer_reader_begin/end if it is done
+    // outside the critical section.
+
+    uint64_t bits ;
+    GB_ATOMIC_READ
+    bits = GB_jit_table_bits ;
+    #pragma omp flush
+    GB_jit_entry *table ;
+    GB_ATOMIC_READ
+    table = GB_jit_table ;
+
+    if (table == NULL)
     { 
         // no table yet so it isn't present
         return (NULL) ;
@@ -2155,31 +3219,49 @@ void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
     bool builtin = (bool) (suffix_len == 0) ;
 
     // look up the entry in the hash table
-    for (uint64_t k = hash ; ; k++)
+    for (uint64_t k = hash, nprobes = 0 ; nprobes <= bits ; k++, nprobes++)
     {
-        k = k & GB_jit_table_bits ;
-        GB_jit_entry *e = &(GB_jit_table [k]) ;
-        if (e->dl_function == NULL)
+        k = k & bits ;
+        GB_jit_entry *e = &(table [k]) ;
+        void *dl_function ;
+        GB_ATOMIC_READ
+        dl_function = e->dl_function ;
+        if (dl_function == NULL)
         { 
             // found an empty entry, so the entry is not in the table
             return (NULL) ;
         }
-        else if (e->hash == hash &&
+        if (dl_function == GB_JIT_TOMBSTONE)
+        { 
+            // skip a removed entry
+            continue ;
+        }
+        #pragma omp flush
+        if (e->hash == hash &&
             e->encoding.code == encoding->code &&
             e->encoding.kcode == encoding->kcode &&
             e->encoding.suffix_len == suffix_len &&
             (builtin || (memcmp (e->suffix, suffix, suffix_len) == 0)))
         { 
             // found the right entry: return the corresponding dl_function
+            (*kk) = k ;
+            if (!GB_JIT_HAS_KERNEL (dl_function))
+            { 
+                // the kernel is being compiled in the background, or its
+                // compilation failed
+                return (NULL) ;
+            }
             int64_t my_k1 ;
             GB_ATOMIC_READ
             my_k1 = e->prejit_index ;   // >= 0: unchecked JIT kernel
             (*k1) = my_k1 ;
-            (*kk) = k ;
-            return (e->dl_function) ;
+            return (dl_function) ;
         }
         // otherwise, keep looking
     }
+
+    // not found
+    return (NULL) ;
 }
 
 //------------------------------------------------------------------------------
@@ -2214,28 +3296,42 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
         //----------------------------------------------------------------------
 
         siz = GB_JITIFIER_INITIAL_SIZE * sizeof (struct GB_jit_entry_struct) ;
-        GB_MALLOC_PERSISTENT (GB_jit_table, siz) ;
-        if (GB_jit_table == NULL)
+        GB_jit_entry *new_table ;
+        GB_MALLOC_PERSISTENT (new_table, siz) ;
+        if (new_table == NULL)
         {
             // JIT error: out of memory
             return (false) ;
         }
-        memset (GB_jit_table, 0, siz) ;
+        memset (new_table, 0, siz) ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
+        GB_jit_table = new_table ;
         GB_jit_table_size = GB_JITIFIER_INITIAL_SIZE ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
         GB_jit_table_bits = GB_JITIFIER_INITIAL_SIZE - 1 ;
         GB_jit_table_allocated = siz ;
 
     }
-    else if (4 * GB_jit_table_populated >= GB_jit_table_size)
+    else if (4 * (GB_jit_table_populated + GB_jit_table_tombstones) >=
+        GB_jit_table_size)
     {
 
         //----------------------------------------------------------------------
         // expand the existing hash table by a factor of 4 and rehash
         //----------------------------------------------------------------------
 
+        // If the table is mostly tombstones, it is rehashed at the same size
+        // instead, to remove them.
+
         ASSERT_TABLE_OK ;
         // create a new table that is four times the size
-        int64_t new_size = 4 * GB_jit_table_size ;
+        int64_t new_size = GB_jit_table_size ;
+        if (8 * GB_jit_table_populated >= GB_jit_table_size)
+        { 
+            new_size = 4 * GB_jit_table_size ;
+        }
         int64_t new_bits = new_size - 1 ;
         siz = new_size * sizeof (struct GB_jit_entry_struct) ;
         GB_jit_entry *new_table ;
@@ -2250,7 +3346,8 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
         memset (new_table, 0, siz) ;
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
-            if (GB_jit_table [k].dl_function != NULL)
+            void *dl_function = GB_jit_table [k].dl_function ;
+            if (dl_function != NULL && dl_function != GB_JIT_TOMBSTONE)
             { 
                 // rehash the entry to the larger hash table
                 uint64_t hash = GB_jit_table [k].hash ;
@@ -2268,15 +3365,21 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             }
         }
 
-        // free the old table
-        GB_FREE_STUFF (GB_jit_table) ;
-
-        // use the new table
+        // use the new table, and then its bits
+        GB_jit_entry *old_table = GB_jit_table ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
         GB_jit_table = new_table ;
         GB_jit_table_size = new_size ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
         GB_jit_table_bits = new_bits ;
         GB_jit_table_allocated = siz ;
+        GB_jit_table_tombstones = 0 ;
         ASSERT_TABLE_OK ;
+
+        // other threads may still be searching the old table
+        GB_jitifyer_retire (old_table) ;
     }
 
     //--------------------------------------------------------------------------
@@ -2309,9 +3412,15 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             e->hash = hash ;
             memcpy (&(e->encoding), encoding, sizeof (GB_jit_encoding)) ;
             e->dl_handle = dl_handle ;              // NULL for PreJIT
-            e->dl_function = dl_function ;
-            GB_jit_table_populated++ ;
+            e->dl_tuned_handle = NULL ;
             e->prejit_index = prejit_index ;        // -1 for JIT kernels
+            e->tuned = false ;
+            GB_jit_table_populated++ ;
+            // publish the entry, for GB_jitifyer_lookup
+            #pragma omp flush
+            GB_ATOMIC_WRITE
+            e->dl_function = dl_function ;
+            #pragma omp flush
             ASSERT_TABLE_OK ;
             return (true) ;
         }
@@ -2323,16 +3432,32 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
 // GB_jitifyer_entry_free: free a single JIT hash table entry
 //------------------------------------------------------------------------------
 
+// The entry becomes a tombstone.  Other threads may still be comparing its
+// suffix, so the suffix is retired rather than freed, and e->suffix is left
+// as-is.
+
 void GB_jitifyer_entry_free (GB_jit_entry *e)
 {
-    e->dl_function = NULL ;
+    ASSERT (e->dl_function != NULL && e->dl_function != GB_JIT_TOMBSTONE) ;
+    GB_ATOMIC_WRITE
+    e->dl_function = GB_JIT_TOMBSTONE ;
+    #pragma omp flush
     GB_jit_table_populated-- ;
-    GB_FREE_PERSISTENT (e->suffix) ;
+    GB_jit_table_tombstones++ ;
+    GB_jitifyer_retire (e->suffix) ;
     // unload the dl library
+    if (e->dl_handle != NULL || e->dl_tuned_handle != NULL)
+    { 
+        GB_jitifyer_wait_for_readers ( ) ;
+    }
     if (e->dl_handle != NULL)
     { 
         GB_file_dlclose (e->dl_handle) ; e->dl_handle = NULL ;
     }
+    if (e->dl_tuned_handle != NULL)
+    { 
+        GB_file_dlclose (e->dl_tuned_handle) ; e->dl_tuned_handle = NULL ;
+    }
     ASSERT_TABLE_OK ;
 }
 
@@ -2353,12 +3478,27 @@ void GB_jitifyer_entry_free (GB_jit_entry *e)
 
 void GB_jitifyer_table_free (bool freeall)
 { 
+    // kernels compiled in the background are loaded (or compiled again) the
+    // next time they are needed
+    GB_jit_npending = 0 ;
+
     if (GB_jit_table != NULL)
     {
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
             GB_jit_entry *e = &(GB_jit_table [k]) ;
-            if (e->dl_function != NULL)
+            if (e->dl_function == GB_JIT_TOMBSTONE)
+            { 
+                // skip a removed entry
+                continue ;
+            }
+            else if (e->dl_function != NULL &&
+                !GB_JIT_HAS_KERNEL (e->dl_function))
+            { 
+                // free the entry of a kernel compiled in the background
+                GB_jitifyer_entry_free (e) ;
+            }
+            else if (e->dl_function != NULL)
             {
                 // found an entry
                 if (e->dl_handle == NULL)
@@ -2378,12 +3518,21 @@ void GB_jitifyer_table_free (bool freeall)
     }
 
     ASSERT (GB_IMPLIES (freeall, GB_jit_table_populated == 0)) ;
-    if (GB_jit_table_populated == 0)
+    if (GB_jit_table_populated == 0 && GB_jit_table != NULL)
     { 
-        // the JIT table is now empty, so free it
-        GB_FREE_STUFF (GB_jit_table) ;
-        GB_jit_table_size = 0 ;
+        // the JIT table is now empty, so remove it, and free it once no
+        // other thread is searching it
+        GB_jit_entry *old_table = GB_jit_table ;
+        GB_ATOMIC_WRITE
         GB_jit_table_bits = 0 ;
+        #pragma omp flush
+        GB_ATOMIC_WRITE
+        GB_jit_table = NULL ;
+        #pragma omp flush
+        GB_jit_table_size = 0 ;
+        GB_jit_table_allocated = 0 ;
+        GB_jit_table_tombstones = 0 ;
+        GB_jitifyer_retire (old_table) ;
     }
 }
 
@@ -2503,14 +3652,14 @@ void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash)
         "set_target_properties ( %s PROPERTIES\n"
         "    C_STANDARD 11 C_STANDARD_REQUIRED ON )\n"
         "install ( TARGETS %s\n"
-        "    LIBRARY DESTINATION \"%s/lib/%02x\"\n"
-        "    ARCHIVE DESTINATION \"%s/lib/%02x\"\n"
-        "    RUNTIME DESTINATION \"%s/lib/%02x\" )\n",
+        "    LIBRARY DESTINATION \"%s/%s/%02x\"\n"
+        "    ARCHIVE DESTINATION \"%s/%s/%02x\"\n"
+        "    RUNTIME DESTINATION \"%s/%s/%02x\" )\n",
         kernel_name,
         kernel_name,
-        GB_jit_cache_path, bucket,
-        GB_jit_cache_path, bucket,
-        GB_jit_cache_path, bucket) ;
+        GB_jit_cache_path, GB_jit_lib_folder, bucket,
+        GB_jit_cache_path, GB_jit_lib_folder, bucket,
+        GB_jit_cache_path, GB_jit_lib_folder, bucket) ;
     fclose (fp) ;
 
     // generate the build system for this kernel
@@ -2562,7 +3711,8 @@ void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash)
 //
 // and the libary file is linked as
 //
-//      %s/lib/%02x/lib%s.so or [cache_path]/lib/[bucket]/lib[kernel_name].so
+//      %s/%s/%02x/lib%s.so or
+//      [cache_path]/lib/[fingerprint]/[bucket]/lib[kernel_name].so
 //
 // All other temporary files (including *.o object files) are removed.
 
@@ -2607,7 +3757,7 @@ void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket)
     "-DGB_JIT_RUNTIME=1  "              // nvcc flags
     "-I/usr/local/cuda/include -std=c++17 -arch=sm_60 "
     " -shared "
-    "-o '%s/lib/%02x/%s%s%s' "          // lib*.so output file
+    "-o '%s/%s/%02x/%s%s%s' "           // lib*.so output file
     "'%s/c/%02x/%s%s' "                 // *.o input file
     " -cudart shared "
 //  "%s "                               // libraries to link with (any?)
@@ -2624,7 +3774,7 @@ void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket)
     err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
 
     // link:
-    GB_jit_cache_path, bucket,  
+    GB_jit_cache_path, GB_jit_lib_folder, bucket,
     GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,              // lib*.so file
     GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o input file
 //  GB_jit_C_libraries                  // libraries to link with
@@ -2644,19 +3794,28 @@ void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket)
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_direct_compile: compile a kernel with just the compiler
+// GB_jitifyer_direct_command: construct the command to compile a kernel
 //------------------------------------------------------------------------------
 
-// This method does not return any error/success code.  If the compilation
-// fails for any reason, the subsequent load of the compiled kernel will fail.
-
-// This method does not work on Windows with MSVC.  It works for Linux, Mac,
-// or Windows with MINGW (for which it is currently the only option).
-
-// FUTURE: get this method to work in MSVC, since it's much faster than using
-// cmake on Windows.
-
-void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
+// If private_files is true, the *.o and lib*.so files are given names that
+// include the process id of the shell ($$), so that other processes and
+// threads compiling the same kernel do not collide.  The lib*.so file is
+// renamed only when it is complete, so that a partially written library is
+// never loaded, and the *.o file is removed by the command itself.  If
+// background is also true, the command runs in a background process and its
+// output is discarded, except for errors sent to the error log, and a
+// [kernel_name].failed file is created in the c/[bucket] folder if the
+// compiler fails.
+
+static void GB_jitifyer_direct_command
+(
+    char *command,          // output: the command, of size command_size
+    size_t command_size,
+    char *kernel_name,
+    uint32_t bucket,
+    bool private_files,     // if true, use private *.o and lib*.so files
+    bool background         // if true, run in a background process
+)
 { 
 
 #ifndef NJIT
@@ -2665,64 +3824,514 @@ void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
     bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
     char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
     char *log_quote = have_log ? "'" : "" ;
+    char *tmp = private_files ? "$$" : "" ;
+    if (private_files) burble_stdout = GB_DEV_NULL ;
 
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+    snprintf (command, command_size,
 
     // compile:
     "sh -c \""                          // execute with POSIX shell
+    "%s"                                // start of block
     "%s "                               // compiler command
     "-DGB_JIT_RUNTIME=1 %s "            // C flags
     "-I'%s/src' "                       // include source directory
     "-I'%s/src/template' "
     "-I'%s/src/include' "
     "%s "                               // openmp include directories
-    "-o '%s/c/%02x/%s%s' "              // *.o output file
+    "-o '%s/c/%02x/%s%s%s' "            // *.o output file
     "-c '%s/c/%02x/%s.c' "              // *.c input file
     "%s "                               // burble stdout
-    "%s %s%s%s ; "                      // error log file
+    "%s %s%s%s %s "                     // error log file, and ; or &&
 
     // link:
     "%s "                               // C compiler
     "%s "                               // C flags
     "%s "                               // C link flags
-    "-o '%s/lib/%02x/%s%s%s' "          // lib*.so output file
-    "'%s/c/%02x/%s%s' "                 // *.o input file
+    "-o '%s/%s/%02x/%s%s%s%s' "         // lib*.so output file
+    "'%s/c/%02x/%s%s%s' "               // *.o input file
     "%s "                               // libraries to link with
     "%s "                               // burble stdout
-    "%s %s%s%s\"",                      // error log file
+    "%s %s%s%s",                        // error log file
 
     // compile:
+    private_files ? "{ " : "",          // start of block
     GB_jit_C_compiler,                  // C compiler
     GB_jit_C_flags,                     // C flags
     GB_jit_cache_path,                  // include cache/src
     GB_jit_cache_path,                  // include cache/src/template
     GB_jit_cache_path,                  // include cache/src/include
     GB_OMP_INC,                         // openmp include
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o output file
+    GB_jit_cache_path, bucket, kernel_name, tmp, GB_OBJ_SUFFIX, // *.o output
     GB_jit_cache_path, bucket, kernel_name,                 // *.c input file
     burble_stdout,                      // burble stdout
     err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
+    private_files ? "&&" : ";",         // only link if the compile succeeds
 
     // link:
     GB_jit_C_compiler,                  // C compiler
     GB_jit_C_flags,                     // C flags
     GB_jit_C_link_flags,                // C link flags
-    GB_jit_cache_path, bucket,  
-    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,              // lib*.so file
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o input file
+    GB_jit_cache_path, GB_jit_lib_folder, bucket,
+    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, tmp,         // lib*.so file
+    GB_jit_cache_path, bucket, kernel_name, tmp, GB_OBJ_SUFFIX, // *.o input
     GB_jit_C_libraries,                 // libraries to link with
     burble_stdout,                      // burble stdout
     err_redirect, log_quote, GB_jit_error_log, log_quote) ; // error log file
 
+    size_t len = strlen (command) ;
+    if (private_files)
+    { 
+        // rename the lib*.so file
+        len += snprintf (command + len, command_size - len,
+            " && mv -f '%s/%s/%02x/%s%s%s$$' '%s/%s/%02x/%s%s%s'",
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            kernel_name, GB_LIB_SUFFIX,
+            GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+            kernel_name, GB_LIB_SUFFIX) ;
+        len = GB_IMIN (len, command_size) ;
+        if (background)
+        { 
+            // if the compiler fails, create the *.failed file, so that the
+            // caller need not wait for the lib*.so file (see
+            // GB_jitifyer_load2_worker)
+            len += snprintf (command + len, command_size - len,
+                " || touch '%s/c/%02x/%s.failed'",
+                GB_jit_cache_path, bucket, kernel_name) ;
+            len = GB_IMIN (len, command_size) ;
+        }
+        // remove the *.o file, and end the block
+        len += snprintf (command + len, command_size - len,
+            " ; rm -f '%s/c/%02x/%s$$%s' ; }",
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+        len = GB_IMIN (len, command_size) ;
+    }
+    if (background)
+    { 
+        // run the block in the background
+        snprintf (command + len, command_size - len,
+            " < /dev/null %s 2>&1 &\"", GB_DEV_NULL) ;
+    }
+    else
+    { 
+        snprintf (command + len, command_size - len, "\"") ;
+    }
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_direct_compile: compile a kernel with just the compiler
+//------------------------------------------------------------------------------
+
+// This method does not return any error/success code.  If the compilation
+// fails for any reason, the subsequent load of the compiled kernel will fail.
+// If async is true, the compiler is started in a background process and this
+// method returns right away.
+
+// This method does not work on Windows with MSVC.  It works for Linux, Mac,
+// or Windows with MINGW (for which it is currently the only option).
+
+// FUTURE: get this method to work in MSVC, since it's much faster than using
+// cmake on Windows.
+
+void GB_jitifyer_direct_compile
+(
+    char *kernel_name,
+    uint32_t bucket,
+    bool async              // if true, compile in a background process
+)
+{ 
+
+#ifndef NJIT
+
+    // A kernel compiled in the background uses private *.o and lib*.so files,
+    // since it may be compiled by other user processes at the same time.
+    GB_jitifyer_direct_command (GB_jit_temp, GB_jit_temp_allocated,
+        kernel_name, bucket, async, async) ;
+
     // compile the library and return result
     GBURBLE ("(jit: %s) ", GB_jit_temp) ;
     GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
 
-    // remove the *.o file
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
-        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
-    remove (GB_jit_temp) ;
+    if (!async)
+    { 
+        // remove the *.o file
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+        remove (GB_jit_temp) ;
+    }
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_read_source: read the source of a kernel
+//------------------------------------------------------------------------------
+
+// The kernel is either the name of a CPU JIT kernel whose source file is
+// already in the cache folder, or the path of a kernel source file ending in
+// ".c".  The hash of the kernel is found in the query function of its source
+// file.  Returns the contents of the source file, or NULL if the source file
+// cannot be found or read.  The caller must free the result with
+// GB_FREE_PERSISTENT.  Must be called in the critical section.
+
+static char *GB_jitifyer_read_source
+(
+    // output:
+    char *kernel_name,          // name of the kernel, of size GB_KLEN
+    uint64_t *hash,             // hash of the kernel
+    size_t *source_size,        // size of the source file
+    bool *is_path,              // true if the kernel is given by its path
+    // input:
+    const char *kernel          // kernel name, or path to its source file
+)
+{ 
+
+#ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // get the kernel name
+    //--------------------------------------------------------------------------
+
+    size_t len = strlen (kernel) ;
+    (*is_path) = (len > 2 && strcmp (kernel + len - 2, ".c") == 0) ;
+    const char *name = kernel ;
+    if (*is_path)
+    { 
+        // strip the folder and the ".c" suffix from the path
+        for (size_t k = 0 ; k < len ; k++)
+        {
+            if (kernel [k] == '/' || kernel [k] == '\\')
+            { 
+                name = kernel + k + 1 ;
+            }
+        }
+        len = strlen (name) - 2 ;
+    }
+    if (len >= GB_KLEN || strncmp (name, "GB_jit__", 8) != 0)
+    { 
+        // not a CPU JIT kernel
+        return (NULL) ;
+    }
+    for (size_t k = 0 ; k < len ; k++)
+    {
+        if (!(isalnum ((unsigned char) name [k]) || name [k] == '_'))
+        { 
+            // invalid kernel name
+            return (NULL) ;
+        }
+    }
+    memcpy (kernel_name, name, len) ;
+    kernel_name [len] = '\0' ;
+
+    //--------------------------------------------------------------------------
+    // open the source file
+    //--------------------------------------------------------------------------
+
+    FILE *fp = NULL ;
+    if (*is_path)
+    { 
+        fp = fopen (kernel, "r") ;
+    }
+    else
+    {
+        // search the 256 buckets of the cache folder for the kernel source
+        for (uint32_t bucket = 0 ; fp == NULL && bucket <= 0xFF ; bucket++)
+        { 
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+                GB_jit_cache_path, bucket, kernel_name) ;
+            fp = fopen (GB_jit_temp, "r") ;
+        }
+    }
+    if (fp == NULL)
+    { 
+        // source file not found
+        return (NULL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the source file and find its hash
+    //--------------------------------------------------------------------------
+
+    bool ok = (fseek (fp, 0, SEEK_END) == 0) ;
+    long size = ok ? ftell (fp) : -1 ;
+    ok = ok && (size > 0) && (fseek (fp, 0, SEEK_SET) == 0) ;
+    char *source = NULL ;
+    if (ok)
+    { 
+        GB_MALLOC_PERSISTENT (source, size + 1) ;
+        ok = (source != NULL) &&
+            (fread (source, 1, size, fp) == (size_t) size) ;
+    }
+    fclose (fp) ;
+    char *hash_string = NULL ;
+    if (ok)
+    { 
+        source [size] = '\0' ;
+        hash_string = strstr (source, "(*hash) = 0x") ;
+        ok = (hash_string != NULL) ;
+    }
+    if (ok)
+    { 
+        (*hash) = strtoull (hash_string + 12, NULL, 16) ;
+        ok = ((*hash) != 0 && (*hash) != UINT64_MAX) ;
+    }
+    if (!ok)
+    { 
+        // unable to read the source file, or it is not a JIT kernel
+        GB_FREE_PERSISTENT (source) ;
+        return (NULL) ;
+    }
+    (*source_size) = (size_t) size ;
+    return (source) ;
+
+#else
+    return (NULL) ;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_write_source: write the source of a kernel to a file
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_write_source
+(
+    const char *filename,
+    const char *source,
+    size_t source_size
+)
+{ 
+    FILE *fp = fopen (filename, "w") ;
+    bool ok = (fp != NULL) &&
+        (fwrite (source, 1, source_size, fp) == source_size) ;
+    if (fp != NULL) fclose (fp) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_warmup: compile a set of JIT kernels in parallel
+//------------------------------------------------------------------------------
+
+// Each kernels [k] is either the name of a CPU JIT kernel whose source file
+// is already in the cache folder, or the path of a kernel source file (see
+// GB_jitifyer_read_source), which is copied into the cache folder if it is not
+// already there.  Kernels whose lib*.so file already exists are skipped, and
+// so are kernels whose source cannot be found.  The rest are compiled with up
+// to ncompilers compiler processes at the same time, outside the critical
+// section.  The kernels are not loaded; they are loaded the first time they
+// are needed.  Returns GrB_NO_VALUE if the JIT control does not permit new
+// kernels to be compiled.
+
+GrB_Info GB_jitifyer_warmup
+(
+    // output:
+    int64_t *ncompiled,         // # of kernels compiled
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    int ncompilers              // max # of compilers to run at the same time
+)
+{ 
+
+    (*ncompiled) = 0 ;
+
+#ifndef NJIT
+
+    GrB_Info info = GrB_SUCCESS ;
+    char *commands = NULL ;
+    size_t command_size = 0 ;
+    int64_t ncommands = 0 ;
+
+    //--------------------------------------------------------------------------
+    // find the kernels to compile, and construct their commands
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        if (GB_jit_control < GxB_JIT_ON)
+        { 
+            // no new kernels may be compiled
+            info = GrB_NO_VALUE ;
+        }
+        else if (!GB_jit_use_cmake)
+        { 
+            // each command is constructed in its own part of the commands
+            // array, so the compilers can be run outside the critical section
+            command_size = GB_jit_temp_allocated ;
+            GB_MALLOC_PERSISTENT (commands, nkernels * command_size) ;
+            if (commands == NULL)
+            { 
+                info = GrB_OUT_OF_MEMORY ;
+            }
+        }
+
+        for (int64_t k = 0 ; info == GrB_SUCCESS && k < nkernels ; k++)
+        {
+            char kernel_name [GB_KLEN] ;
+            uint64_t hash = 0 ;
+            size_t source_size = 0 ;
+            bool is_path = false ;
+            char *source = (kernels [k] == NULL) ? NULL :
+                GB_jitifyer_read_source (kernel_name, &hash, &source_size,
+                    &is_path, kernels [k]) ;
+            if (source == NULL)
+            { 
+                GBURBLE ("(jit warmup: %s not found) ",
+                    (kernels [k] == NULL) ? "(null)" : kernels [k]) ;
+                continue ;
+            }
+
+            // copy the source file into the cache folder, if needed
+            uint32_t bucket = hash & 0xFF ;
+            bool ok = true ;
+            if (is_path)
+            { 
+                snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+                    GB_jit_cache_path, bucket, kernel_name) ;
+                if (strcmp (GB_jit_temp, kernels [k]) != 0)
+                { 
+                    ok = GB_jitifyer_write_source (GB_jit_temp, source,
+                        source_size) ;
+                }
+            }
+            GB_FREE_PERSISTENT (source) ;
+            if (!ok)
+            { 
+                GBURBLE ("(jit warmup: %s not copied) ", kernels [k]) ;
+                continue ;
+            }
+
+            // skip the kernel if it has already been compiled
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x/%s%s%s",
+                GB_jit_cache_path, GB_jit_lib_folder, bucket, GB_LIB_PREFIX,
+                kernel_name, GB_LIB_SUFFIX) ;
+            FILE *fp = fopen (GB_jit_temp, "r") ;
+            if (fp != NULL)
+            { 
+                fclose (fp) ;
+                continue ;
+            }
+
+            // the new kernel has not been tuned
+            GB_jitifyer_tune_file (kernel_name, bucket) ;
+            remove (GB_jit_temp) ;
+
+            if (GB_jit_use_cmake)
+            { 
+                // cmake uses a build folder that depends only on the hash,
+                // which is not safe for parallel compilation
+                GB_jitifyer_cmake_compile (kernel_name, hash) ;
+                (*ncompiled)++ ;
+            }
+            else
+            { 
+                // compile with private *.o and lib*.so files, since other
+                // threads and processes may be compiling the same kernel
+                GB_jitifyer_direct_command (commands + ncommands*command_size,
+                    command_size, kernel_name, bucket, true, false) ;
+                ncommands++ ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // run the compilers in parallel
+    //--------------------------------------------------------------------------
+
+    if (ncommands > 0)
+    { 
+        GBURBLE ("(jit warmup: compiling %" PRId64 " kernels) ", ncommands) ;
+        int ncomp = (int) GB_IMIN (ncompilers, ncommands) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(ncomp) schedule(dynamic,1)
+        for (k = 0 ; k < ncommands ; k++)
+        { 
+            // OK: see security comment above
+            GB_jitifyer_command (commands + k*command_size) ;
+        }
+        (*ncompiled) = ncommands ;
+    }
+
+    GB_FREE_PERSISTENT (commands) ;
+    return (info) ;
+
+#else
+    return (GrB_NOT_IMPLEMENTED) ;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_export: copy the sources of a set of JIT kernels to a folder
+//------------------------------------------------------------------------------
+
+// Each kernels [k] is a kernel name or the path of a kernel source file, as
+// for GB_jitifyer_warmup.  The source of each kernel is written to
+// folder/kernel_name.c, with no subfolders, as required for the PreJIT folder.
+// Kernels whose source cannot be found are skipped.  Returns
+// GrB_INVALID_VALUE if a source file cannot be written to the folder.
+
+GrB_Info GB_jitifyer_export
+(
+    // output:
+    int64_t *nexported,         // # of kernels exported
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *folder          // folder to write the kernels to
+)
+{ 
+
+    (*nexported) = 0 ;
+
+#ifndef NJIT
+
+    GrB_Info info = GrB_SUCCESS ;
+    char *filename = NULL ;
+    size_t filename_size = strlen (folder) + GB_KLEN + 4 ;
+    GB_MALLOC_PERSISTENT (filename, filename_size) ;
+    if (filename == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        for (int64_t k = 0 ; info == GrB_SUCCESS && k < nkernels ; k++)
+        {
+            char kernel_name [GB_KLEN] ;
+            uint64_t hash = 0 ;
+            size_t source_size = 0 ;
+            bool is_path = false ;
+            char *source = (kernels [k] == NULL) ? NULL :
+                GB_jitifyer_read_source (kernel_name, &hash, &source_size,
+                    &is_path, kernels [k]) ;
+            if (source == NULL)
+            { 
+                GBURBLE ("(jit export: %s not found) ",
+                    (kernels [k] == NULL) ? "(null)" : kernels [k]) ;
+                continue ;
+            }
+            snprintf (filename, filename_size, "%s/%s.c", folder,
+                kernel_name) ;
+            if (GB_jitifyer_write_source (filename, source, source_size))
+            { 
+                (*nexported)++ ;
+            }
+            else
+            { 
+                // unable to write to the folder
+                info = GrB_INVALID_VALUE ;
+            }
+            GB_FREE_PERSISTENT (source) ;
+        }
+    }
+
+    GB_FREE_PERSISTENT (filename) ;
+    return (info) ;
+
+#else
+    return (GrB_NOT_IMPLEMENTED) ;
 #endif
 }
 
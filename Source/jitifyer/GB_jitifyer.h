@@ -13,7 +13,7 @@
 #include "jit_kernels/include/GB_jit_kernel_proto.h"
 
 //------------------------------------------------------------------------------
-// get list of PreJIT kernels: function pointers and names
+// get list of PreJIT kernels: function pointers, names, and hashes
 //------------------------------------------------------------------------------
 
 void GB_prejit
@@ -21,7 +21,8 @@ void GB_prejit
     int32_t *nkernels,      // return # of kernels
     void ***Kernel_handle,  // return list of function pointers to kernels
     void ***Query_handle,   // return list of function pointers to queries
-    char ***Name_handle     // return list of kernel names
+    char ***Name_handle,    // return list of kernel names
+    uint64_t **Hash_handle  // return list of kernel hashes, in ascending order
 ) ;
 
 //------------------------------------------------------------------------------
@@ -211,8 +212,7 @@ struct GB_jit_encoding_struct
 
 typedef struct GB_jit_encoding_struct GB_jit_encoding ;
 
-// prejit_index could be int32_t, but making it int64_t rounds up the size of
-// the GB_jit_entry_struct to a multiple of 8 (56 bytes):
+// The GB_jit_entry_struct is 64 bytes:
 
 struct GB_jit_entry_struct
 {
@@ -222,8 +222,10 @@ struct GB_jit_entry_struct
                                 // NULL for built-in kernels
     void *dl_handle ;           // handle from dlopen, to be passed to dlclose
     void *dl_function ;         // address of kernel function
-    int64_t prejit_index ;      // -1: JIT kernel or checked PreJIT kernel
+    void *dl_tuned_handle ;     // handle of the tuned kernel, if any
+    int32_t prejit_index ;      // -1: JIT kernel or checked PreJIT kernel
                                 // >= 0: index of unchecked PreJIT kernel.
+    int32_t tuned ;             // true if the kernel has been tuned
 } ;
 
 typedef struct GB_jit_entry_struct GB_jit_entry ;
@@ -330,6 +332,32 @@ uint64_t GB_jitifyer_hash
     bool jitable            // true if the object can be JIT'd
 ) ;
 
+// to run a kernel on the inputs of a problem, for GB_jitifyer_tune_panel
+typedef GrB_Info (*GB_jit_trial_func) (void *dl_function, void *trial_args) ;
+
+void GB_jitifyer_tune_panel
+(
+    // input/output:
+    void **dl_function,         // kernel from GB_jitifyer_load on input;
+                                // the tuned kernel on output
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    // operator definitions, for the kernel_name
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    // tuning parameter:
+    const char *param,          // name of the tuning parameter
+    const int *values,          // values of the parameter to try
+    int nvalues,                // # of values to try
+    GB_jit_trial_func trial,    // runs a kernel on the inputs of the problem
+    void *trial_args            // inputs of the problem, for trial
+) ;
+
 // to query a library for its type and operator definitions
 typedef GB_JIT_QUERY_PROTO ((*GB_jit_query_func)) ;
 
@@ -348,9 +376,48 @@ bool GB_jitifyer_query
 ) ;
 
 void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash) ;
-void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket) ;
+void GB_jitifyer_direct_compile
+(
+    char *kernel_name,
+    uint32_t bucket,
+    bool async              // if true, compile in a background process
+) ;
 void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket) ;
 
+GrB_Info GB_jitifyer_warmup
+(
+    // output:
+    int64_t *ncompiled,         // # of kernels compiled
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    int ncompilers              // max # of compilers to run at the same time
+) ;
+
+GrB_Info GB_jitifyer_export
+(
+    // output:
+    int64_t *nexported,         // # of kernels exported
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *folder          // folder to write the kernels to
+) ;
+
+GrB_Info GB_jitifyer_kernel_list
+(
+    // output:
+    const char ***list,         // list of kernels
+    size_t *list_size,
+    int64_t *nlist,             // # of kernels in the list
+    char **text,                // contents of the manifest
+    size_t *text_size,
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest        // manifest file, or NULL if none
+) ;
+
 GrB_Info GB_jitifyer_init (void) ;  // initialize the JIT
 
 GrB_Info GB_jitifyer_establish_paths (GrB_Info error_condition) ;
@@ -403,9 +470,20 @@ GrB_Info GB_jitifyer_set_CUDA_preface_worker (const char *new_CUDA_preface) ;
 const char *GB_jitifyer_get_error_log (void) ;
 GrB_Info GB_jitifyer_set_error_log (const char *new_error_log) ;
 GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log) ;
+const char *GB_jitifyer_get_record_file (void) ;
+GrB_Info GB_jitifyer_copy_record_file
+(
+    char **record_file,         // copy of the record file
+    size_t *record_file_size    // size of the copy
+) ;
+GrB_Info GB_jitifyer_set_record_file (const char *new_record_file) ;
 
 bool GB_jitifyer_get_use_cmake (void) ;
 void GB_jitifyer_set_use_cmake (bool use_cmake) ;
+bool GB_jitifyer_get_async (void) ;
+void GB_jitifyer_set_async (bool async) ;
+bool GB_jitifyer_get_tune_reduce_panel (void) ;
+void GB_jitifyer_set_tune_reduce_panel (bool tune) ;
 
 void GB_jitifyer_sanitize (char *string, size_t len) ;
 
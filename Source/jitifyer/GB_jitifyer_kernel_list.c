@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_list: construct a list of JIT kernels from a manifest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The list of kernels for GxB_JIT_warmup and GxB_JIT_export is the
+// concatenation of the kernels [0..nkernels-1] array and the lines of the
+// manifest file, if any.  The manifest is a text file with one kernel name or
+// kernel source file per line, such as the GxB_JIT_RECORD_FILE.  Leading and
+// trailing white space is ignored, as are blank lines and lines that start
+// with '#'.  The entries of the list from the manifest point into the text
+// array, so the caller must free both list and text with GB_FREE_WORK when
+// done.
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+#include <ctype.h>
+
+GrB_Info GB_jitifyer_kernel_list
+(
+    // output:
+    const char ***list,         // list of kernels
+    size_t *list_size,
+    int64_t *nlist,             // # of kernels in the list
+    char **text,                // contents of the manifest
+    size_t *text_size,
+    // input:
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest        // manifest file, or NULL if none
+)
+{ 
+
+    (*list) = NULL ; (*list_size) = 0 ; (*nlist) = 0 ;
+    (*text) = NULL ; (*text_size) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the manifest
+    //--------------------------------------------------------------------------
+
+    int64_t nlines = 0 ;
+    if (manifest != NULL)
+    {
+        FILE *fp = fopen (manifest, "r") ;
+        if (fp == NULL)
+        { 
+            // manifest not found
+            return (GrB_INVALID_VALUE) ;
+        }
+        bool ok = (fseek (fp, 0, SEEK_END) == 0) ;
+        long len = ok ? ftell (fp) : -1 ;
+        ok = ok && (len >= 0) && (fseek (fp, 0, SEEK_SET) == 0) ;
+        if (ok)
+        { 
+            (*text) = GB_MALLOC_WORK (len + 1, char, text_size) ;
+            if ((*text) == NULL)
+            { 
+                // out of memory
+                fclose (fp) ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            ok = (fread ((*text), 1, len, fp) == (size_t) len) ;
+        }
+        fclose (fp) ;
+        if (!ok)
+        { 
+            // unable to read the manifest
+            GB_FREE_WORK (text, *text_size) ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        (*text) [len] = '\0' ;
+        for (long k = 0 ; k < len ; k++)
+        { 
+            nlines += ((*text) [k] == '\n') ;
+        }
+        nlines++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the list of kernels
+    //--------------------------------------------------------------------------
+
+    (*list) = GB_MALLOC_WORK (nkernels + nlines + 1, const char *, list_size) ;
+    if ((*list) == NULL)
+    { 
+        // out of memory
+        GB_FREE_WORK (text, *text_size) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    if (nkernels > 0)
+    { 
+        memcpy ((*list), kernels, nkernels * sizeof (const char *)) ;
+    }
+    int64_t n = nkernels ;
+
+    char *line = (*text) ;
+    while (line != NULL)
+    {
+        // split the manifest into lines, trimming any leading and trailing
+        // white space
+        char *next = strchr (line, '\n') ;
+        if (next != NULL)
+        { 
+            (*next++) = '\0' ;
+        }
+        while (isspace ((unsigned char) *line))
+        { 
+            line++ ;
+        }
+        size_t len = strlen (line) ;
+        while (len > 0 && isspace ((unsigned char) line [len-1]))
+        { 
+            line [--len] = '\0' ;
+        }
+        if (len > 0 && line [0] != '#')
+        { 
+            (*list) [n++] = line ;
+        }
+        line = next ;
+    }
+
+    (*nlist) = n ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -171,7 +171,8 @@ void GB_macrofy_reduce      // construct all macros for GrB_reduce to scalar
         }
     }
 
-    fprintf (fp, "#define GB_PANEL %d\n", panel) ;
+    // the panel size can be changed by GB_jitifyer_tune_panel
+    fprintf (fp, "#ifndef GB_PANEL\n#define GB_PANEL %d\n#endif\n", panel) ;
 
     //--------------------------------------------------------------------------
     // include the final default definitions
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_export: copy the sources of a set of JIT kernels to a PreJIT folder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_export writes the source files of a set of CPU JIT kernels into a
+// single folder, such as GraphBLAS/PreJIT.  When GraphBLAS is recompiled with
+// these kernels in its PreJIT folder, they are compiled into the GraphBLAS
+// library itself, and are no longer compiled at run time.
+
+// The kernels are given as for GxB_JIT_warmup: in the kernels [0..nkernels-1]
+// list, or in a manifest file, or both.  If neither is given, the
+// GxB_JIT_RECORD_FILE is used as the manifest, which lists every CPU JIT
+// kernel loaded while the record file was set.  Kernels whose source cannot be
+// found are skipped.  The folder must already exist.  Returns
+// GrB_INVALID_VALUE if the manifest cannot be read or if a source file cannot
+// be written to the folder.
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORK (&list, list_size) ;               \
+    GB_FREE_WORK (&text, text_size) ;               \
+    GB_FREE_WORK (&record_file, record_file_size) ; \
+}
+
+GrB_Info GxB_JIT_export
+(
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest,       // manifest file, or NULL if none
+    const char *folder          // folder to write the kernel sources to
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_JIT_export (kernels, nkernels, manifest, folder)") ;
+    GB_RETURN_IF_NULL (folder) ;
+    if (nkernels > 0)
+    { 
+        GB_RETURN_IF_NULL (kernels) ;
+    }
+    nkernels = GB_IMAX (nkernels, 0) ;
+
+    #ifdef NJIT
+    // the JIT is disabled at compile time
+    return (GrB_NOT_IMPLEMENTED) ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // construct the list of kernels
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    const char **list = NULL ; size_t list_size = 0 ;
+    char *text = NULL ; size_t text_size = 0 ;
+    char *record_file = NULL ; size_t record_file_size = 0 ;
+    int64_t nlist = 0 ;
+    if (nkernels == 0 && manifest == NULL)
+    { 
+        // export the kernels listed in the record file.  Another user thread
+        // may set a new record file at any time, so use a copy of it.
+        GB_OK (GB_jitifyer_copy_record_file (&record_file,
+            &record_file_size)) ;
+        if (strlen (record_file) == 0)
+        { 
+            // no kernels to export
+            GB_FREE_ALL ;
+            return (GrB_SUCCESS) ;
+        }
+        manifest = record_file ;
+    }
+    GB_OK (GB_jitifyer_kernel_list (&list, &list_size, &nlist, &text,
+        &text_size, kernels, nkernels, manifest)) ;
+
+    //--------------------------------------------------------------------------
+    // export the kernels
+    //--------------------------------------------------------------------------
+
+    int64_t nexported ;
+    info = GB_jitifyer_export (&nexported, list, nlist, folder) ;
+    GBURBLE ("(jit export: %" PRId64 " of %" PRId64 " kernels exported) ",
+        nexported, nlist) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (info) ;
+    #endif
+}
+
@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_warmup: compile a set of JIT kernels in parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_warmup compiles a set of CPU JIT kernels ahead of time, running up
+// to ncompilers compiler processes at the same time.  The kernels are given
+// in the kernels [0..nkernels-1] list, or in a manifest file, or both.  The
+// manifest is a text file with one kernel per line.  Blank lines and lines
+// that start with '#' are ignored.
+
+// Each kernel is either the name of a JIT kernel (such as
+// "GB_jit__AxB_dot3__..."), whose source file is already in the JIT cache
+// folder, or the path to a kernel source file ending in ".c", such as one from
+// the cache folder of another installation.  A source file from outside the
+// cache folder is copied into it.  The kernel name encodes the operation, the
+// operators, types, and sparsity formats of the kernel.  Kernels that have
+// already been compiled are skipped, as are kernels whose source cannot be
+// found.  The kernels are not loaded, but are loaded the first time they are
+// needed.
+
+// If ncompilers is zero or less, the # of threads given by GxB_NTHREADS is
+// used.  If the JIT uses cmake to compile its kernels (GxB_JIT_USE_CMAKE),
+// the kernels are compiled one at a time.  Returns GrB_NO_VALUE if the JIT
+// control is not GxB_JIT_ON, and GrB_INVALID_VALUE if the manifest cannot be
+// read.  The JIT control is not modified if any kernel fails to compile.
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORK (&list, list_size) ;               \
+    GB_FREE_WORK (&text, text_size) ;               \
+}
+
+GrB_Info GxB_JIT_warmup
+(
+    const char **kernels,       // list of kernel names or source files
+    int64_t nkernels,           // size of the kernels list
+    const char *manifest,       // manifest file, or NULL if none
+    int32_t ncompilers          // max # of compilers to run at the same time
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_JIT_warmup (kernels, nkernels, manifest, ncompilers)") ;
+    if (nkernels > 0)
+    { 
+        GB_RETURN_IF_NULL (kernels) ;
+    }
+    nkernels = GB_IMAX (nkernels, 0) ;
+    if (ncompilers <= 0)
+    { 
+        ncompilers = GB_Context_nthreads_max ( ) ;
+    }
+
+    #ifdef NJIT
+    // the JIT is disabled at compile time
+    return (GrB_NOT_IMPLEMENTED) ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // construct the list of kernels
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    const char **list = NULL ; size_t list_size = 0 ;
+    char *text = NULL ; size_t text_size = 0 ;
+    int64_t nlist = 0 ;
+    GB_OK (GB_jitifyer_kernel_list (&list, &list_size, &nlist, &text,
+        &text_size, kernels, nkernels, manifest)) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernels
+    //--------------------------------------------------------------------------
+
+    int64_t ncompiled ;
+    info = GB_jitifyer_warmup (&ncompiled, list, nlist, ncompilers) ;
+    GBURBLE ("(jit warmup: %" PRId64 " of %" PRId64 " kernels compiled) ",
+        ncompiled, nlist) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (info) ;
+    #endif
+}
+
@@ -79,6 +79,47 @@
     found = (pleft == pright && X [pleft] == i) ;                           \
 }
 
+//------------------------------------------------------------------------------
+// GB_TRIM_GALLOP_SEARCH: galloping (exponential) search
+//------------------------------------------------------------------------------
+
+// Same as GB_TRIM_BINARY_SEARCH, except that the search starts at X [pleft]
+// and probes X [pleft+1], X [pleft+2], X [pleft+4], ... until an entry >= i is
+// found, and then does a binary search of that last gap.  The time is
+// O(log(d)) where d is the distance from pleft to the result, instead of
+// O(log(pright-pleft)).  This is faster when searching for a sequence of
+// increasing values of i in a long list, as in the intersection of a short
+// list with a long one.  On output, pright is the end of the last gap, not
+// the original pright.
+
+#define GB_TRIM_GALLOP_SEARCH(i,X,pleft,pright)                             \
+{                                                                           \
+    /* galloping search of X [pleft ... pright] for integer i */            \
+    if (pleft < pright)                                                     \
+    {                                                                       \
+        int64_t gstep = 1 ;                                                 \
+        int64_t gright = pleft ;                                            \
+        while (gright < pright && X [gright] < i)                           \
+        {                                                                   \
+            /* X [pleft ... gright] < i, so skip them */                    \
+            pleft = gright + 1 ;                                            \
+            gright = GB_IMIN (gright + gstep, pright) ;                     \
+            gstep = gstep << 1 ;                                            \
+        }                                                                   \
+        pright = gright ;                                                   \
+    }                                                                       \
+    /* binary search of X [pleft ... pright] */                             \
+    GB_TRIM_BINARY_SEARCH (i, X, pleft, pright) ;                           \
+}
+
+// GB_GALLOP_SEARCH: galloping search and check if found, with the same
+// result as GB_BINARY_SEARCH.
+#define GB_GALLOP_SEARCH(i,X,pleft,pright,found)                            \
+{                                                                           \
+    GB_TRIM_GALLOP_SEARCH (i, X, pleft, pright) ;                           \
+    found = (pleft == pright && X [pleft] == i) ;                           \
+}
+
 //------------------------------------------------------------------------------
 // GB_SPLIT_BINARY_SEARCH: binary search, and then partition the list
 //------------------------------------------------------------------------------
@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+// GB_intersect.h: find the next common entry in two sorted index lists
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_intersect_next advances px and py to the next pair with X [px] == Y [py],
+// where X [px ... px_end-1] and Y [py ... py_end-1] are two lists of row
+// indices, each in ascending order with no duplicates.  It returns true if
+// such a pair is found, or false if either list is exhausted.  The caller
+// handles the pair, increments both px and py, and calls it again.  This is
+// the inner loop of a sparse dot product (dot2 and dot3) and of C=A.*B when
+// A(:,j) and B(:,j) are both sparse with about the same number of entries
+// (emult_08).
+
+// The AVX2 and AVX512F variants compare a block of 4 or 8 entries of X with a
+// block of the same size in Y, all at once.  If no pair in the two blocks
+// matches, the block (or both blocks) with the smallest last entry is
+// discarded.  If a match is found, the first match in X is returned, which
+// is also the next match in the scalar merge, so the pairs are found in the
+// same order.  This is much faster than the scalar merge when the two lists
+// have few entries in common, as is typical of triangle counting and k-truss
+// with C<L>=L*L'.  The method is selected at run time from the cpu features,
+// by GB_DECLARE_INTERSECT_METHOD.  JIT kernels do not have access to
+// GB_Global, so they query the cpu directly.
+
+// The caller should only use GB_intersect_next when the lists have about the
+// same length.  If one list is much shorter than the other, galloping search
+// (GB_TRIM_GALLOP_SEARCH in GB_binary_search.h) is faster.
+
+#ifndef GB_INTERSECT_H
+#define GB_INTERSECT_H
+
+#define GB_INTERSECT_SCALAR  0
+#define GB_INTERSECT_AVX2    1
+#define GB_INTERSECT_AVX512F 2
+
+//------------------------------------------------------------------------------
+// GB_DECLARE_INTERSECT_METHOD: determine which method to use
+//------------------------------------------------------------------------------
+
+// The block compares require gcc vector extensions and x86 builtins, which
+// are supported by gcc, clang, and icx.
+#if GB_COMPILER_SUPPORTS_AVX2 && \
+    (GB_COMPILER_GCC || GB_COMPILER_CLANG || GB_COMPILER_ICX)
+    #define GB_INTERSECT_HAS_SIMD 1
+#else
+    #define GB_INTERSECT_HAS_SIMD 0
+#endif
+
+#if !GB_INTERSECT_HAS_SIMD
+    #define GB_INTERSECT_CPU_HAS_AVX2    false
+    #define GB_INTERSECT_CPU_HAS_AVX512F false
+#elif defined ( GB_JIT_KERNEL )
+    #define GB_INTERSECT_CPU_HAS_AVX2    __builtin_cpu_supports ("avx2")
+    #define GB_INTERSECT_CPU_HAS_AVX512F                                    \
+        (GB_COMPILER_SUPPORTS_AVX512F && __builtin_cpu_supports ("avx512f"))
+#else
+    #define GB_INTERSECT_CPU_HAS_AVX2    GB_Global_cpu_features_avx2 ( )
+    #define GB_INTERSECT_CPU_HAS_AVX512F                                    \
+        (GB_COMPILER_SUPPORTS_AVX512F && GB_Global_cpu_features_avx512f ( ))
+#endif
+
+#define GB_DECLARE_INTERSECT_METHOD(method)                                 \
+    int method = GB_INTERSECT_CPU_HAS_AVX512F ? GB_INTERSECT_AVX512F :      \
+                (GB_INTERSECT_CPU_HAS_AVX2    ? GB_INTERSECT_AVX2    :      \
+                                                GB_INTERSECT_SCALAR)
+
+//------------------------------------------------------------------------------
+// GB_intersect_next_scalar: linear-time merge
+//------------------------------------------------------------------------------
+
+static inline bool GB_intersect_next_scalar
+(
+    const int64_t *restrict X, int64_t *px, const int64_t px_end,
+    const int64_t *restrict Y, int64_t *py, const int64_t py_end
+)
+{
+    int64_t p = (*px) ;
+    int64_t q = (*py) ;
+    while (p < px_end && q < py_end)
+    {
+        int64_t x = X [p] ;
+        int64_t y = Y [q] ;
+        if (x < y)
+        {
+            // X [p] is not in Y
+            p++ ;
+        }
+        else if (y < x)
+        {
+            // Y [q] is not in X
+            q++ ;
+        }
+        else
+        {
+            // X [p] == Y [q]
+            (*px) = p ;
+            (*py) = q ;
+            return (true) ;
+        }
+    }
+    (*px) = p ;
+    (*py) = q ;
+    return (false) ;
+}
+
+//------------------------------------------------------------------------------
+// vector types for the AVX2 and AVX512F methods
+//------------------------------------------------------------------------------
+
+// The block compares use gcc vector extensions, as does the saxpy5 method,
+// rather than <immintrin.h>, which would add about half a second to the
+// compile time of each JIT kernel.  The movmskpd builtin (AVX) gets a bit
+// mask of the 4 lanes of a 256-bit vector.
+
+#if GB_INTERSECT_HAS_SIMD
+
+typedef int64_t GB_intersect_v4 __attribute__ ((vector_size (4 *
+    sizeof (int64_t)), aligned (sizeof (int64_t)))) ;
+typedef double GB_intersect_v4d __attribute__ ((vector_size (4 *
+    sizeof (double)))) ;
+typedef int64_t GB_intersect_v8 __attribute__ ((vector_size (8 *
+    sizeof (int64_t)), aligned (sizeof (int64_t)))) ;
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_intersect_next_avx512f: compare blocks of 8 entries
+//------------------------------------------------------------------------------
+
+#if GB_INTERSECT_HAS_SIMD && GB_COMPILER_SUPPORTS_AVX512F
+
+GB_TARGET_AVX512F static inline bool GB_intersect_next_avx512f
+(
+    const int64_t *restrict X, int64_t *px, const int64_t px_end,
+    const int64_t *restrict Y, int64_t *py, const int64_t py_end
+)
+{
+    int64_t p = (*px) ;
+    int64_t q = (*py) ;
+    while (p + 8 <= px_end && q + 8 <= py_end)
+    {
+        // compare X [p:p+7] with each entry in Y [q:q+7]
+        GB_intersect_v8 x = *((GB_intersect_v8 *) (X + p)) ;
+        union { GB_intersect_v8 v ; GB_intersect_v4 h [2] ; } m ;
+        m.v = (x == Y [q  ]) | (x == Y [q+1]) | (x == Y [q+2]) | (x == Y [q+3])
+            | (x == Y [q+4]) | (x == Y [q+5]) | (x == Y [q+6]) | (x == Y [q+7]);
+        if (__builtin_ia32_movmskpd256 ((GB_intersect_v4d) (m.h [0] | m.h [1])))
+        {
+            // X [p+k] is the first entry in X [p:p+7] also in Y [q:q+7]
+            int k = 0 ;
+            while (!m.v [k]) k++ ;
+            p += k ;
+            while (Y [q] != X [p]) q++ ;
+            (*px) = p ;
+            (*py) = q ;
+            return (true) ;
+        }
+        // discard the block(s) with the smallest last entry
+        int64_t xlast = X [p+7] ;
+        int64_t ylast = Y [q+7] ;
+        p += (xlast <= ylast) ? 8 : 0 ;
+        q += (ylast <= xlast) ? 8 : 0 ;
+    }
+    (*px) = p ;
+    (*py) = q ;
+    return (GB_intersect_next_scalar (X, px, px_end, Y, py, py_end)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_intersect_next_avx2: compare blocks of 4 entries
+//------------------------------------------------------------------------------
+
+#if GB_INTERSECT_HAS_SIMD
+
+GB_TARGET_AVX2 static inline bool GB_intersect_next_avx2
+(
+    const int64_t *restrict X, int64_t *px, const int64_t px_end,
+    const int64_t *restrict Y, int64_t *py, const int64_t py_end
+)
+{
+    int64_t p = (*px) ;
+    int64_t q = (*py) ;
+    while (p + 4 <= px_end && q + 4 <= py_end)
+    {
+        // compare X [p:p+3] with each entry in Y [q:q+3]
+        GB_intersect_v4 x = *((GB_intersect_v4 *) (X + p)) ;
+        GB_intersect_v4 m = (x == Y [q  ]) | (x == Y [q+1])
+                          | (x == Y [q+2]) | (x == Y [q+3]) ;
+        int mask = __builtin_ia32_movmskpd256 ((GB_intersect_v4d) m) ;
+        if (mask != 0)
+        {
+            // X [p+k] is the first entry in X [p:p+3] also in Y [q:q+3]
+            p += __builtin_ctz (mask) ;
+            while (Y [q] != X [p]) q++ ;
+            (*px) = p ;
+            (*py) = q ;
+            return (true) ;
+        }
+        // discard the block(s) with the smallest last entry
+        int64_t xlast = X [p+3] ;
+        int64_t ylast = Y [q+3] ;
+        p += (xlast <= ylast) ? 4 : 0 ;
+        q += (ylast <= xlast) ? 4 : 0 ;
+    }
+    (*px) = p ;
+    (*py) = q ;
+    return (GB_intersect_next_scalar (X, px, px_end, Y, py, py_end)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_intersect_next: find the next common entry, using the selected method
+//------------------------------------------------------------------------------
+
+static inline bool GB_intersect_next
+(
+    const int method,
+    const int64_t *restrict X, int64_t *px, const int64_t px_end,
+    const int64_t *restrict Y, int64_t *py, const int64_t py_end
+)
+{
+    #if GB_INTERSECT_HAS_SIMD && GB_COMPILER_SUPPORTS_AVX512F
+    if (method == GB_INTERSECT_AVX512F &&
+        px_end - (*px) >= 8 && py_end - (*py) >= 8)
+    {
+        return (GB_intersect_next_avx512f (X, px, px_end, Y, py, py_end)) ;
+    }
+    #endif
+    #if GB_INTERSECT_HAS_SIMD
+    if (method != GB_INTERSECT_SCALAR &&
+        px_end - (*px) >= 4 && py_end - (*py) >= 4)
+    {
+        return (GB_intersect_next_avx2 (X, px, px_end, Y, py, py_end)) ;
+    }
+    #endif
+    return (GB_intersect_next_scalar (X, px, px_end, Y, py, py_end)) ;
+}
+
+#endif
+
@@ -25,6 +25,7 @@ void GB_Matrix_free             // free a matrix
         {
             // free all content of A
             GB_FREE (&(A->user_name), A->user_name_size) ;
+            GB_Concurrent_free (&(A->concurrent)) ;
             size_t header_size = A->header_size ;
             GB_phybix_free (A) ;
             if (!(A->static_header))
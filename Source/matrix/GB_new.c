@@ -162,6 +162,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
+    A->shared = NULL ;
 
     A->nvals = 0 ;
     A->nzombies = 0 ;
@@ -169,6 +170,10 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->Pending = NULL ;
     A->iso = false ;            // OK: if iso, burble in the caller
 
+    // GxB_CONCURRENT_SETELEMENT is disabled
+    A->concurrent = NULL ;
+    A->concurrent_pending = false ;
+
     //--------------------------------------------------------------------------
     // Allocate A->p and A->h if requested
     //--------------------------------------------------------------------------
@@ -23,6 +23,7 @@ void GB_phybix_free             // free all content of a matrix
     { 
         GB_phy_free (A) ;           // free A->p, A->h, and A->Y
         GB_bix_free (A) ;           // free A->b, A->i, and A->x
+        GB_shared_free (A) ;        // release any arrays shared with A
         GB_FREE (&(A->logger), A->logger_size) ;        // free the error logger
     }
 }
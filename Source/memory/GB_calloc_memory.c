@@ -27,7 +27,17 @@ static inline void *GB_calloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // get a block from the memory pool, if it is enabled, or malloc a new one
+    p = GB_memory_pool_get (size) ;
+    if (p == NULL)
+    {
+        // use huge pages for a large block, if they are enabled
+        p = GB_memory_huge_pages_malloc (*size) ;
+        if (p == NULL)
+        { 
+            p = GB_Global_malloc_function (*size) ;
+        }
+    }
 
     #ifdef GB_MEMDUMP
     printf ("hard calloc %p %ld\n", p, *size) ; // MEMDUMP
@@ -35,10 +45,19 @@ static inline void *GB_calloc_helper
     #endif
 
     if (p != NULL)
-    { 
-        // clear the block of memory with a parallel memset
+    {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        GB_memset (p, 0, (*size), nthreads_max) ;
+        if ((*size) >= GB_FIRST_TOUCH_MIN && GB_Context_numa_first_touch ( ))
+        { 
+            // clear the block with each thread setting its own slice to zero,
+            // to spread its pages across the NUMA nodes
+            GB_memory_first_touch (p, (*size), true, nthreads_max) ;
+        }
+        else
+        { 
+            // clear the block of memory with a parallel memset
+            GB_memset (p, 0, (*size), nthreads_max) ;
+        }
     }
 
     return (p) ;
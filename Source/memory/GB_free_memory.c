@@ -10,7 +10,8 @@
 // A wrapper for free.  If p is NULL on input, it is not freed.
 
 // The memory is freed using the free() function pointer passed in to GrB_init,
-// which is typically the ANSI C free function.
+// which is typically the ANSI C free function, unless the block is kept in the
+// memory pool (see GB_memory_pool.c).
 
 #include "GB.h"
 
@@ -22,7 +23,11 @@ GB_CALLBACK_FREE_MEMORY_PROTO (GB_free_memory)
         #ifdef GB_MEMDUMP
         printf ("\nhard free %p %ld\n", *p, size_allocated) ;   // MEMDUMP
         #endif
-        GB_Global_free_function (*p) ;
+        if (!GB_memory_pool_put (*p, size_allocated))
+        { 
+            // the block is not kept in the memory pool
+            GB_Global_free_function (*p) ;
+        }
         #ifdef GB_MEMDUMP
         GB_Global_memtable_dump ( ) ;
         #endif
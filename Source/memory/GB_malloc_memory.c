@@ -27,7 +27,24 @@ static inline void *GB_malloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // get a block from the memory pool, if it is enabled, or malloc a new one
+    p = GB_memory_pool_get (size) ;
+    if (p == NULL)
+    {
+        // use huge pages for a large block, if they are enabled
+        p = GB_memory_huge_pages_malloc (*size) ;
+        if (p == NULL)
+        { 
+            p = GB_Global_malloc_function (*size) ;
+        }
+        if (p != NULL && (*size) >= GB_FIRST_TOUCH_MIN &&
+            GB_Context_numa_first_touch ( ))
+        { 
+            // spread the pages of a large new block across the NUMA nodes
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            GB_memory_first_touch (p, (*size), false, nthreads_max) ;
+        }
+    }
 
     #ifdef GB_MEMDUMP
     printf ("hard malloc %p %ld\n", p, *size) ; // MEMDUMP
@@ -54,6 +54,73 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+//------------------------------------------------------------------------------
+// memory pool
+//------------------------------------------------------------------------------
+
+void *GB_memory_pool_get    // get a block from the pool, or NULL if none
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested; on output:
+                            // # of bytes to allocate if no block is returned
+) ;
+
+bool GB_memory_pool_put     // return true if the block is kept in the pool
+(
+    void *p,                // block to free
+    size_t size             // size of the block
+) ;
+
+size_t GB_memory_pool_round (size_t size) ;
+
+void GB_memory_pool_import (void *p, size_t size) ;
+bool GB_memory_pool_forget (void *p) ;
+
+void GB_memory_pool_flush (void) ;
+void GB_memory_pool_finalize (void) ;
+
+void    GB_memory_pool_control_set (bool control) ;
+bool    GB_memory_pool_control_get (void) ;
+void    GB_memory_pool_max_bytes_set (int64_t max_bytes) ;
+int64_t GB_memory_pool_max_bytes_get (void) ;
+void    GB_memory_pool_limits_set (const int64_t *limits) ;
+void    GB_memory_pool_limits_get (int64_t *limits) ;
+void    GB_memory_pool_stats_get (int64_t *stats) ;
+void    GB_memory_pool_stats_clear (void) ;
+
+//------------------------------------------------------------------------------
+// transparent huge pages
+//------------------------------------------------------------------------------
+
+// If GxB_MEMORY_HUGE_PAGES is true, new blocks of at least GB_HUGE_PAGE_MIN
+// bytes are aligned to 2MB and held in transparent huge pages.
+#define GB_HUGE_PAGE_MIN (2*1024*1024)
+
+void *GB_memory_huge_pages_malloc   // allocate a block with huge pages
+(
+    size_t size             // # of bytes to allocate
+) ;
+
+void GB_memory_huge_pages_control_set (bool control) ;
+bool GB_memory_huge_pages_control_get (void) ;
+
+//------------------------------------------------------------------------------
+// NUMA first touch
+//------------------------------------------------------------------------------
+
+// If GxB_NUMA_FIRST_TOUCH is true, new blocks of at least GB_FIRST_TOUCH_MIN
+// bytes are first touched in parallel by GB_malloc_memory and
+// GB_calloc_memory.
+#define GB_FIRST_TOUCH_MIN (2*1024*1024)
+
+void GB_memory_first_touch      // first touch a block in parallel
+(
+    void *p,                    // block to touch
+    size_t size,                // size of the block, in bytes
+    bool clear,                 // if true, set the block to zero
+    int nthreads                // # of threads to use
+) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
@@ -140,6 +140,26 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         (*mem_deep) += Pending->x_size ;
     }
 
+    GB_Concurrent Concurrent = A->concurrent ;
+    if (Concurrent != NULL)
+    {
+        // pending tuples of concurrent setElement
+        (*nallocs)++ ;
+        (*mem_deep) += Concurrent->header_size ;
+        for (int s = 0 ; s <= GB_CONCURRENT_NSLOTS ; s++)
+        {
+            GB_Pending P = (s < GB_CONCURRENT_NSLOTS) ?
+                Concurrent->slot [s] : Concurrent->spill ;
+            if (P != NULL)
+            {
+                (*nallocs) += 1 + (P->i != NULL) + (P->j != NULL)
+                    + (P->x != NULL) ;
+                (*mem_deep) += P->header_size + P->i_size + P->j_size
+                    + P->x_size ;
+            }
+        }
+    }
+
     if (count_hyper_hash && A->Y != NULL)
     {
         int64_t Y_nallocs = 0 ;
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// GB_memory_first_touch: first touch a block of memory in parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On a NUMA machine, the operating system places each page of memory on the
+// node of the thread that first writes to it.  GB_malloc_memory returns a
+// block that has not been touched, and the method that fills it (GB_builder
+// or GB_transpose, for example) may do so with a single thread, or with a
+// partition of the block that differs from the kernels that later read it.
+// All pages of A->i and A->x can then end up on a single node, and a
+// bandwidth-bound kernel such as GrB_mxv is limited to the bandwidth of that
+// node.
+
+// This method splits the block into nthreads contiguous slices of equal size,
+// the same as an OpenMP parallel loop over the entries of the block with
+// schedule(static), and each thread touches the pages that start in its
+// slice.  If clear is true, each thread sets its slice to zero instead.  For
+// the placement to be stable, the OpenMP threads should be bound to cores,
+// with OMP_PROC_BIND and OMP_PLACES.
+
+// Every page of the block is written, whether or not it has been touched
+// before.  The writes do not move a page that is already placed, as is the
+// case for a block that malloc has reused from a prior block, so for such a
+// block this method only costs the time to write one byte per page (or to
+// clear the block, which calloc would do anyway).
+
+#include "GB.h"
+
+#define GB_PAGE_SIZE 4096
+
+void GB_memory_first_touch      // first touch a block in parallel
+(
+    void *p,                    // block to touch
+    size_t size,                // size of the block, in bytes
+    bool clear,                 // if true, set the block to zero
+    int nthreads                // # of threads to use
+)
+{
+
+    if (p == NULL || size == 0)
+    { 
+        return ;
+    }
+
+    nthreads = GB_IMAX (nthreads, 1) ;
+    GB_void *P = (GB_void *) p ;
+    int64_t n = (int64_t) size ;
+
+    // offset of the first page boundary in the block
+    int64_t pfirst = (int64_t) (((uintptr_t) P) % GB_PAGE_SIZE) ;
+    if (pfirst > 0) pfirst = GB_PAGE_SIZE - pfirst ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, n, tid, nthreads) ;
+        if (clear)
+        { 
+            // set this slice of the block to zero
+            memset (P + pstart, 0, pend - pstart) ;
+        }
+        else
+        {
+            // touch each page that starts in this slice
+            if (tid == 0)
+            { 
+                // the first thread also touches the start of the block
+                P [0] = 0 ;
+            }
+            int64_t k = pfirst ;
+            if (k < pstart)
+            { 
+                k += GB_ICEIL (pstart - k, GB_PAGE_SIZE) * GB_PAGE_SIZE ;
+            }
+            for ( ; k < pend ; k += GB_PAGE_SIZE)
+            { 
+                P [k] = 0 ;
+            }
+        }
+    }
+}
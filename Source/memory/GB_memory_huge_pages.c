@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// GB_memory_huge_pages: allocate large blocks with transparent huge pages
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Kernels with random access into large arrays (the Gustavson workspace of
+// saxpy3, dot2 with a bitmap, and the hyper_hash lookups, for example) can be
+// limited by TLB misses when the arrays are held in 4KB pages.  If enabled by
+// GrB_set (GrB_GLOBAL, true, GxB_MEMORY_HUGE_PAGES), each block of
+// GB_HUGE_PAGE_MIN bytes or more allocated by GB_malloc_memory or
+// GB_calloc_memory is aligned to 2MB, and the operating system is advised to
+// hold it in transparent huge pages (madvise with MADV_HUGEPAGE).  This is
+// useful when the system setting for transparent huge pages is "madvise"; if
+// it is "always", all large blocks already use huge pages, and if it is
+// "never", the advice has no effect.
+
+// This is only done on Linux, and only if GraphBLAS uses the malloc and free
+// functions of the C library, since the aligned block must be freed by the
+// free function passed to GrB_init or GxB_init.  Otherwise, the option can be
+// set but has no effect.
+
+#if defined ( __linux__ )
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <sys/mman.h>
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+#define GB_HAVE_HUGE_PAGES 1
+#else
+#define GB_HAVE_HUGE_PAGES 0
+#endif
+
+// size of a huge page on x86_64 and most other Linux platforms
+#define GB_HUGE_PAGE_SIZE (2*1024*1024)
+
+// true if large blocks are allocated with huge pages; false by default
+static bool GB_huge_pages_control = false ;
+
+//------------------------------------------------------------------------------
+// GB_memory_huge_pages_control_set/get: enable or disable huge pages
+//------------------------------------------------------------------------------
+
+void GB_memory_huge_pages_control_set (bool control)
+{
+    GB_ATOMIC_WRITE
+    GB_huge_pages_control = control ;
+}
+
+bool GB_memory_huge_pages_control_get (void)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_huge_pages_control ;
+    return (control) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_huge_pages_malloc: allocate a large block with huge pages
+//------------------------------------------------------------------------------
+
+// Returns NULL if huge pages are not enabled or not available, if the block
+// is too small, or if out of memory.  The caller then uses the malloc
+// function instead.
+
+void *GB_memory_huge_pages_malloc
+(
+    size_t size             // # of bytes to allocate
+)
+{
+
+    #if GB_HAVE_HUGE_PAGES
+
+        //----------------------------------------------------------------------
+        // check if huge pages can be used
+        //----------------------------------------------------------------------
+
+        if (size < GB_HUGE_PAGE_MIN || !GB_memory_huge_pages_control_get ( ))
+        {
+            return (NULL) ;
+        }
+
+        if (GB_Global_malloc_function_get ( ) != (void *) malloc ||
+            GB_Global_free_function_get ( ) != (void *) free)
+        {
+            // the block must be freed by the C library free function
+            return (NULL) ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate the block aligned to a huge page, and advise the OS
+        //----------------------------------------------------------------------
+
+        void *p = NULL ;
+        if (posix_memalign (&p, GB_HUGE_PAGE_SIZE, size) != 0)
+        {
+            // out of memory
+            return (NULL) ;
+        }
+        GB_Global_memtable_add (p, size) ;
+
+        // The advice may fail if transparent huge pages are disabled, but the
+        // block can still be used.
+        (void) madvise (p, size, MADV_HUGEPAGE) ;
+        return (p) ;
+
+    #else
+
+        // huge pages are not available
+        return (NULL) ;
+
+    #endif
+}
@@ -0,0 +1,763 @@
+//------------------------------------------------------------------------------
+// GB_memory_pool: pool of free memory blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The memory pool keeps blocks freed by GB_free_memory, so that they can be
+// reused by GB_malloc_memory and GB_calloc_memory without a call to the
+// malloc and free functions passed to GrB_init.  It is off by default, and is
+// enabled by GrB_set (GrB_GLOBAL, true, GxB_MEMORY_POOL_CONTROL).
+
+// The pool has one size class for each power of two.  When the pool is
+// enabled, a request for b bytes is rounded up to the next power of two, 2^k,
+// if blocks of that size class are kept in the pool (if limit [k] > 0).
+// Otherwise, the size is not rounded, and the block bypasses the pool.  A
+// block of size 2^k is kept when it is freed, if the free list k holds fewer
+// than limit [k] blocks and the pool holds fewer than max_bytes bytes in all.
+
+// Each user thread and OpenMP thread keeps a small cache of blocks of size
+// 2^12 or less (up to GB_POOL_CACHE_DEPTH of each size), which it can use
+// without a critical section.  The rest of the pool is held in the global free
+// lists, which are accessed in a critical section.  When the pool is flushed,
+// the global free lists are freed, and each thread frees the blocks in its
+// cache the next time it uses the pool.  All blocks are freed by
+// GrB_finalize.
+
+// Only blocks allocated by GraphBLAS are kept in the pool.  Blocks imported
+// from the user application (by GxB_*_import and GxB_*_pack) are freed when
+// GraphBLAS is done with them, even if their size is a power of two (see
+// GB_memory_pool_import).
+
+// The limits can be changed by GrB_set while other user threads use the pool,
+// so they are read and written atomically.
+
+// The pool is not used when malloc tracking is enabled, since the memtable
+// used for debugging counts each block in the pool as allocated.
+
+#include "GB.h"
+
+// size classes:
+#define GB_POOL_NCLASS GxB_NMEMORY_POOL
+#define GB_POOL_MINCLASS 3                  // smallest block is 8 bytes
+
+// per-thread caches:
+#define GB_POOL_CACHE_MAXCLASS 12           // largest cached block: 4KB
+#define GB_POOL_CACHE_DEPTH 8               // # of blocks of each size
+
+// default max # of bytes in the pool: 64MB
+#define GB_POOL_MAX_BYTES_DEFAULT ((int64_t) 64 * 1024 * 1024)
+
+//------------------------------------------------------------------------------
+// global pool status
+//------------------------------------------------------------------------------
+
+// The default limits keep 16384 blocks of size 8 to 256 bytes, then halve for
+// each size class, down to 8 blocks of size 512KB.  Blocks of size 1MB or more
+// are not kept.
+static const int64_t GB_pool_limit_default [GB_POOL_NCLASS] =
+{
+    0, 0, 0,                                            // 1 to 4 bytes
+    16384, 16384, 16384, 16384, 16384, 16384,           // 8 to 256 bytes
+    8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8    // 512 to 512KB
+} ;
+
+// current limits, initially the defaults
+static int64_t GB_pool_limit [GB_POOL_NCLASS] =
+{
+    0, 0, 0,
+    16384, 16384, 16384, 16384, 16384, 16384,
+    8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8
+} ;
+
+static bool GB_pool_control = false ;   // true if the pool is enabled
+static int64_t GB_pool_max_bytes = GB_POOL_MAX_BYTES_DEFAULT ;
+
+// global free lists: each free block holds a pointer to the next one
+static void *GB_pool_list [GB_POOL_NCLASS] ;
+static int64_t GB_pool_nlist [GB_POOL_NCLASS] ;
+
+// statistics: # of hits, misses, blocks in the pool, bytes in the pool
+static int64_t GB_pool_hits = 0 ;
+static int64_t GB_pool_misses = 0 ;
+static int64_t GB_pool_nblocks = 0 ;
+static int64_t GB_pool_nbytes = 0 ;
+
+// the pool is flushed when the generation changes
+static int64_t GB_pool_generation = 0 ;
+
+// Imported blocks whose size could be kept in the pool are held in a hash set
+// with linear probing, which is only searched if it is not empty.  If an
+// imported block cannot be added to the set, no block is kept in the pool
+// from then on, until GrB_finalize.
+static void **GB_pool_import_set = NULL ;
+static int64_t GB_pool_import_size = 0 ;    // size of the set: 0 or 2^k
+static int64_t GB_pool_nimport = 0 ;        // # of blocks in the set
+static bool GB_pool_import_lost = false ;   // true if a block was not added
+
+//------------------------------------------------------------------------------
+// per-thread caches
+//------------------------------------------------------------------------------
+
+typedef struct GB_pool_cache_struct GB_pool_cache ;
+struct GB_pool_cache_struct
+{
+    int64_t generation ;            // generation of the blocks in the cache
+    int nblocks [GB_POOL_CACHE_MAXCLASS+1] ;
+    void *block [GB_POOL_CACHE_MAXCLASS+1][GB_POOL_CACHE_DEPTH] ;
+    GB_pool_cache *next ;           // list of all caches
+} ;
+
+// all caches, so that GrB_finalize can free them
+static GB_pool_cache *GB_pool_caches = NULL ;
+
+// the cache of this thread, using the same thread-local storage as the
+// GxB_Context (see GB_Context.c)
+#if defined ( _OPENMP )
+
+    static GB_pool_cache *GB_POOL_CACHE = NULL ;
+    #pragma omp threadprivate (GB_POOL_CACHE)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    static __thread GB_pool_cache *GB_POOL_CACHE = NULL ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    static __declspec ( thread ) GB_pool_cache *GB_POOL_CACHE = NULL ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    #include <threads.h>
+    static _Thread_local GB_pool_cache *GB_POOL_CACHE = NULL ;
+
+#else
+
+    // no thread-local storage: all blocks are kept in the global free lists
+    #define GB_POOL_NO_CACHE
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_pool_stats_update: update the # of blocks and bytes in the pool
+//------------------------------------------------------------------------------
+
+static inline void GB_pool_stats_update (int64_t nblocks, int64_t nbytes)
+{
+    GB_ATOMIC_UPDATE
+    GB_pool_nblocks += nblocks ;
+    GB_ATOMIC_UPDATE
+    GB_pool_nbytes += nbytes ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_cache_drain: free all blocks in a cache
+//------------------------------------------------------------------------------
+
+static void GB_pool_cache_drain (GB_pool_cache *cache)
+{
+    for (int k = GB_POOL_MINCLASS ; k <= GB_POOL_CACHE_MAXCLASS ; k++)
+    {
+        int n = cache->nblocks [k] ;
+        for (int t = 0 ; t < n ; t++)
+        {
+            GB_Global_free_function (cache->block [k][t]) ;
+        }
+        cache->nblocks [k] = 0 ;
+        GB_pool_stats_update (-n, -n * (((int64_t) 1) << k)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_cache_get: get the cache of this thread
+//------------------------------------------------------------------------------
+
+// Returns NULL if the thread has no cache and one cannot be allocated.  If the
+// pool has been flushed since the cache was last used, its blocks are freed.
+
+static GB_pool_cache *GB_pool_cache_get (void)
+{
+
+    #ifdef GB_POOL_NO_CACHE
+    return (NULL) ;
+    #else
+
+    int64_t generation ;
+    GB_ATOMIC_READ
+    generation = GB_pool_generation ;
+
+    GB_pool_cache *cache = GB_POOL_CACHE ;
+    if (cache == NULL)
+    {
+        // allocate the cache for this thread and add it to the list
+        cache = GB_Global_malloc_function (sizeof (GB_pool_cache)) ;
+        if (cache == NULL)
+        {
+            return (NULL) ;
+        }
+        memset (cache, 0, sizeof (GB_pool_cache)) ;
+        cache->generation = generation ;
+        #pragma omp critical (GB_memory_pool)
+        {
+            cache->next = GB_pool_caches ;
+            GB_pool_caches = cache ;
+        }
+        GB_POOL_CACHE = cache ;
+    }
+    else if (cache->generation != generation)
+    {
+        // the pool has been flushed
+        GB_pool_cache_drain (cache) ;
+        cache->generation = generation ;
+    }
+    return (cache) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_limit_get: get the max # of blocks of size 2^k in the pool
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_pool_limit_get (int k)
+{
+    if (k >= GB_POOL_NCLASS)
+    { 
+        return (0) ;
+    }
+    int64_t limit ;
+    GB_ATOMIC_READ
+    limit = GB_pool_limit [k] ;
+    return (limit) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_import_slot: find a block in the set of imported blocks
+//------------------------------------------------------------------------------
+
+// Returns the slot holding p, or the empty slot where p would be inserted.
+// Must be called in the GB_memory_pool critical section, after the set has
+// been allocated.  The set is never full.
+
+static int64_t GB_pool_import_slot (void *p)
+{
+    uint64_t h = ((uint64_t) (uintptr_t) p) * ((uint64_t) 0x9E3779B97F4A7C15);
+    int64_t mask = GB_pool_import_size - 1 ;
+    int64_t k = (int64_t) (h >> 32) & mask ;
+    while (GB_pool_import_set [k] != NULL && GB_pool_import_set [k] != p)
+    { 
+        k = (k + 1) & mask ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_import_remove: remove a block from the set of imported blocks
+//------------------------------------------------------------------------------
+
+// Returns true if p was in the set.  The set is searched only if it is not
+// empty.  A block is only removed from the set when it is freed or leaves
+// GraphBLAS, so the set is allocated if it is not empty.  An entry is removed
+// by moving later entries of its probe sequence back into the empty slot, so
+// no tombstones are needed.
+
+static bool GB_pool_import_remove (void *p)
+{
+
+    int64_t nimport ;
+    GB_ATOMIC_READ
+    nimport = GB_pool_nimport ;
+    if (nimport == 0 || p == NULL)
+    { 
+        return (false) ;
+    }
+
+    bool found = false ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        int64_t k = GB_pool_import_slot (p) ;
+        found = (GB_pool_import_set [k] == p) ;
+        if (found)
+        {
+            // remove p, and fill the hole with later entries
+            int64_t mask = GB_pool_import_size - 1 ;
+            GB_pool_import_set [k] = NULL ;
+            for (int64_t j = (k + 1) & mask ; GB_pool_import_set [j] != NULL ;
+                j = (j + 1) & mask)
+            { 
+                void *q = GB_pool_import_set [j] ;
+                GB_pool_import_set [j] = NULL ;
+                GB_pool_import_set [GB_pool_import_slot (q)] = q ;
+            }
+            GB_ATOMIC_UPDATE
+            GB_pool_nimport-- ;
+        }
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_import: record a block imported from the user application
+//------------------------------------------------------------------------------
+
+// The block p of the given size was allocated by the user application, and is
+// now owned by GraphBLAS.  It is not kept in the pool when it is freed.
+
+void GB_memory_pool_import (void *p, size_t size)
+{
+
+    if (p == NULL || size < 8 || !GB_IS_POWER_OF_TWO (size) ||
+        GB_CEIL_LOG2 (size) >= GB_POOL_NCLASS)
+    { 
+        // a block of this size is never kept in the pool
+        return ;
+    }
+
+    bool ok = true ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        if (2 * (GB_pool_nimport + 1) > GB_pool_import_size)
+        {
+            // double the size of the set, and rehash it
+            int64_t old_size = GB_pool_import_size ;
+            void **old_set = GB_pool_import_set ;
+            int64_t new_size = GB_IMAX (2 * old_size, 1024) ;
+            void **new_set = GB_Global_malloc_function (new_size *
+                sizeof (void *)) ;
+            ok = (new_set != NULL) ;
+            if (ok)
+            {
+                memset (new_set, 0, new_size * sizeof (void *)) ;
+                GB_pool_import_set = new_set ;
+                GB_pool_import_size = new_size ;
+                for (int64_t k = 0 ; k < old_size ; k++)
+                {
+                    void *q = old_set [k] ;
+                    if (q != NULL)
+                    { 
+                        GB_pool_import_set [GB_pool_import_slot (q)] = q ;
+                    }
+                }
+                if (old_set != NULL)
+                { 
+                    GB_Global_free_function (old_set) ;
+                }
+            }
+        }
+        if (ok)
+        {
+            int64_t k = GB_pool_import_slot (p) ;
+            if (GB_pool_import_set [k] == NULL)
+            { 
+                GB_pool_import_set [k] = p ;
+                GB_ATOMIC_UPDATE
+                GB_pool_nimport++ ;
+            }
+        }
+    }
+
+    if (!ok)
+    { 
+        // out of memory: the block cannot be recorded, so no block is kept
+        // in the pool from now on
+        GB_ATOMIC_WRITE
+        GB_pool_import_lost = true ;
+        GB_memory_pool_flush ( ) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_forget: a block is no longer owned by GraphBLAS
+//------------------------------------------------------------------------------
+
+// The block p is exported to the user application, or is about to be
+// reallocated.  If it was imported, it is removed from the set of imported
+// blocks, and true is returned.
+
+bool GB_memory_pool_forget (void *p)
+{ 
+    return (GB_pool_import_remove (p)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_round: round a block size up to its size class
+//------------------------------------------------------------------------------
+
+// Returns the size rounded up to the next power of two, or the size itself if
+// the pool is disabled or if the pool does not keep blocks of that size.
+
+size_t GB_memory_pool_round (size_t size)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_pool_control ;
+    if (!control || GB_Global_malloc_tracking_get ( ))
+    {
+        return (size) ;
+    }
+    int k = (int) GB_CEIL_LOG2 (GB_IMAX (size, 8)) ;
+    if (GB_pool_limit_get (k) <= 0)
+    {
+        return (size) ;
+    }
+    return (((size_t) 1) << k) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_get: get a block from the pool
+//------------------------------------------------------------------------------
+
+void *GB_memory_pool_get    // get a block from the pool, or NULL if none
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested; on output:
+                            // # of bytes to allocate if no block is returned
+)
+{
+
+    //--------------------------------------------------------------------------
+    // round the size up to its size class
+    //--------------------------------------------------------------------------
+
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_pool_control ;
+    if (!control || GB_Global_malloc_tracking_get ( ))
+    {
+        return (NULL) ;
+    }
+    int k = (int) GB_CEIL_LOG2 (GB_IMAX (*size, 8)) ;
+    if (GB_pool_limit_get (k) <= 0)
+    {
+        // the pool does not keep blocks of this size
+        return (NULL) ;
+    }
+    (*size) = ((size_t) 1) << k ;
+
+    //--------------------------------------------------------------------------
+    // get a block from the cache of this thread
+    //--------------------------------------------------------------------------
+
+    void *p = NULL ;
+    if (k <= GB_POOL_CACHE_MAXCLASS)
+    {
+        GB_pool_cache *cache = GB_pool_cache_get ( ) ;
+        if (cache != NULL && cache->nblocks [k] > 0)
+        {
+            p = cache->block [k][--(cache->nblocks [k])] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // otherwise, get a block from the global free list
+    //--------------------------------------------------------------------------
+
+    if (p == NULL)
+    {
+        #pragma omp critical (GB_memory_pool)
+        {
+            p = GB_pool_list [k] ;
+            if (p != NULL)
+            {
+                GB_pool_list [k] = *((void **) p) ;
+                GB_pool_nlist [k]-- ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // update the statistics and return result
+    //--------------------------------------------------------------------------
+
+    if (p != NULL)
+    {
+        GB_ATOMIC_UPDATE
+        GB_pool_hits++ ;
+        GB_pool_stats_update (-1, -((int64_t) (*size))) ;
+    }
+    else
+    {
+        GB_ATOMIC_UPDATE
+        GB_pool_misses++ ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_put: return a block to the pool
+//------------------------------------------------------------------------------
+
+bool GB_memory_pool_put     // return true if the block is kept in the pool
+(
+    void *p,                // block to free
+    size_t size             // size of the block
+)
+{
+
+    //--------------------------------------------------------------------------
+    // never keep a block imported from the user application
+    //--------------------------------------------------------------------------
+
+    if (GB_pool_import_remove (p))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if the block can be kept
+    //--------------------------------------------------------------------------
+
+    bool control, lost ;
+    GB_ATOMIC_READ
+    control = GB_pool_control ;
+    GB_ATOMIC_READ
+    lost = GB_pool_import_lost ;
+    control = control && !lost ;
+    #ifndef GB_POOL_NO_CACHE
+    if (!control && GB_POOL_CACHE != NULL)
+    { 
+        // free the blocks in the cache of this thread if the pool was flushed
+        GB_pool_cache_get ( ) ;
+    }
+    #endif
+    if (!control || p == NULL || size < 8 || !GB_IS_POWER_OF_TWO (size)
+        || GB_Global_malloc_tracking_get ( ))
+    {
+        return (false) ;
+    }
+    int k = (int) GB_CEIL_LOG2 (size) ;
+    int64_t limit = GB_pool_limit_get (k) ;
+    if (limit <= 0)
+    {
+        return (false) ;
+    }
+    int64_t nbytes, max_bytes ;
+    GB_ATOMIC_READ
+    nbytes = GB_pool_nbytes ;
+    GB_ATOMIC_READ
+    max_bytes = GB_pool_max_bytes ;
+    if (nbytes + (int64_t) size > max_bytes)
+    {
+        // the pool is full
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // put the block in the cache of this thread
+    //--------------------------------------------------------------------------
+
+    bool kept = false ;
+    if (k <= GB_POOL_CACHE_MAXCLASS)
+    {
+        GB_pool_cache *cache = GB_pool_cache_get ( ) ;
+        if (cache != NULL && cache->nblocks [k] < GB_IMIN (limit,
+            GB_POOL_CACHE_DEPTH))
+        {
+            cache->block [k][(cache->nblocks [k])++] = p ;
+            kept = true ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // otherwise, put the block in the global free list
+    //--------------------------------------------------------------------------
+
+    if (!kept)
+    {
+        #pragma omp critical (GB_memory_pool)
+        {
+            if (GB_pool_nlist [k] < limit)
+            {
+                *((void **) p) = GB_pool_list [k] ;
+                GB_pool_list [k] = p ;
+                GB_pool_nlist [k]++ ;
+                kept = true ;
+            }
+        }
+    }
+
+    if (kept)
+    {
+        GB_pool_stats_update (1, (int64_t) size) ;
+    }
+    return (kept) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_flush: free all blocks in the pool
+//------------------------------------------------------------------------------
+
+// The blocks in the global free lists and in the cache of this thread are
+// freed now.  Other threads free the blocks in their caches the next time
+// they use the pool.
+
+void GB_memory_pool_flush (void)
+{
+
+    #pragma omp critical (GB_memory_pool)
+    {
+        GB_ATOMIC_UPDATE
+        GB_pool_generation++ ;
+        for (int k = 0 ; k < GB_POOL_NCLASS ; k++)
+        {
+            void *p = GB_pool_list [k] ;
+            while (p != NULL)
+            {
+                void *next = *((void **) p) ;
+                GB_Global_free_function (p) ;
+                p = next ;
+            }
+            int64_t n = GB_pool_nlist [k] ;
+            GB_pool_stats_update (-n, -n * (((int64_t) 1) << k)) ;
+            GB_pool_list [k] = NULL ;
+            GB_pool_nlist [k] = 0 ;
+        }
+    }
+
+    #ifndef GB_POOL_NO_CACHE
+    if (GB_POOL_CACHE != NULL)
+    {
+        GB_pool_cache_get ( ) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_finalize: free the pool and all per-thread caches
+//------------------------------------------------------------------------------
+
+// Only one user thread may call GrB_finalize, and no other thread may use
+// GraphBLAS at the same time, so the caches of all threads can be freed.
+
+void GB_memory_pool_finalize (void)
+{
+    GB_memory_pool_flush ( ) ;
+    GB_pool_control = false ;
+    GB_pool_cache *cache = GB_pool_caches ;
+    while (cache != NULL)
+    {
+        GB_pool_cache *next = cache->next ;
+        GB_pool_cache_drain (cache) ;
+        GB_Global_free_function (cache) ;
+        cache = next ;
+    }
+    GB_pool_caches = NULL ;
+    #ifndef GB_POOL_NO_CACHE
+    GB_POOL_CACHE = NULL ;
+    #endif
+    if (GB_pool_import_set != NULL)
+    { 
+        GB_Global_free_function (GB_pool_import_set) ;
+    }
+    GB_pool_import_set = NULL ;
+    GB_pool_import_size = 0 ;
+    GB_pool_nimport = 0 ;
+    GB_pool_import_lost = false ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_control_set/get: enable or disable the pool
+//------------------------------------------------------------------------------
+
+void GB_memory_pool_control_set (bool control)
+{
+    GB_ATOMIC_WRITE
+    GB_pool_control = control ;
+    if (!control)
+    {
+        // free all blocks in the pool
+        GB_memory_pool_flush ( ) ;
+    }
+}
+
+bool GB_memory_pool_control_get (void)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_pool_control ;
+    return (control) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_max_bytes_set/get: max # of bytes kept in the pool
+//------------------------------------------------------------------------------
+
+void GB_memory_pool_max_bytes_set (int64_t max_bytes)
+{
+    // a negative value restores the default
+    GB_ATOMIC_WRITE
+    GB_pool_max_bytes = (max_bytes < 0) ? GB_POOL_MAX_BYTES_DEFAULT :
+        max_bytes ;
+    GB_memory_pool_flush ( ) ;
+}
+
+int64_t GB_memory_pool_max_bytes_get (void)
+{
+    int64_t max_bytes ;
+    GB_ATOMIC_READ
+    max_bytes = GB_pool_max_bytes ;
+    return (max_bytes) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_limits_set/get: max # of blocks of each size in the pool
+//------------------------------------------------------------------------------
+
+// limits [k] is the max # of free blocks of size 2^k kept in the pool.  The
+// pool is flushed when the limits are changed.  The limits for blocks smaller
+// than 8 bytes are always zero, since GB_malloc_memory allocates at least 8
+// bytes.  If limits is NULL, the default limits are used.
+
+void GB_memory_pool_limits_set (const int64_t *limits)
+{
+    if (limits == NULL)
+    { 
+        limits = GB_pool_limit_default ;
+    }
+    for (int k = 0 ; k < GB_POOL_NCLASS ; k++)
+    {
+        int64_t limit = (k < GB_POOL_MINCLASS) ? 0 : GB_IMAX (limits [k], 0) ;
+        GB_ATOMIC_WRITE
+        GB_pool_limit [k] = limit ;
+    }
+    GB_memory_pool_flush ( ) ;
+}
+
+void GB_memory_pool_limits_get (int64_t *limits)
+{
+    for (int k = 0 ; k < GB_POOL_NCLASS ; k++)
+    { 
+        limits [k] = GB_pool_limit_get (k) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_stats_get/clear: pool statistics
+//------------------------------------------------------------------------------
+
+// stats [0]: # of allocations satisfied from the pool (hits)
+// stats [1]: # of allocations of a pooled size that missed the pool
+// stats [2]: # of blocks in the pool (including all per-thread caches)
+// stats [3]: # of bytes in the pool (including all per-thread caches)
+
+void GB_memory_pool_stats_get (int64_t *stats)
+{
+    GB_ATOMIC_READ
+    stats [0] = GB_pool_hits ;
+    GB_ATOMIC_READ
+    stats [1] = GB_pool_misses ;
+    GB_ATOMIC_READ
+    stats [2] = GB_pool_nblocks ;
+    GB_ATOMIC_READ
+    stats [3] = GB_pool_nbytes ;
+}
+
+void GB_memory_pool_stats_clear (void)
+{
+    GB_ATOMIC_WRITE
+    GB_pool_hits = 0 ;
+    GB_ATOMIC_WRITE
+    GB_pool_misses = 0 ;
+}
@@ -110,7 +110,7 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
     //--------------------------------------------------------------------------
 
     void *pnew = NULL ;
-    size_t newsize_allocated = GB_IMAX (newsize, 8) ;
+    size_t newsize_allocated = GB_memory_pool_round (GB_IMAX (newsize, 8)) ;
     if (!GB_Global_have_realloc_function ( ))
     {
 
@@ -148,7 +148,15 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
             printf ("hard realloc %p oldsize %ld newsize %ld\n",    // MEMDUMP
                 p, oldsize_allocated, newsize_allocated) ;
             #endif
+            // a block imported from the user application and reallocated
+            // here may be kept in the memory pool when it is freed
+            bool imported = GB_memory_pool_forget (p) ;
             pnew = GB_Global_realloc_function (p, newsize_allocated) ;
+            if (pnew == NULL && imported)
+            { 
+                // the old block is unchanged
+                GB_memory_pool_import (p, oldsize_allocated) ;
+            }
             #ifdef GB_MEMDUMP
             GB_Global_memtable_dump ( ) ;
             #endif
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_mmap.h: definitions for matrices mapped from files
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_MMAP_H
+#define GB_MMAP_H
+
+// A matrix file written by GxB_Matrix_mmap_write holds a header of
+// GB_MMAP_ALIGN bytes, followed by the arrays A->p, A->h, A->b, A->i, and A->x
+// (those that are present), uncompressed, in the native byte order.  Each
+// array starts at a multiple of GB_MMAP_ALIGN bytes in the file, and takes at
+// least GB_MMAP_ALIGN bytes, so that when the file is mapped into memory each
+// array is page-aligned and can be used in place, as a shallow component.
+
+#define GB_MMAP_ALIGN 4096
+#define GB_MMAP_MAGIC "GrB_mmap"
+
+typedef struct
+{
+    char magic [8] ;            // GB_MMAP_MAGIC, with no nul byte
+    int32_t version ;           // GxB_IMPLEMENTATION of the writer
+    int32_t typecode ;          // GB_Type_code of the matrix type
+    int64_t typesize ;          // size of the matrix type
+    int64_t vlen ;              // dimensions of the matrix
+    int64_t vdim ;
+    int64_t nvec ;
+    int64_t nvec_nonempty ;
+    int64_t nvals ;
+    int32_t sparsity_iso_csc ;  // 4*sparsity + 2*iso + is_csc
+    int32_t sparsity_control ;
+    float hyper_switch ;
+    float bitmap_switch ;
+    int64_t offset [5] ;        // where A->[phbix] start in the file
+    int64_t len [5] ;           // size of A->[phbix] in bytes
+    char type_name [GxB_MAX_NAME_LEN] ;     // name of a user-defined type
+}
+GB_mmap_header ;
+
+GrB_Info GB_mmap_write              // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    const GrB_Matrix A,             // matrix to write, with no pending work
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mmap_read               // map a matrix from a file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix mapped from the file
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename            // file to map
+) ;
+
+void GB_mmap_unmap                  // unmap a file mapped by GB_mmap_read
+(
+    void *base,                     // start of the mapping
+    size_t size                     // size of the mapping
+) ;
+
+#endif
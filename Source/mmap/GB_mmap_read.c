@@ -0,0 +1,313 @@
+//------------------------------------------------------------------------------
+// GB_mmap_read: map a matrix from a file written by GB_mmap_write
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is mapped read-only into memory, and the arrays of the matrix C
+// point into the mapping, as shallow components held in a GB_Shared struct
+// (see GB_dup_shared.c).  Nothing is read from the file other than its
+// header and two entries of Cp; the operating system reads the pages of the
+// file as they are accessed, and can evict them when memory is needed, so C
+// can be larger than the memory of the system.
+
+// The operating system is advised that Cp and Ch (which are small, and
+// accessed throughout any computation with C) will be needed soon, and that
+// Cb, Ci, and Cx will be accessed sequentially, so that it reads ahead
+// aggressively and evicts pages already scanned.
+
+// C can be used as an input to any method.  If C is modified, it first gets
+// its own copy of its arrays (see GB_unshare.c), which reads the whole file.
+// The mapping is released when C, and any matrix that shares its arrays, is
+// freed or modified.
+
+// The content of the file is trusted, apart from its header and the size of
+// each array, which are checked against the size of the file.  The file must
+// not be modified while it is mapped.  This method is only available on
+// POSIX systems; GrB_NOT_IMPLEMENTED is returned otherwise.
+
+#include "GB.h"
+#include "mmap/GB_mmap.h"
+#include "jitifyer/GB_file.h"
+
+#if !GB_WINDOWS
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (&C) ;                   \
+    GB_FREE (&shared, shared_size) ;        \
+    GB_mmap_unmap (base, size) ;            \
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_unmap: unmap a file
+//------------------------------------------------------------------------------
+
+void GB_mmap_unmap                  // unmap a file mapped by GB_mmap_read
+(
+    void *base,                     // start of the mapping
+    size_t size                     // size of the mapping
+)
+{
+    #if !GB_WINDOWS
+    if (base != NULL)
+    {
+        munmap (base, size) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_read
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mmap_read               // map a matrix from a file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix mapped from the file
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const char *filename            // file to map
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL && filename != NULL) ;
+    (*Chandle) = NULL ;
+
+    #if GB_WINDOWS
+    // mmap is not available
+    return (GrB_NOT_IMPLEMENTED) ;
+    #else
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    GB_Shared shared = NULL ; size_t shared_size = 0 ;
+    void *base = NULL ;
+    size_t size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // map the file
+    //--------------------------------------------------------------------------
+
+    int fd = open (filename, O_RDONLY) ;
+    if (fd == -1)
+    {
+        // file cannot be opened
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    struct stat st ;
+    if (fstat (fd, &st) != 0 || st.st_size < GB_MMAP_ALIGN)
+    {
+        // file is too small to hold a matrix
+        close (fd) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    size = (size_t) st.st_size ;
+    base = mmap (NULL, size, PROT_READ, MAP_SHARED, fd, 0) ;
+    close (fd) ;
+    if (base == MAP_FAILED)
+    {
+        // file cannot be mapped
+        return (GrB_INVALID_VALUE) ;
+    }
+    const GB_void *file = (const GB_void *) base ;
+
+    //--------------------------------------------------------------------------
+    // check the header
+    //--------------------------------------------------------------------------
+
+    GB_mmap_header header ;
+    memcpy (&header, file, sizeof (GB_mmap_header)) ;
+    int32_t sparsity = header.sparsity_iso_csc / 4 ;
+    bool iso = ((header.sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((header.sparsity_iso_csc & 1) == 1) ;
+    int64_t nvec = header.nvec ;
+
+    if (memcmp (header.magic, GB_MMAP_MAGIC, 8) != 0
+        || header.typecode < GB_BOOL_code || header.typecode > GB_UDT_code
+        || header.vlen < 0 || header.vlen > GB_NMAX
+        || header.vdim < 0 || header.vdim > GB_NMAX
+        || nvec < 0 || nvec > header.vdim
+        || (sparsity != GxB_HYPERSPARSE && nvec != header.vdim)
+        || header.nvals < 0
+        || header.typesize <= 0 || header.typesize > (int64_t) size
+        || !(sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE ||
+             sparsity == GxB_BITMAP || sparsity == GxB_FULL))
+    {
+        // file is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) header.typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+    if (ctype == NULL || ctype->size != header.typesize
+        || (ccode == GB_UDT_code && strncmp (header.type_name, ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        || (ccode != GB_UDT_code && type_expected != NULL &&
+            ctype != type_expected))
+    {
+        // the type is missing, or does not match the file
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the size and location of each array
+    //--------------------------------------------------------------------------
+
+    // the arrays that must be present, for each sparsity format
+    int64_t typesize = header.typesize ;
+    bool present [5] ;
+    present [0] = (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE) ;
+    present [1] = (sparsity == GxB_HYPERSPARSE) ;
+    present [2] = (sparsity == GxB_BITMAP) ;
+    present [3] = present [0] ;
+    present [4] = true ;
+
+    // # of entries held in a bitmap or full matrix, and the size of Cx
+    uint64_t nheld, xlen ;
+    bool ok = GB_int64_multiply (&nheld, header.vlen, header.vdim)
+        && header.nvals <= (int64_t) nheld
+        && GB_int64_multiply (&xlen, typesize, iso ? 1 :
+            (present [0] ? header.nvals : (int64_t) nheld)) ;
+    for (int k = 0 ; k < 5 && ok ; k++)
+    {
+        int64_t offset = header.offset [k] ;
+        int64_t len = header.len [k] ;
+        if (!present [k] || offset == 0)
+        {
+            // the array is not present (A->i and A->x of a matrix with no
+            // entries can be NULL)
+            ok = (offset == 0 && len == 0) ;
+        }
+        else
+        {
+            ok = (len >= 0 && len <= (int64_t) size) ;
+            int64_t space = ok ? (GB_IMAX (GB_ICEIL (len, GB_MMAP_ALIGN), 1)
+                * GB_MMAP_ALIGN) : 0 ;
+            ok = ok && (offset >= GB_MMAP_ALIGN
+                && offset % GB_MMAP_ALIGN == 0
+                && offset <= (int64_t) size - space) ;
+        }
+    }
+    ok = ok && (!present [0] || header.len [0] == 8 * (nvec+1))
+            && (!present [1] || header.len [1] == 8 * nvec)
+            && (!present [2] || header.len [2] == (int64_t) nheld)
+            && (!present [3] || (header.len [3] % 8 == 0 &&
+                                 header.len [3] / 8 == header.nvals))
+            && (header.len [4] == (int64_t) xlen) ;
+
+    const int64_t *Cp = (const int64_t *) (file + header.offset [0]) ;
+    if (ok && present [0])
+    {
+        // check the first and last entries of Cp
+        ok = (Cp [0] == 0 && Cp [nvec] == header.nvals) ;
+    }
+
+    if (!ok)
+    {
+        // file is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // advise the operating system how the arrays will be accessed
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (header.len [k] > 0)
+        {
+            (void) madvise ((GB_void *) base + header.offset [k],
+                header.len [k], (k <= 1) ? MADV_WILLNEED : MADV_SEQUENTIAL) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // create the GB_Shared struct that owns the mapping
+    //--------------------------------------------------------------------------
+
+    shared = GB_CALLOC (1, struct GB_Shared_struct, &shared_size) ;
+    if (shared == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    shared->header_size = shared_size ;
+    shared->refcount = 1 ;
+    shared->mmap_base = base ;
+    shared->mmap_size = size ;
+
+    // each array present in the file takes at least GB_MMAP_ALIGN bytes
+    GB_void *X [5] ;
+    size_t X_size [5] ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        bool has = (header.offset [k] > 0) ;
+        X [k] = has ? ((GB_void *) base + header.offset [k]) : NULL ;
+        X_size [k] = has ? (GB_IMAX (GB_ICEIL (header.len [k], GB_MMAP_ALIGN),
+            1) * GB_MMAP_ALIGN) : 0 ;
+    }
+    shared->p = (int64_t *) X [0] ; shared->p_size = X_size [0] ;
+    shared->h = (int64_t *) X [1] ; shared->h_size = X_size [1] ;
+    shared->b = (int8_t  *) X [2] ; shared->b_size = X_size [2] ;
+    shared->i = (int64_t *) X [3] ; shared->i_size = X_size [3] ;
+    shared->x = (void    *) X [4] ; shared->x_size = X_size [4] ;
+
+    //--------------------------------------------------------------------------
+    // create the matrix C, with its arrays in the mapping
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C,  // new header
+        ctype, header.vlen, header.vdim, GB_Ap_null, is_csc, sparsity,
+        header.hyper_switch, 0)) ;
+
+    C->p = shared->p ; C->p_size = X_size [0] ; C->p_shallow = (X [0] != NULL) ;
+    C->h = shared->h ; C->h_size = X_size [1] ; C->h_shallow = (X [1] != NULL) ;
+    C->b = shared->b ; C->b_size = X_size [2] ; C->b_shallow = (X [2] != NULL) ;
+    C->i = shared->i ; C->i_size = X_size [3] ; C->i_shallow = (X [3] != NULL) ;
+    C->x = shared->x ; C->x_size = X_size [4] ; C->x_shallow = (X [4] != NULL) ;
+    // if C is hypersparse with no vectors, the padding of Cp and Ch in the
+    // file has space for plen = 1
+    C->plen = (sparsity == GxB_HYPERSPARSE) ? GB_IMAX (nvec, 1) :
+        ((sparsity == GxB_SPARSE) ? nvec : -1) ;
+    C->nvec = nvec ;
+    C->nvec_nonempty = header.nvec_nonempty ;
+    C->nvals = header.nvals ;
+    C->bitmap_switch = header.bitmap_switch ;
+    C->sparsity_control = header.sparsity_control ;
+    C->iso = iso ;
+    C->shared = shared ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(mmap read: %" PRId64 " bytes) ", (int64_t) size) ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (C, "C mapped from a file", GB0) ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// GB_mmap_write: write a matrix to a file, in a layout that can be mapped
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The arrays of A are written to the file as they are, one after the other,
+// with no copy of A and no compression.  See GB_mmap.h for the file layout.
+// Returns GrB_INVALID_VALUE if the file cannot be written.
+
+#include "GB.h"
+#include "mmap/GB_mmap.h"
+
+//------------------------------------------------------------------------------
+// GB_mmap_write_array: write an array to the file, padded to GB_MMAP_ALIGN
+//------------------------------------------------------------------------------
+
+static bool GB_mmap_write_array     // true if successful, false on error
+(
+    FILE *f,                        // file to write
+    const void *X,                  // array to write, of size len bytes
+    int64_t len,                    // size of X in bytes
+    int64_t *s                      // current size of the file
+)
+{
+    static const GB_void zeros [GB_MMAP_ALIGN] = { 0 } ;
+    if (X != NULL && len > 0 && fwrite (X, 1, len, f) != (size_t) len)
+    {
+        return (false) ;
+    }
+    // pad the array to a multiple of GB_MMAP_ALIGN, and at least one block
+    int64_t padded = GB_IMAX (GB_ICEIL (len, GB_MMAP_ALIGN), 1) * GB_MMAP_ALIGN;
+    int64_t pad = padded - len ;
+    if (fwrite (zeros, 1, pad, f) != (size_t) pad)
+    {
+        return (false) ;
+    }
+    (*s) += padded ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_write
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mmap_write              // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    const GrB_Matrix A,             // matrix to write, with no pending work
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to write for mmap", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the header
+    //--------------------------------------------------------------------------
+
+    GB_mmap_header header ;
+    memset (&header, 0, sizeof (GB_mmap_header)) ;
+    memcpy (header.magic, GB_MMAP_MAGIC, 8) ;
+    int32_t sparsity = GB_sparsity (A) ;
+    GrB_Type atype = A->type ;
+    header.version = GxB_IMPLEMENTATION ;
+    header.typecode = (int32_t) (atype->code) ;
+    header.typesize = atype->size ;
+    header.vlen = A->vlen ;
+    header.vdim = A->vdim ;
+    header.nvec = A->nvec ;
+    header.nvec_nonempty = GB_nvec_nonempty (A) ;
+    header.nvals = GB_nnz (A) ;
+    header.sparsity_iso_csc = (4 * sparsity) + (A->iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+    header.sparsity_control = A->sparsity_control ;
+    header.hyper_switch = A->hyper_switch ;
+    header.bitmap_switch = A->bitmap_switch ;
+    if (atype->code == GB_UDT_code)
+    {
+        size_t n = GB_IMIN (strlen (atype->name), GxB_MAX_NAME_LEN-1) ;
+        memcpy (header.type_name, atype->name, n) ;
+    }
+
+    // determine the sizes of Ap, Ah, Ab, Ai, and Ax, as in GB_serialize
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+    int64_t *len = header.len ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            len [1] = sizeof (int64_t) * A->nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            len [0] = sizeof (int64_t) * (A->nvec+1) ;
+            len [3] = sizeof (int64_t) * anz ;
+            len [4] = atype->size * (A->iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            len [2] = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            len [4] = atype->size * (A->iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    // each array present in A starts on the next GB_MMAP_ALIGN boundary
+    const void *X [5] = { A->p, A->h, A->b, A->i, A->x } ;
+    int64_t s = GB_MMAP_ALIGN ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (X [k] != NULL)
+        {
+            header.offset [k] = s ;
+            s += GB_IMAX (GB_ICEIL (len [k], GB_MMAP_ALIGN), 1) * GB_MMAP_ALIGN;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and the arrays
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(mmap write: %" PRId64 " bytes) ", s) ;
+    FILE *f = fopen (filename, "wb") ;
+    if (f == NULL)
+    {
+        // file cannot be opened
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    int64_t s2 = 0 ;
+    bool ok = GB_mmap_write_array (f, &header, sizeof (GB_mmap_header), &s2) ;
+    for (int k = 0 ; k < 5 && ok ; k++)
+    {
+        if (X [k] != NULL)
+        {
+            ok = GB_mmap_write_array (f, X [k], len [k], &s2) ;
+        }
+    }
+    ASSERT (GB_IMPLIES (ok, s == s2)) ;
+
+    if (fclose (f) != 0) ok = false ;
+    return (ok ? GrB_SUCCESS : GrB_INVALID_VALUE) ;
+}
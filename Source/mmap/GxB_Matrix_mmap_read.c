@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap_read: map a matrix from a file written by mmap_write
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_mmap_read creates a matrix whose content is held in a read-only
+// mapping of a file written by GxB_Matrix_mmap_write.  The file is not read
+// into memory; see GB_mmap_read.
+
+#include "GB.h"
+#include "mmap/GB_mmap.h"
+
+GrB_Info GxB_Matrix_mmap_read       // map a matrix from a file
+(
+    // output:
+    GrB_Matrix *C,      // output matrix mapped from the file
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the file holds a
+                        // matrix of user-defined type.  May be NULL if the
+                        // file holds a built-in type; otherwise must match
+                        // the type of C.
+    const char *filename    // file to map
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_mmap_read (&C, type, filename)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap_read") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (filename) ;
+
+    //--------------------------------------------------------------------------
+    // map the file
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_mmap_read (C, type, filename) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap_write: write a matrix to a file that can be mapped
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_mmap_write writes the content of a matrix to a file, with no
+// compression, so that it can be mapped into memory by GxB_Matrix_mmap_read.
+
+#include "GB.h"
+#include "mmap/GB_mmap.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_mmap_write      // write a matrix to a file for mmap
+(
+    const char *filename,           // file to write
+    const GrB_Matrix A              // matrix to write
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_mmap_write (filename, A)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap_write") ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work in A, and write it to the file
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_MATRIX_WAIT (A) ;
+    info = GB_mmap_write (filename, A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -105,10 +105,11 @@
     GB_FREE_WORK (&Hx_all, Hx_all_size) ;           \
 }
 
-#define GB_FREE_ALL             \
-{                               \
-    GB_FREE_WORKSPACE ;         \
-    GB_phybix_free (C) ;        \
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORKSPACE ;                             \
+    GB_AxB_saxpy3_werk_free (werk_Context) ;        \
+    GB_phybix_free (C) ;                            \
 }
 
 //------------------------------------------------------------------------------
@@ -184,6 +185,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int64_t *restrict Hf_all = NULL ; size_t Hf_all_size = 0 ;
     GB_void *restrict Hx_all = NULL ; size_t Hx_all_size = 0 ;
     GB_saxpy3task_struct *SaxpyTasks = NULL ; size_t SaxpyTasks_size = 0 ;
+    // the Context that holds the workspace, if it is kept for later calls
+    GxB_Context werk_Context = NULL ;
 
     //--------------------------------------------------------------------------
     // construct the hyper hashes for M and A
@@ -273,7 +276,24 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+    // look for a plan from a prior call with the same key, if the Context
+    // engaged by this user thread keeps any plans
+    GB_saxpy3_plan_key plan_key ;
+    bool keep_plan = GB_AxB_saxpy3_plan_key (&plan_key, C_sparsity, M,
+        Mask_comp, Mask_struct, A, B, AxB_method, builtin_semiring,
+        nthreads_max, chunk) ;
+    GB_saxpy3_plan plan = keep_plan ?
+        GB_AxB_saxpy3_plan_find (&plan_key, nthreads_max, chunk) : NULL ;
+
+    if (plan != NULL)
+    { 
+        // Reuse the tasks from a prior call with the same key.  This skips
+        // the flopcount analysis and the construction of the tasks.
+        GBURBLE ("(saxpy3 plan) ") ;
+        info = GB_AxB_saxpy3_plan_tasks (&SaxpyTasks, &SaxpyTasks_size,
+            &apply_mask, &M_in_place, &ntasks, &nfine, &nthreads, plan) ;
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
         GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
@@ -362,7 +382,12 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //
     //      Hf starts out all zero (via calloc), and mark starts out as 1.  To
     //      clear Hf, mark is incremented, so that all entries in Hf are not
-    //      equal to mark.
+    //      equal to mark.  If the workspace is kept in the Context, Hf is
+    //      not zero but all its entries are <= mark0 for each coarse task,
+    //      and mark starts at mark0+1 instead.
+    //
+    // The fine tasks use a separate Hf, which is calloc'd, or is kept in the
+    // Context and cleared there before it is reused.
 
     // add some padding to the end of each hash table, to avoid false
     // sharing of cache lines between the hash tables.  But only add the
@@ -380,8 +405,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     }
 
     size_t Hi_size_total = 0 ;
-    size_t Hf_size_total = 0 ;
+    size_t Hf_fine_total = 0 ;      // size of Hf for fine tasks
+    size_t Hf_coarse_total = 0 ;    // size of Hf for coarse tasks
     size_t Hx_size_total = 0 ;
+    int64_t mark_advance = 0 ;      // largest mark of any coarse task
 
     //--------------------------------------------------------------------------
     // determine the total size of all hash tables
@@ -429,6 +456,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                 // coarse hash task
                 ncoarse_hash++ ;
             }
+            // each coarse task increments its mark at most 4 times per vector
+            int64_t nk = SaxpyTasks [taskid].end - SaxpyTasks [taskid].start
+                + 1 ;
+            mark_advance = GB_IMAX (mark_advance, 4*nk + 4) ;
         }
 
         if (taskid != SaxpyTasks [taskid].leader)
@@ -450,12 +481,16 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // Hf is int8_t for the fine Gustavson tasks, but round up
             // to the nearest number of int64_t values.
             int64_t hi_size2 = GB_IMAX (hi_size, 64) ;
-            Hf_size_total += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
+            Hf_fine_total += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
         }
-        else
+        else if (is_fine)
         { 
             // Hf is int64_t for all other methods
-            Hf_size_total += hi_size ;
+            Hf_fine_total += hi_size ;
+        }
+        else
+        { 
+            Hf_coarse_total += hi_size ;
         }
         if (!is_fine && !use_Gustavson)
         { 
@@ -481,37 +516,61 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // allocate space for all hash tables
     //--------------------------------------------------------------------------
 
-    if (Hi_size_total > 0)
-    { 
-        Hi_all = GB_MALLOC_WORK (Hi_size_total, int64_t, &Hi_all_size) ;
-    }
-    if (Hf_size_total > 0)
-    { 
-        // Hf must be calloc'd to initialize all entries as empty 
-        Hf_all = GB_CALLOC_WORK (Hf_size_total, int64_t, &Hf_all_size) ;
-    }
-    if (Hx_size_total > 0)
+    int64_t *Hi_part = NULL ;
+    int64_t *Hf_fine_part = NULL ;
+    int64_t *Hf_coarse_part = NULL ;
+    GB_void *Hx_part = NULL ;
+    int64_t mark0 = 0 ;
+
+    GxB_Context Context = GB_Context_mxm_workspace ( ) ;
+    if (Context != NULL)
     { 
-        Hx_all = GB_MALLOC_WORK (Hx_size_total * csize, GB_void, &Hx_all_size) ;
+        // use the workspace kept in the Context engaged by this user thread
+        werk_Context = Context ;
+        GB_OK (GB_AxB_saxpy3_werk_get (&Hf_fine_part, &Hf_coarse_part,
+            &mark0, &Hi_part, &Hx_part, Context, Hf_fine_total,
+            Hf_coarse_total, Hi_size_total, Hx_size_total * csize,
+            mark_advance, nthreads_max)) ;
     }
+    else
+    {
 
-    if ((Hi_size_total > 0 && Hi_all == NULL) ||
-        (Hf_size_total > 0 && Hf_all == NULL) || 
-        (Hx_size_total > 0 && Hx_all == NULL))
-    { 
-        // out of memory
-        GB_FREE_ALL ;
-        return (GrB_OUT_OF_MEMORY) ;
+        size_t Hf_size_total = Hf_fine_total + Hf_coarse_total ;
+        if (Hi_size_total > 0)
+        { 
+            Hi_all = GB_MALLOC_WORK (Hi_size_total, int64_t, &Hi_all_size) ;
+        }
+        if (Hf_size_total > 0)
+        { 
+            // Hf must be calloc'd to initialize all entries as empty 
+            Hf_all = GB_CALLOC_WORK (Hf_size_total, int64_t, &Hf_all_size) ;
+        }
+        if (Hx_size_total > 0)
+        { 
+            Hx_all = GB_MALLOC_WORK (Hx_size_total * csize, GB_void,
+                &Hx_all_size) ;
+        }
+
+        if ((Hi_size_total > 0 && Hi_all == NULL) ||
+            (Hf_size_total > 0 && Hf_all == NULL) || 
+            (Hx_size_total > 0 && Hx_all == NULL))
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        // the fine tasks come first, followed by the coarse tasks
+        Hi_part = Hi_all ;
+        Hf_fine_part = Hf_all ;
+        Hf_coarse_part = (Hf_all == NULL) ? NULL : (Hf_all + Hf_fine_total) ;
+        Hx_part = Hx_all ;
     }
 
     //--------------------------------------------------------------------------
     // split the space into separate hash tables
     //--------------------------------------------------------------------------
 
-    int64_t *restrict Hi_part = Hi_all ;
-    int64_t *restrict Hf_part = Hf_all ;
-    GB_void *restrict Hx_part = Hx_all ;
-
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
 
@@ -528,8 +587,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         bool use_Gustavson = (hash_size == cvlen) ;
 
         SaxpyTasks [taskid].Hi = Hi_part ;
-        SaxpyTasks [taskid].Hf = (GB_void *) Hf_part ;
+        SaxpyTasks [taskid].Hf = (GB_void *)
+            (is_fine ? Hf_fine_part : Hf_coarse_part) ;
         SaxpyTasks [taskid].Hx = Hx_part ;
+        SaxpyTasks [taskid].mark0 = mark0 ;
 
         int64_t hi_size = GB_IMAX (hash_size, 8) ;
         int64_t hx_size = hi_size ;
@@ -543,12 +604,16 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // Hf is int8_t for the fine Gustavson tasks, but round up
             // to the nearest number of int64_t values.
             int64_t hi_size2 = GB_IMAX (hi_size, 64) ;
-            Hf_part += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
+            Hf_fine_part += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
         }
-        else
+        else if (is_fine)
         { 
             // Hf is int64_t for all other methods
-            Hf_part += hi_size ;
+            Hf_fine_part += hi_size ;
+        }
+        else
+        { 
+            Hf_coarse_part += hi_size ;
         }
         if (!is_fine && !use_Gustavson)
         { 
@@ -585,10 +650,35 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // TODO constructing the tasks (the work above) can take a lot of time.
     // See the web graph, where it takes a total of 3.03 sec for 64 trials, vs
     // a total of 5.9 second for phase 7 (the numerical work below).
-    // Figure out a faster method.
+    // Figure out a faster method.  If the Context engaged by the user thread
+    // keeps saxpy3 plans, a later call with the same patterns of M, A, and B
+    // reuses the tasks and the counts for the coarse tasks from its plan.
 
-    GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
-        A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    if (plan != NULL)
+    {
+        // nnz(C(:,j)) for the vectors of coarse tasks is already in the plan.
+        // The fine tasks are first in the task list, so only those tasks need
+        // to scatter the mask M into their hash tables.
+        int nth = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        GB_memcpy (Cp, plan->Cp, (cnvec+1) * sizeof (int64_t), nth) ;
+        if (M != NULL && nfine > 0)
+        { 
+            GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+                A, B, SaxpyTasks, nfine, nfine, nthreads) ;
+        }
+    }
+    else
+    {
+        GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+        if (keep_plan)
+        { 
+            // keep this analysis in the Context for later calls
+            GB_AxB_saxpy3_plan_save (&plan_key, nthreads_max, chunk,
+                SaxpyTasks, ntasks, nfine, nthreads, apply_mask, M_in_place,
+                Cp, cnvec) ;
+        }
+    }
 
     //==========================================================================
     // C = A*B, via saxpy3 method, phases 2 to 5
@@ -62,6 +62,178 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
 #include "mxm/include/GB_saxpy3task_struct.h"
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_plan: saxpy3 analysis kept in a GxB_Context for reuse
+//------------------------------------------------------------------------------
+
+// A saxpy3 plan holds the results of phase0 (the tasks constructed by
+// GB_AxB_saxpy3_slice_balanced or GB_AxB_saxpy3_slice_quick, including the
+// choice of the Hash or Gustavson method for each task) and of phase1 for the
+// coarse tasks (the count nnz(C(:,j)) for each of their vectors, from
+// GB_AxB_saxpy3_symbolic).  Neither depends on the semiring or on the values
+// of A and B, so a plan can be reused by a later C=A*B, C<M>=A*B, or
+// C<!M>=A*B whose inputs have the same key.  The key holds the dimensions,
+// sparsity formats and entry counts of M, A, and B, the mask and Context
+// settings, and a hash of the patterns of M, A, and B (and the values of M, if
+// M is not structural).  The hash only rejects most other problems quickly: a
+// plan also keeps a copy of the arrays that were hashed, and it is reused only
+// if these match the arrays of the new problem exactly.
+
+// Plans are kept only in a user-created GxB_Context, after enabling them with
+// GrB_set (Context, n, GxB_MXM_PLAN), and only while that Context is engaged
+// by the user thread.  Up to n plans (at most GB_SAXPY3_PLAN_MAX) are kept;
+// when all are in use, the oldest is replaced.
+
+#define GB_SAXPY3_PLAN_MAX 16
+#define GB_SAXPY3_PLAN_NKEY 24
+#define GB_SAXPY3_PLAN_NARRAYS 10
+
+typedef struct
+{
+    uint64_t hash ;             // hash of the patterns of M, A, and B
+    int64_t key [GB_SAXPY3_PLAN_NKEY] ; // dimensions, nnz, sparsity, options
+    int narrays ;               // # of arrays hashed
+    int64_t nbytes [GB_SAXPY3_PLAN_NARRAYS] ;   // size of each array hashed
+    // the arrays hashed, in the problem for which the key was constructed
+    // (these are NULL in the key of a plan, which keeps a copy instead)
+    const void *array [GB_SAXPY3_PLAN_NARRAYS] ;
+}
+GB_saxpy3_plan_key ;
+
+struct GB_saxpy3_plan_struct
+{
+    GB_saxpy3_plan_key key ;    // key of the problem analyzed by this plan
+    GB_void *Pattern ;          // copy of the arrays hashed, concatenated
+    size_t Pattern_size ;
+    GB_saxpy3task_struct *SaxpyTasks ;  // tasks, with no workspace
+    size_t SaxpyTasks_size ;
+    int64_t *Cp ;               // nnz(C(:,j)) for vectors of coarse tasks
+    size_t Cp_size ;
+    int ntasks ;                // # of tasks (coarse and fine)
+    int nfine ;                 // # of fine tasks
+    int nthreads ;              // # of threads to use
+    bool apply_mask ;           // if true, apply M during saxpy3
+    bool M_in_place ;           // if true, use M in-place
+} ;
+
+typedef struct GB_saxpy3_plan_struct *GB_saxpy3_plan ;
+
+bool GB_AxB_saxpy3_plan_key     // true if a plan can be used for this problem
+(
+    // output:
+    GB_saxpy3_plan_key *plan_key,   // key for this problem
+    // input:
+    int C_sparsity,             // sparse or hypersparse
+    const GrB_Matrix M,         // optional mask matrix
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_Matrix A,         // input matrix A
+    const GrB_Matrix B,         // input matrix B
+    GrB_Desc_Value AxB_method,  // Default, Gustavson, or Hash
+    bool builtin_semiring,      // if true, semiring is builtin
+    int nthreads_max,           // Context settings
+    double chunk
+) ;
+
+GB_saxpy3_plan GB_AxB_saxpy3_plan_find  // find a plan, or NULL if none
+(
+    const GB_saxpy3_plan_key *plan_key,
+    int nthreads_max,           // Context settings
+    double chunk
+) ;
+
+GrB_Info GB_AxB_saxpy3_plan_tasks       // get the tasks from a plan
+(
+    // outputs:
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    // input:
+    const GB_saxpy3_plan plan
+) ;
+
+void GB_AxB_saxpy3_plan_save    // save the saxpy3 analysis as a new plan
+(
+    const GB_saxpy3_plan_key *plan_key,
+    int nthreads_max,           // Context settings
+    double chunk,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const bool apply_mask,
+    const bool M_in_place,
+    const int64_t *Cp,          // nnz(C(:,j)) for vectors of coarse tasks
+    const int64_t cnvec
+) ;
+
+void GB_AxB_saxpy3_plans_free   // free all plans kept in a Context
+(
+    GxB_Context Context
+) ;
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_werk: saxpy3 workspace kept in a GxB_Context for reuse
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy3 allocates its hash tables (Hi, Hf, and Hx) on each call, and
+// Hf must be calloc'd.  For many small products (as in each step of a BFS)
+// this can dominate the run time.  After GrB_set (Context, true,
+// GxB_MXM_WORKSPACE), the Context engaged by the user thread keeps these
+// arrays from one call to the next, growing them as needed.
+
+// The Hf arrays are not cleared after each call.  The coarse tasks use
+// Hf_coarse, where all entries are <= mark.  Each coarse task starts with its
+// own mark0 = mark, instead of zero, and mark is then advanced past any value
+// the tasks can write, so Hf_coarse is never cleared.  The fine tasks use
+// Hf_fine, whose int8_t and int64_t states cannot be offset by a mark.  They
+// leave it dirty, and the part used by the last call is cleared only when the
+// workspace is reused.  Hi and Hx are never initialized.  If an error occurs,
+// the workspace is freed.
+
+struct GB_saxpy3_werk_struct
+{
+    int64_t *Hf_fine ;          // Hf for fine tasks
+    size_t Hf_fine_size ;
+    size_t Hf_fine_used ;       // # of bytes of Hf_fine that may be nonzero
+    int64_t *Hf_coarse ;        // Hf for coarse tasks; all <= mark
+    size_t Hf_coarse_size ;
+    int64_t mark ;              // generation counter for Hf_coarse
+    int64_t *Hi ;               // Hi for coarse hash tasks
+    size_t Hi_size ;
+    GB_void *Hx ;               // Hx for all tasks
+    size_t Hx_size ;
+} ;
+
+GrB_Info GB_AxB_saxpy3_werk_get     // get the workspace kept in a Context
+(
+    // outputs:
+    int64_t **Hf_fine,          // size Hf_fine_n, all zero
+    int64_t **Hf_coarse,        // size Hf_coarse_n, all <= *mark0
+    int64_t *mark0,             // initial mark for all coarse tasks
+    int64_t **Hi,               // size Hi_n, not initialized
+    GB_void **Hx,               // size Hx_bytes, not initialized
+    // input/output:
+    GxB_Context Context,
+    // inputs:
+    size_t Hf_fine_n,
+    size_t Hf_coarse_n,
+    size_t Hi_n,
+    size_t Hx_bytes,
+    int64_t mark_advance,       // largest mark any coarse task can reach,
+                                // relative to mark0
+    int nthreads_max            // # of threads to clear Hf_fine
+) ;
+
+void GB_AxB_saxpy3_werk_free    // free the workspace kept in a Context
+(
+    GxB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_flopcount:  compute flops for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
@@ -0,0 +1,532 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: keep the saxpy3 analysis for reuse by later calls
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Iterative methods often compute C=A*B many times where the patterns of A and
+// B do not change, only their values.  GB_AxB_saxpy3 then repeats the same
+// flopcount analysis, task construction, and symbolic phase on each call.  A
+// saxpy3 plan keeps the results of this analysis in the GxB_Context engaged by
+// the user thread, so that a later call with the same key can skip it and go
+// straight to the numeric phase.  See GB_AxB_saxpy3.h for a description.
+
+// The patterns of M, A, and B are hashed into the key, so most plans for other
+// problems are rejected by comparing the keys alone.  A plan with the same key
+// is reused only if the copy of the arrays it keeps matches the arrays of the
+// new problem exactly, so a hash collision cannot cause a wrong plan to be
+// used.
+
+// The Context is private to the user thread that engaged it, so no locks are
+// needed to access its plans.  GxB_CONTEXT_WORLD never keeps any plans.
+
+#include "mxm/GB_AxB_saxpy3.h"
+
+// xxHash uses switch statements with no default case.
+#if GB_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#define XXH_INLINE_ALL
+#define XXH_NO_STREAM
+#include "xxhash.h"
+
+// arrays are hashed in independent blocks of this many bytes, in parallel
+#define GB_PLAN_BLOCK (1024*1024)
+
+//------------------------------------------------------------------------------
+// GB_plan_hash: hash an array of bytes, in parallel
+//------------------------------------------------------------------------------
+
+static bool GB_plan_hash        // return false if out of memory
+(
+    uint64_t *hash,             // input: prior hash, output: updated hash
+    const void *X,              // array to hash (may be NULL)
+    int64_t nbytes,             // size of X in bytes
+    int nthreads_max,
+    double chunk
+)
+{
+
+    if (X == NULL || nbytes <= 0)
+    { 
+        // nothing to hash
+        return (true) ;
+    }
+
+    int64_t nblocks = GB_ICEIL (nbytes, GB_PLAN_BLOCK) ;
+    if (nblocks == 1)
+    { 
+        // hash a small array with a single call
+        (*hash) = XXH3_64bits_withSeed (X, nbytes, (*hash)) ;
+        return (true) ;
+    }
+
+    // hash each block of X, and then hash the block hashes.  The blocks do
+    // not depend on the # of threads, so neither does the result.
+    size_t Blocks_size = 0 ;
+    uint64_t *restrict Blocks = GB_MALLOC_WORK (nblocks, uint64_t,
+        &Blocks_size) ;
+    if (Blocks == NULL)
+    { 
+        // out of memory
+        return (false) ;
+    }
+
+    const GB_void *restrict Xb = (const GB_void *) X ;
+    int nthreads = GB_nthreads (nbytes / sizeof (int64_t), chunk,
+        nthreads_max) ;
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (b = 0 ; b < nblocks ; b++)
+    { 
+        int64_t p = b * GB_PLAN_BLOCK ;
+        int64_t n = GB_IMIN (GB_PLAN_BLOCK, nbytes - p) ;
+        Blocks [b] = XXH3_64bits (Xb + p, n) ;
+    }
+
+    (*hash) = XXH3_64bits_withSeed (Blocks, nblocks * sizeof (uint64_t),
+        (*hash)) ;
+    GB_FREE_WORK (&Blocks, Blocks_size) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_plan_same: compare two arrays of bytes, in parallel
+//------------------------------------------------------------------------------
+
+static bool GB_plan_same        // true if X and Y are identical
+(
+    const void *X,
+    const void *Y,
+    int64_t nbytes,             // size of X and Y in bytes
+    int nthreads_max,
+    double chunk
+)
+{
+
+    int64_t nblocks = GB_ICEIL (nbytes, GB_PLAN_BLOCK) ;
+    if (nblocks <= 1)
+    { 
+        return (nbytes <= 0 || memcmp (X, Y, nbytes) == 0) ;
+    }
+
+    const GB_void *restrict Xb = (const GB_void *) X ;
+    const GB_void *restrict Yb = (const GB_void *) Y ;
+    int nthreads = GB_nthreads (nbytes / sizeof (int64_t), chunk,
+        nthreads_max) ;
+    bool same = true ;
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:same)
+    for (b = 0 ; b < nblocks ; b++)
+    { 
+        int64_t p = b * GB_PLAN_BLOCK ;
+        int64_t n = GB_IMIN (GB_PLAN_BLOCK, nbytes - p) ;
+        same = same && (memcmp (Xb + p, Yb + p, n) == 0) ;
+    }
+    return (same) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_plan_add: add an array to the list of arrays hashed into a key
+//------------------------------------------------------------------------------
+
+static void GB_plan_add
+(
+    GB_saxpy3_plan_key *plan_key,
+    const void *X,              // array to add (may be NULL)
+    int64_t nbytes              // size of X in bytes
+)
+{
+    if (X != NULL && nbytes > 0)
+    { 
+        int a = plan_key->narrays++ ;
+        ASSERT (a < GB_SAXPY3_PLAN_NARRAYS) ;
+        plan_key->array [a] = X ;
+        plan_key->nbytes [a] = nbytes ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_plan_add_pattern: add the pattern of a matrix to the arrays of a key
+//------------------------------------------------------------------------------
+
+static void GB_plan_add_pattern
+(
+    GB_saxpy3_plan_key *plan_key,
+    const GrB_Matrix A
+)
+{
+    int64_t anz = GB_nnz_held (A) ;
+    int64_t anvec = A->nvec ;
+    if (A->p != NULL)
+    { 
+        // A is sparse or hypersparse
+        GB_plan_add (plan_key, A->p, (anvec+1) * sizeof (int64_t)) ;
+        GB_plan_add (plan_key, A->h, anvec * sizeof (int64_t)) ;
+        GB_plan_add (plan_key, A->i, anz * sizeof (int64_t)) ;
+    }
+    else
+    { 
+        // A is bitmap or full
+        GB_plan_add (plan_key, A->b, anz * sizeof (int8_t)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_key: construct the key for C=A*B
+//------------------------------------------------------------------------------
+
+// Returns false if the Context engaged by this user thread keeps no plans, or
+// if out of memory.  The key is not constructed in that case, and the hash of
+// the patterns of M, A, and B is not computed.
+
+bool GB_AxB_saxpy3_plan_key     // true if a plan can be used for this problem
+(
+    // output:
+    GB_saxpy3_plan_key *plan_key,   // key for this problem
+    // input:
+    int C_sparsity,             // sparse or hypersparse
+    const GrB_Matrix M,         // optional mask matrix
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_Matrix A,         // input matrix A
+    const GrB_Matrix B,         // input matrix B
+    GrB_Desc_Value AxB_method,  // Default, Gustavson, or Hash
+    bool builtin_semiring,      // if true, semiring is builtin
+    int nthreads_max,           // Context settings
+    double chunk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if this user thread keeps any plans
+    //--------------------------------------------------------------------------
+
+    if (GB_Context_mxm_plans ( ) == NULL)
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the key
+    //--------------------------------------------------------------------------
+
+    memset (plan_key, 0, sizeof (GB_saxpy3_plan_key)) ;
+    int64_t *key = plan_key->key ;
+    int k = 0 ;
+
+    // A and B
+    key [k++] = A->vlen ;
+    key [k++] = A->vdim ;
+    key [k++] = B->vdim ;
+    key [k++] = A->nvec ;
+    key [k++] = B->nvec ;
+    key [k++] = GB_sparsity (A) ;
+    key [k++] = GB_sparsity (B) ;
+    key [k++] = GB_nnz_held (A) ;
+    key [k++] = GB_nnz_held (B) ;
+    key [k++] = A->jumbled ;
+    key [k++] = B->jumbled ;
+
+    // M
+    bool M_valued = (M != NULL && !Mask_struct) ;
+    key [k++] = (M == NULL) ? 0 : GB_sparsity (M) ;
+    key [k++] = (M == NULL) ? -1 : M->nvec ;
+    key [k++] = (M == NULL) ? -1 : GB_nnz_held (M) ;
+    key [k++] = (M == NULL) ? 0 : M->jumbled ;
+    key [k++] = M_valued ? M->type->size : 0 ;
+    key [k++] = M_valued ? M->iso : 0 ;
+    key [k++] = Mask_comp ;
+    key [k++] = Mask_struct ;
+
+    // method and Context settings
+    key [k++] = AxB_method ;
+    key [k++] = builtin_semiring ;
+    key [k++] = C_sparsity ;
+    key [k++] = nthreads_max ;
+    memcpy (&(key [k++]), &chunk, sizeof (double)) ;
+    ASSERT (k == GB_SAXPY3_PLAN_NKEY) ;
+
+    //--------------------------------------------------------------------------
+    // hash the patterns of M, A, and B, and the values of M if valued
+    //--------------------------------------------------------------------------
+
+    GB_plan_add_pattern (plan_key, A) ;
+    GB_plan_add_pattern (plan_key, B) ;
+    if (M != NULL)
+    {
+        GB_plan_add_pattern (plan_key, M) ;
+        if (M_valued)
+        { 
+            int64_t mnz = M->iso ? 1 : GB_nnz_held (M) ;
+            GB_plan_add (plan_key, M->x, mnz * M->type->size) ;
+        }
+    }
+
+    uint64_t hash = 0 ;
+    bool ok = true ;
+    for (int a = 0 ; a < plan_key->narrays && ok ; a++)
+    { 
+        ok = GB_plan_hash (&hash, plan_key->array [a], plan_key->nbytes [a],
+            nthreads_max, chunk) ;
+    }
+    plan_key->hash = hash ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_find: find a plan with the same key
+//------------------------------------------------------------------------------
+
+// A plan is found only if its key matches, and if the arrays hashed into its
+// key are identical to the arrays of the new problem.
+
+GB_saxpy3_plan GB_AxB_saxpy3_plan_find  // find a plan, or NULL if none
+(
+    const GB_saxpy3_plan_key *plan_key,
+    int nthreads_max,           // Context settings
+    double chunk
+)
+{
+
+    GxB_Context Context = GB_Context_mxm_plans ( ) ;
+    if (Context == NULL || Context->mxm_plans == NULL)
+    { 
+        return (NULL) ;
+    }
+
+    for (int k = 0 ; k < Context->mxm_plan_max ; k++)
+    {
+        GB_saxpy3_plan plan = &(Context->mxm_plans [k]) ;
+        if (plan->SaxpyTasks == NULL
+            || plan->key.hash != plan_key->hash
+            || plan->key.narrays != plan_key->narrays
+            || memcmp (plan->key.key, plan_key->key,
+                GB_SAXPY3_PLAN_NKEY * sizeof (int64_t)) != 0
+            || memcmp (plan->key.nbytes, plan_key->nbytes,
+                plan_key->narrays * sizeof (int64_t)) != 0)
+        { 
+            // the keys differ
+            continue ;
+        }
+        // the keys match; compare the arrays with the copy in the plan
+        const GB_void *Pattern = plan->Pattern ;
+        bool same = true ;
+        for (int a = 0 ; a < plan_key->narrays && same ; a++)
+        { 
+            same = GB_plan_same (Pattern, plan_key->array [a],
+                plan_key->nbytes [a], nthreads_max, chunk) ;
+            Pattern += plan_key->nbytes [a] ;
+        }
+        if (same)
+        { 
+            return (plan) ;
+        }
+    }
+    return (NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_tasks: get a copy of the tasks from a plan
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_plan_tasks       // get the tasks from a plan
+(
+    // outputs:
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    // input:
+    const GB_saxpy3_plan plan
+)
+{
+
+    size_t SaxpyTasks_size = 0 ;
+    GB_saxpy3task_struct *SaxpyTasks = GB_MALLOC_WORK (plan->ntasks,
+        GB_saxpy3task_struct, &SaxpyTasks_size) ;
+    if (SaxpyTasks == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // the plan has no workspace; it is allocated by the caller
+    memcpy (SaxpyTasks, plan->SaxpyTasks,
+        plan->ntasks * sizeof (GB_saxpy3task_struct)) ;
+
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    (*apply_mask) = plan->apply_mask ;
+    (*M_in_place) = plan->M_in_place ;
+    (*ntasks) = plan->ntasks ;
+    (*nfine) = plan->nfine ;
+    (*nthreads) = plan->nthreads ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_plan_clear: free the contents of a single plan
+//------------------------------------------------------------------------------
+
+static void GB_plan_clear (GB_saxpy3_plan plan)
+{ 
+    GB_FREE (&(plan->SaxpyTasks), plan->SaxpyTasks_size) ;
+    GB_FREE (&(plan->Cp), plan->Cp_size) ;
+    GB_FREE (&(plan->Pattern), plan->Pattern_size) ;
+    memset (plan, 0, sizeof (struct GB_saxpy3_plan_struct)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: save the saxpy3 analysis as a new plan
+//------------------------------------------------------------------------------
+
+// If out of memory, the plan is silently discarded.  Plans are an
+// optimization only; the current C=A*B is not affected.  The plan keeps a
+// copy of the arrays hashed into its key, which takes as much memory as the
+// patterns of M, A, and B.
+
+void GB_AxB_saxpy3_plan_save    // save the saxpy3 analysis as a new plan
+(
+    const GB_saxpy3_plan_key *plan_key,
+    int nthreads_max,           // Context settings
+    double chunk,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const bool apply_mask,
+    const bool M_in_place,
+    const int64_t *Cp,          // nnz(C(:,j)) for vectors of coarse tasks
+    const int64_t cnvec
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the Context and allocate its plans, if not already allocated
+    //--------------------------------------------------------------------------
+
+    GxB_Context Context = GB_Context_mxm_plans ( ) ;
+    if (Context == NULL)
+    { 
+        return ;
+    }
+
+    int mxm_plan_max = Context->mxm_plan_max ;
+    if (Context->mxm_plans == NULL)
+    {
+        Context->mxm_plans = GB_CALLOC (mxm_plan_max,
+            struct GB_saxpy3_plan_struct, &(Context->mxm_plans_size)) ;
+        Context->mxm_plan_next = 0 ;
+        if (Context->mxm_plans == NULL)
+        { 
+            // out of memory
+            return ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find an empty plan, or replace the oldest one
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3_plan plan = NULL ;
+    for (int k = 0 ; k < mxm_plan_max && plan == NULL ; k++)
+    {
+        if (Context->mxm_plans [k].SaxpyTasks == NULL)
+        { 
+            plan = &(Context->mxm_plans [k]) ;
+        }
+    }
+    if (plan == NULL)
+    { 
+        plan = &(Context->mxm_plans [Context->mxm_plan_next]) ;
+        Context->mxm_plan_next = (Context->mxm_plan_next + 1) % mxm_plan_max ;
+        GB_plan_clear (plan) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the tasks and the counts of coarse tasks into the plan
+    //--------------------------------------------------------------------------
+
+    int64_t pattern_nbytes = 0 ;
+    for (int a = 0 ; a < plan_key->narrays ; a++)
+    { 
+        pattern_nbytes += plan_key->nbytes [a] ;
+    }
+
+    plan->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct,
+        &(plan->SaxpyTasks_size)) ;
+    plan->Cp = GB_MALLOC (cnvec+1, int64_t, &(plan->Cp_size)) ;
+    plan->Pattern = GB_MALLOC (GB_IMAX (pattern_nbytes, 1), GB_void,
+        &(plan->Pattern_size)) ;
+    if (plan->SaxpyTasks == NULL || plan->Cp == NULL || plan->Pattern == NULL)
+    { 
+        // out of memory
+        GB_plan_clear (plan) ;
+        return ;
+    }
+
+    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    { 
+        // the hash tables are not kept in the plan
+        plan->SaxpyTasks [taskid] = SaxpyTasks [taskid] ;
+        plan->SaxpyTasks [taskid].Hi = NULL ;
+        plan->SaxpyTasks [taskid].Hf = NULL ;
+        plan->SaxpyTasks [taskid].Hx = NULL ;
+        plan->SaxpyTasks [taskid].my_cjnz = 0 ;
+    }
+    memcpy (plan->Cp, Cp, (cnvec+1) * sizeof (int64_t)) ;
+
+    // copy the arrays hashed into the key
+    int nth = GB_nthreads (pattern_nbytes / sizeof (int64_t), chunk,
+        nthreads_max) ;
+    GB_void *Pattern = plan->Pattern ;
+    for (int a = 0 ; a < plan_key->narrays ; a++)
+    { 
+        GB_memcpy (Pattern, plan_key->array [a], plan_key->nbytes [a], nth) ;
+        Pattern += plan_key->nbytes [a] ;
+    }
+
+    plan->key = (*plan_key) ;
+    for (int a = 0 ; a < GB_SAXPY3_PLAN_NARRAYS ; a++)
+    { 
+        // the arrays of this problem are not kept
+        plan->key.array [a] = NULL ;
+    }
+    plan->ntasks = ntasks ;
+    plan->nfine = nfine ;
+    plan->nthreads = nthreads ;
+    plan->apply_mask = apply_mask ;
+    plan->M_in_place = M_in_place ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plans_free: free all plans kept in a Context
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plans_free   // free all plans kept in a Context
+(
+    GxB_Context Context
+)
+{
+
+    if (Context == NULL || Context->mxm_plans == NULL)
+    { 
+        return ;
+    }
+
+    for (int k = 0 ; k < Context->mxm_plan_max ; k++)
+    { 
+        GB_plan_clear (&(Context->mxm_plans [k])) ;
+    }
+    GB_FREE (&(Context->mxm_plans), Context->mxm_plans_size) ;
+    Context->mxm_plan_next = 0 ;
+}
@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_werk: keep the saxpy3 workspace for reuse by later calls
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The saxpy3 workspace (Hf, Hi, and Hx) is kept in the GxB_Context engaged by
+// the user thread, if GxB_MXM_WORKSPACE is true for that Context.  See
+// GB_AxB_saxpy3.h for a description.  The Context is private to the user
+// thread that engaged it, so no locks are needed.
+
+#include "mxm/GB_AxB_saxpy3.h"
+
+// reset Hf_coarse when mark gets this large
+#define GB_WERK_MARK_MAX (INT64_MAX / 2)
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_werk_free: free the workspace kept in a Context
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_werk_free    // free the workspace kept in a Context
+(
+    GxB_Context Context
+)
+{
+
+    if (Context == NULL || Context->mxm_werk == NULL)
+    {
+        return ;
+    }
+
+    struct GB_saxpy3_werk_struct *werk = Context->mxm_werk ;
+    GB_FREE (&(werk->Hf_fine), werk->Hf_fine_size) ;
+    GB_FREE (&(werk->Hf_coarse), werk->Hf_coarse_size) ;
+    GB_FREE (&(werk->Hi), werk->Hi_size) ;
+    GB_FREE (&(werk->Hx), werk->Hx_size) ;
+    GB_FREE (&(Context->mxm_werk), Context->mxm_werk_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_werk_grow: ensure an array has at least n bytes
+//------------------------------------------------------------------------------
+
+static bool GB_werk_grow        // return false if out of memory
+(
+    GB_void **X,                // array to grow
+    size_t *X_size,             // its allocated size, in bytes
+    size_t n,                   // required size, in bytes
+    bool clear                  // if true, a new array is calloc'd
+)
+{
+    if ((*X_size) >= n)
+    {
+        // the array is already large enough
+        return (true) ;
+    }
+    // free the old array and allocate a new one; its old content is not kept
+    GB_FREE (X, *X_size) ;
+    if (clear)
+    {
+        (*X) = GB_CALLOC (n, GB_void, X_size) ;
+    }
+    else
+    {
+        (*X) = GB_MALLOC (n, GB_void, X_size) ;
+    }
+    return ((*X) != NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_werk_get: get the workspace kept in a Context
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_werk_get     // get the workspace kept in a Context
+(
+    // outputs:
+    int64_t **Hf_fine,          // size Hf_fine_n, all zero
+    int64_t **Hf_coarse,        // size Hf_coarse_n, all <= *mark0
+    int64_t *mark0,             // initial mark for all coarse tasks
+    int64_t **Hi,               // size Hi_n, not initialized
+    GB_void **Hx,               // size Hx_bytes, not initialized
+    // input/output:
+    GxB_Context Context,
+    // inputs:
+    size_t Hf_fine_n,
+    size_t Hf_coarse_n,
+    size_t Hi_n,
+    size_t Hx_bytes,
+    int64_t mark_advance,       // largest mark any coarse task can reach,
+                                // relative to mark0
+    int nthreads_max            // # of threads to clear Hf_fine
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace struct, if this is the first use
+    //--------------------------------------------------------------------------
+
+    ASSERT (Context != NULL && Context != GxB_CONTEXT_WORLD) ;
+    (*Hf_fine) = NULL ;
+    (*Hf_coarse) = NULL ;
+    (*mark0) = 0 ;
+    (*Hi) = NULL ;
+    (*Hx) = NULL ;
+
+    if (Context->mxm_werk == NULL)
+    {
+        Context->mxm_werk = GB_CALLOC (1, struct GB_saxpy3_werk_struct,
+            &(Context->mxm_werk_size)) ;
+        if (Context->mxm_werk == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+    struct GB_saxpy3_werk_struct *werk = Context->mxm_werk ;
+
+    //--------------------------------------------------------------------------
+    // reset the mark for Hf_coarse, if it is getting too large
+    //--------------------------------------------------------------------------
+
+    if (werk->mark > GB_WERK_MARK_MAX - mark_advance)
+    {
+        // this will never occur in practice; the next call will calloc a new
+        // Hf_coarse, which is then all zero
+        GB_FREE (&(werk->Hf_coarse), werk->Hf_coarse_size) ;
+        werk->mark = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // grow each array as needed
+    //--------------------------------------------------------------------------
+
+    // The fine tasks leave their part of Hf_fine dirty.  It is cleared here,
+    // only if the array is reused; a new Hf_fine is calloc'd instead.  A new
+    // Hf_coarse is calloc'd, so all its entries are <= werk->mark.
+    size_t Hf_fine_bytes = Hf_fine_n * sizeof (int64_t) ;
+    if (werk->Hf_fine_size >= Hf_fine_bytes && werk->Hf_fine_used > 0)
+    {
+        GB_memset (werk->Hf_fine, 0,
+            GB_IMIN (werk->Hf_fine_used, werk->Hf_fine_size), nthreads_max) ;
+    }
+    werk->Hf_fine_used = 0 ;
+    if (!GB_werk_grow ((GB_void **) &(werk->Hf_fine), &(werk->Hf_fine_size),
+            Hf_fine_bytes, true) ||
+        !GB_werk_grow ((GB_void **) &(werk->Hf_coarse),
+            &(werk->Hf_coarse_size), Hf_coarse_n * sizeof (int64_t), true) ||
+        !GB_werk_grow ((GB_void **) &(werk->Hi), &(werk->Hi_size),
+            Hi_n * sizeof (int64_t), false) ||
+        !GB_werk_grow (&(werk->Hx), &(werk->Hx_size), Hx_bytes, false))
+    {
+        // out of memory
+        GB_AxB_saxpy3_werk_free (Context) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the workspace and advance the mark
+    //--------------------------------------------------------------------------
+
+    (*Hf_fine) = werk->Hf_fine ;
+    (*Hf_coarse) = werk->Hf_coarse ;
+    (*mark0) = werk->mark ;
+    (*Hi) = werk->Hi ;
+    (*Hx) = werk->Hx ;
+    werk->Hf_fine_used = Hf_fine_bytes ;
+    werk->mark += mark_advance ;
+    return (GrB_SUCCESS) ;
+}
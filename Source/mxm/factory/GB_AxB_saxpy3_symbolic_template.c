@@ -105,7 +105,8 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
     // phase1: count nnz(C(:,j)) for coarse tasks, scatter M for fine tasks
     //==========================================================================
 
-    // At this point, all of Hf [...] is zero, for all tasks.
+    // At this point, all of Hf [...] is zero for the fine tasks, and all of
+    // Hf [...] is <= SaxpyTasks [taskid].mark0 for each coarse task.
     // Hi and Hx are not initialized.
 
     int taskid ;
@@ -233,7 +234,7 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
                 Hf = (int64_t *restrict) SaxpyTasks [taskid].Hf ;
             int64_t kfirst = SaxpyTasks [taskid].start ;
             int64_t klast  = SaxpyTasks [taskid].end ;
-            int64_t mark = 0 ;
+            int64_t mark = SaxpyTasks [taskid].mark0 ;
 
             if (use_Gustavson)
             {
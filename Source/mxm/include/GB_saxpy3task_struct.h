@@ -10,7 +10,9 @@
 #ifndef GB_SAXPY3TASK_STRUCT_H
 #define GB_SAXPY3TASK_STRUCT_H
 
-// See GB_AxB_saxpy3.h for a description.
+// See GB_AxB_saxpy3.h for a description.  This struct is used by the JIT
+// kernels, which are rejected if compiled for another version of GraphBLAS
+// (see GB_jitifyer_load), so any change to it requires a new version number.
 
 typedef struct
 {
@@ -24,6 +26,7 @@ typedef struct
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
+    int64_t mark0 ;     // all of Hf is <= mark0 on input (coarse tasks only)
 }
 GB_saxpy3task_struct ;
 
@@ -81,6 +81,9 @@
 
     const int64_t vlen = A->vlen ;
 
+    // method for the intersection of A(:,i) and B(:,j) when both are sparse
+    GB_DECLARE_INTERSECT_METHOD (intersect_method) ;
+
     const int ntasks = naslice * nbslice ;
 
     //--------------------------------------------------------------------------
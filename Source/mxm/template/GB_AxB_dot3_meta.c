@@ -127,6 +127,9 @@
     #endif
 
     const int64_t vlen = A->vlen ;
+
+    // method for the intersection of A(:,i) and B(:,j) when both are sparse
+    GB_DECLARE_INTERSECT_METHOD (intersect_method) ;
     ASSERT (A->vlen == B->vlen) ;
 
     #ifdef GB_JIT_KERNEL
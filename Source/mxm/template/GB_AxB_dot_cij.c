@@ -555,7 +555,7 @@
                     // discard all entries A(ia:ib-1,i)
                     int64_t pleft = pA + 1 ;
                     int64_t pright = pA_end - 1 ;
-                    GB_TRIM_BINARY_SEARCH (ib, Ai, pleft, pright) ;
+                    GB_TRIM_GALLOP_SEARCH (ib, Ai, pleft, pright) ;
                     ASSERT (pleft > pA) ;
                     pA = pleft ;
                 }
@@ -600,7 +600,7 @@
                     // discard all entries B(ib:ia-1,j)
                     int64_t pleft = pB + 1 ;
                     int64_t pright = pB_end - 1 ;
-                    GB_TRIM_BINARY_SEARCH (ia, Bi, pleft, pright) ;
+                    GB_TRIM_GALLOP_SEARCH (ia, Bi, pleft, pright) ;
                     ASSERT (pleft > pB) ;
                     pB = pleft ;
                 }
@@ -625,30 +625,19 @@
             // A(:,i) and B(:,j) have about the same sparsity
             //------------------------------------------------------------------
 
-            while (pA < pA_end && pB < pB_end)
-            {
-                int64_t ia = Ai [pA] ;
-                int64_t ib = Bi [pB] ;
-                if (ia < ib)
-                { 
-                    // A(ia,i) appears before B(ib,j)
-                    pA++ ;
-                }
-                else if (ib < ia)
-                { 
-                    // B(ib,j) appears before A(ia,i)
-                    pB++ ;
-                }
-                else // ia == ib == k
-                { 
-                    // A(k,i) and B(k,j) are the next entries to merge
-                    GB_DOT (ia, pA, pB) ;
-                    #if GB_IS_MIN_FIRSTJ_SEMIRING
-                    break ;
-                    #endif
-                    pA++ ;
-                    pB++ ;
-                }
+            // linear-time merge, with blocks of 4 or 8 entries compared at
+            // once if the cpu has AVX2 or AVX512F (see GB_intersect.h)
+            while (GB_intersect_next (intersect_method,
+                Ai, &pA, pA_end, Bi, &pB, pB_end))
+            { 
+                // A(k,i) and B(k,j) are the next entries to merge
+                int64_t k = Ai [pA] ;
+                GB_DOT (k, pA, pB) ;
+                #if GB_IS_MIN_FIRSTJ_SEMIRING
+                break ;
+                #endif
+                pA++ ;
+                pB++ ;
             }
             GB_DOT_SAVE_CIJ ;
         }
@@ -453,7 +453,7 @@
             int64_t kfirst = SaxpyTasks [taskid].start ;
             int64_t klast = SaxpyTasks [taskid].end ;
             int64_t nk = klast - kfirst + 1 ;
-            int64_t mark = 2*nk + 1 ;
+            int64_t mark = SaxpyTasks [taskid].mark0 + 2*nk + 1 ;
 
             if (use_Gustavson)
             {
@@ -30,6 +30,7 @@ GrB_Info GxB_Matrix_unpack_FullR  // unpack a full matrix, by row
     GB_BURBLE_START ("GxB_Matrix_unpack_FullR") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_OK (GB_unshare (A, Werk)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
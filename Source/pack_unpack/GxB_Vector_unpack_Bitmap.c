@@ -33,6 +33,7 @@ GrB_Info GxB_Vector_unpack_Bitmap   // unpack a bitmap vector
     GB_BURBLE_START ("GxB_Vector_unpack_Bitmap") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_OK (GB_unshare ((GrB_Matrix) v, Werk)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
@@ -34,6 +34,7 @@ GrB_Info GxB_Vector_unpack_CSC  // unpack a CSC vector
     GB_BURBLE_START ("GxB_Vector_unpack_CSC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    GB_OK (GB_unshare ((GrB_Matrix) v, Werk)) ;
     GB_RETURN_IF_NULL (nvals) ;
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GB_Concurrent.h: pending tuples from concurrent GrB_*_setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_CONCURRENT_H
+#define GB_CONCURRENT_H
+
+GrB_Info GB_Pending_gather      // move concurrent setElement tuples to Pending
+(
+    GrB_Matrix A,               // matrix with tuples in A->concurrent
+    bool *disjoint,             // false if the tuples in A->Pending may
+                                // include entries present in A
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_Concurrent_wait     // assemble tuples from concurrent setElement
+(
+    GrB_Matrix A,               // matrix to finish, if it has any such tuples
+    GB_Werk Werk
+) ;
+
+void GB_Concurrent_clear        // free all tuples of concurrent setElement
+(
+    GB_Concurrent Concurrent
+) ;
+
+void GB_Concurrent_free         // free the A->concurrent struct
+(
+    GB_Concurrent *Concurrent_handle
+) ;
+
+#endif
+
@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_Concurrent_free: free the pending tuples of concurrent setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_Concurrent_clear frees the tuples held in each slot and in the spill
+// list, and releases all slots so they can be claimed again by any user
+// thread.  GB_Concurrent_free also frees the struct itself.
+
+#include "pending/GB_Pending.h"
+
+//------------------------------------------------------------------------------
+// GB_Concurrent_clear: free all tuples and release all slots
+//------------------------------------------------------------------------------
+
+void GB_Concurrent_clear        // free all tuples of concurrent setElement
+(
+    GB_Concurrent Concurrent
+)
+{
+
+    if (Concurrent != NULL)
+    {
+        for (int s = 0 ; s < GB_CONCURRENT_NSLOTS ; s++)
+        { 
+            GB_Pending_free (&(Concurrent->slot [s])) ;
+            Concurrent->owner [s] = 0 ;
+        }
+        GB_Pending_free (&(Concurrent->spill)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_Concurrent_free: free the A->concurrent struct
+//------------------------------------------------------------------------------
+
+void GB_Concurrent_free         // free the A->concurrent struct
+(
+    GB_Concurrent *Concurrent_handle
+)
+{
+
+    ASSERT (Concurrent_handle != NULL) ;
+    GB_Concurrent Concurrent = (*Concurrent_handle) ;
+    if (Concurrent != NULL)
+    { 
+        GB_Concurrent_clear (Concurrent) ;
+        GB_FREE (Concurrent_handle, Concurrent->header_size) ;
+    }
+    (*Concurrent_handle) = NULL ;
+}
+
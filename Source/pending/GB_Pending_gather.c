@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// GB_Pending_gather: move the tuples of concurrent setElement into A->Pending
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_CONCURRENT_SETELEMENT is enabled for A, the tuples from
+// GrB_*_setElement are held in per-thread lists in A->concurrent (see
+// GB_setElement_concurrent.c).  GB_Pending_gather appends the lists to
+// A->Pending, one slot after the other and then the spill list, so the tuples
+// of each user thread stay in the order they were added.  The order of tuples
+// from different threads is not defined: if two threads set the same entry,
+// either value may be kept.
+
+// The lists have the type of A and no operator, so they are assembled with
+// the implied SECOND operator, as GrB_*_setElement does.  If A->Pending
+// cannot be appended to (its type or operator differ), its pending work is
+// finished first with GB_wait.  If A is bitmap or full, the tuples are written
+// into A directly.  A stays iso if all the tuples have its iso value.
+
+// Unlike the pending tuples from GB_setElement, these tuples can be entries
+// already present in A.  GB_Pending_gather returns disjoint as false if that
+// may be the case, and GB_wait then does not assume that A and the pending
+// tuples are disjoint when it adds them.  Since a later GB_setElement could
+// modify such an entry of A in place (which the older pending tuple would then
+// overwrite), the tuples are assembled right away, by GB_wait.  So
+// GB_Pending_gather is only called by GB_wait, and GB_Concurrent_wait calls
+// GB_wait if A has any tuples from concurrent setElement.  GB_Concurrent_wait
+// is used by GB_WHERE for the output of each user-callable method, so it is
+// never called while other user threads are still adding tuples to A.  If
+// GB_Pending_gather fails, all content of A is freed, as in GB_wait.
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Concurrent_clear (Concurrent) ;      \
+    GB_phybix_free (A) ;                    \
+}
+
+#include "pending/GB_Pending.h"
+
+//------------------------------------------------------------------------------
+// GB_Pending_gather: move the tuples into A->Pending
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_gather      // move concurrent setElement tuples to Pending
+(
+    GrB_Matrix A,               // matrix with tuples in A->concurrent
+    bool *disjoint,             // false if the tuples in A->Pending may
+                                // include entries present in A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    (*disjoint) = true ;
+    if (A == NULL || !A->concurrent_pending)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Info info ;
+    GB_Concurrent Concurrent = A->concurrent ;
+    ASSERT (Concurrent != NULL) ;
+
+    // this also keeps the GB_wait below from calling GB_Pending_gather again
+    A->concurrent_pending = false ;
+
+    //--------------------------------------------------------------------------
+    // find the non-empty lists, in order
+    //--------------------------------------------------------------------------
+
+    GB_Pending *List [GB_CONCURRENT_NSLOTS+1] ;
+    int nlists = 0 ;
+    int64_t n = 0 ;
+    for (int s = 0 ; s <= GB_CONCURRENT_NSLOTS ; s++)
+    {
+        GB_Pending *P = (s < GB_CONCURRENT_NSLOTS) ?
+            &(Concurrent->slot [s]) : &(Concurrent->spill) ;
+        if ((*P) != NULL && (*P)->n > 0)
+        { 
+            List [nlists++] = P ;
+            n += (*P)->n ;
+        }
+    }
+
+    if (n == 0)
+    { 
+        GB_Concurrent_clear (Concurrent) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_BURBLE_MATRIX (A, "(gather " GBd " concurrent pending) ", n) ;
+
+    // A must get its own copy of any arrays shared with GrB_*_dup
+    GB_OK (GB_unshare (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // check if A can stay iso
+    //--------------------------------------------------------------------------
+
+    const GrB_Type atype = A->type ;
+    const size_t asize = atype->size ;
+    bool keep_iso = A->iso ;
+    for (int k = 0 ; keep_iso && k < nlists ; k++)
+    {
+        GB_Pending L = (*List [k]) ;
+        ASSERT (L->type == atype && L->op == NULL && L->x != NULL) ;
+        for (int64_t p = 0 ; keep_iso && p < L->n ; p++)
+        { 
+            keep_iso = (memcmp (A->x, L->x + p * asize, asize) == 0) ;
+        }
+    }
+
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+
+        //----------------------------------------------------------------------
+        // A is bitmap or full: write the tuples into A
+        //----------------------------------------------------------------------
+
+        if (!keep_iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+        }
+        int8_t  *restrict Ab = A->b ;
+        GB_void *restrict Ax = (GB_void *) A->x ;
+        const int64_t avlen = A->vlen ;
+        for (int k = 0 ; k < nlists ; k++)
+        {
+            GB_Pending L = (*List [k]) ;
+            for (int64_t p = 0 ; p < L->n ; p++)
+            {
+                int64_t i = L->i [p] ;
+                int64_t j = (L->j == NULL) ? 0 : L->j [p] ;
+                int64_t pA = i + j * avlen ;
+                if (!keep_iso)
+                { 
+                    memcpy (Ax + pA * asize, L->x + p * asize, asize) ;
+                }
+                if (Ab != NULL && !Ab [pA])
+                { 
+                    Ab [pA] = 1 ;
+                    A->nvals++ ;
+                }
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // A is sparse or hypersparse: append the tuples to A->Pending
+        //----------------------------------------------------------------------
+
+        GB_Pending Pending = A->Pending ;
+        if (Pending != NULL && (Pending->type != atype || Pending->op != NULL
+            || (Pending->x == NULL) != keep_iso))
+        { 
+            // finish the pending work of A that cannot be appended to
+            GB_OK (GB_wait (A, "A (gather)", Werk)) ;
+        }
+        if (!keep_iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+        }
+
+        int first = 0 ;
+        if (A->Pending == NULL)
+        {
+            // take over the first list
+            A->Pending = (*List [0]) ;
+            (*List [0]) = NULL ;
+            if (keep_iso)
+            { 
+                // the pending tuples of an iso matrix have no values
+                GB_FREE (&(A->Pending->x), A->Pending->x_size) ;
+            }
+            first = 1 ;
+            n -= A->Pending->n ;
+        }
+
+        if (!GB_Pending_realloc (&(A->Pending), n, Werk))
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        Pending = A->Pending ;
+        for (int k = first ; k < nlists ; k++)
+        {
+            GB_Pending L = (*List [k]) ;
+            int64_t n0 = Pending->n ;
+            int64_t nk = L->n ;
+            if (Pending->sorted && n0 > 0)
+            { 
+                // the lists are sorted if each one is, and if the last tuple
+                // of Pending is not after the first tuple of L
+                int64_t ilast = Pending->i [n0-1] ;
+                int64_t jlast = (Pending->j == NULL) ? 0 : Pending->j [n0-1] ;
+                int64_t i = L->i [0] ;
+                int64_t j = (L->j == NULL) ? 0 : L->j [0] ;
+                Pending->sorted = L->sorted &&
+                    ((jlast < j) || (jlast == j && ilast <= i)) ;
+            }
+            memcpy (Pending->i + n0, L->i, nk * sizeof (int64_t)) ;
+            if (Pending->j != NULL)
+            { 
+                memcpy (Pending->j + n0, L->j, nk * sizeof (int64_t)) ;
+            }
+            if (Pending->x != NULL)
+            { 
+                memcpy (Pending->x + n0 * asize, L->x, nk * asize) ;
+            }
+            Pending->n += nk ;
+        }
+
+        // GB_wait deletes any zombies before it adds the pending tuples, so
+        // the tuples can only overlap the live entries of A
+        (*disjoint) = (GB_nnz (A) - A->nzombies == 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free the lists and release the slots
+    //--------------------------------------------------------------------------
+
+    GB_Concurrent_clear (Concurrent) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Concurrent_wait: assemble any tuples from concurrent setElement
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Concurrent_wait     // assemble tuples from concurrent setElement
+(
+    GrB_Matrix A,               // matrix to finish, if it has any such tuples
+    GB_Werk Werk
+)
+{
+
+    if (A == NULL || A->magic != GB_MAGIC || !A->concurrent_pending)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    return (GB_wait (A, "A (concurrent setElement)", Werk)) ;
+}
+
@@ -21,6 +21,18 @@ int64_t GB_Pending_n        // return # of pending tuples in A
         // only sparse and hypersparse matries can have pending tuples
         n = A->Pending->n ;
     }
+    if (A != NULL && A->concurrent_pending)
+    {
+        // tuples from concurrent setElement, not yet in A->Pending
+        GB_Concurrent Concurrent = A->concurrent ;
+        for (int s = 0 ; s < GB_CONCURRENT_NSLOTS ; s++)
+        { 
+            GB_Pending P = Concurrent->slot [s] ;
+            n += (P == NULL) ? 0 : P->n ;
+        }
+        GB_Pending P = Concurrent->spill ;
+        n += (P == NULL) ? 0 : P->n ;
+    }
     return (n) ;
 }
 
@@ -54,6 +54,22 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    if (GB_Context_numa_first_touch_get (Context))
+    { 
+        GBPR0 ("    Context.numa_first_touch: true\n") ;
+    }
+
+    int mxm_plan_max = GB_Context_mxm_plan_max_get (Context) ;
+    if (mxm_plan_max > 0)
+    { 
+        GBPR0 ("    Context.mxm_plan: %d\n", mxm_plan_max) ;
+    }
+
+    if (GB_Context_mxm_workspace_get (Context))
+    { 
+        GBPR0 ("    Context.mxm_workspace: true\n") ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
@@ -92,6 +92,12 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
         return (GrB_DIMENSION_MISMATCH) ;
     }
 
+    if (in_place)
+    { 
+        // A is reshaped in place, so it must not share its arrays
+        GB_OK (GB_unshare (A, Werk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // finish any pending work, and transpose the input matrix if needed
     //--------------------------------------------------------------------------
@@ -54,6 +54,7 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
     s->b = NULL ; s->b_size = 0 ; s->b_shallow = false ;
     s->i = NULL ; s->i_size = 0 ; s->i_shallow = false ;
     s->x = Sx   ; s->x_size = type->size ; s->x_shallow = true ;
+    s->shared = NULL ;
 
     s->Y = NULL ;
     s->Y_shallow = false ;
@@ -74,6 +75,9 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
     s->jumbled = false ;
     s->iso = true ;         // OK: scalar wrap with a single entry
 
+    s->concurrent = NULL ;
+    s->concurrent_pending = false ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
@@ -9,6 +9,13 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If in_place is true (for GxB_Matrix_deserialize_view), the uncompressed
+// arrays aligned in the blob (see GB_serialize.h) are not copied.  Instead, C
+// points into the blob, and holds those arrays in a GB_Shared struct that does
+// not own them (see GB_unshare.c).  The blob is owned by the user application,
+// and must not be freed or modified while C, or any matrix that shares its
+// arrays, exists.  If C is modified, it first gets its own copy of the arrays.
+
 #include "GB.h"
 #include "get_set/GB_get_set.h"
 #include "serialize/GB_serialize.h"
@@ -17,6 +24,7 @@
 {                                           \
     GB_Matrix_free (&T) ;                   \
     GB_Matrix_free (&C) ;                   \
+    GB_FREE (&shared, shared_size) ;        \
 }
 
 GrB_Info GB_deserialize             // deserialize a matrix from a blob
@@ -26,7 +34,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool in_place                   // if true, C can point into the blob
 )
 {
 
@@ -38,6 +47,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     ASSERT (blob != NULL && Chandle != NULL) ;
     (*Chandle) = NULL ;
     GrB_Matrix C = NULL, T = NULL ;
+    GB_Shared shared = NULL ; size_t shared_size = 0 ;
 
     //--------------------------------------------------------------------------
     // read the content of the header (160 bytes)
@@ -54,6 +64,12 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_BLOB_READ (blob_size2, uint64_t) ;
     GB_BLOB_READ (typecode, int32_t) ;
     uint64_t blob_size1 = (uint64_t) blob_size ;
+    bool blob_filtered = (typecode >= GB_BLOB_FILTERED) ;
+    if (blob_filtered)
+    { 
+        // the blob has filtered arrays (see GB_serialize.h)
+        typecode -= GB_BLOB_FILTERED ;
+    }
 
     if (blob_size1 != blob_size2
         || typecode < GB_BOOL_code || typecode > GB_UDT_code
@@ -86,6 +102,16 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
     GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
 
+    if (blob_filtered != ((Cp_method >= GxB_COMPRESSION_FILTER) ||
+        (Ch_method >= GxB_COMPRESSION_FILTER) ||
+        (Cb_method >= GxB_COMPRESSION_FILTER) ||
+        (Ci_method >= GxB_COMPRESSION_FILTER) ||
+        (Cx_method >= GxB_COMPRESSION_FILTER)))
+    { 
+        // blob is invalid: filtered arrays must be flagged in the typecode
+        return (GrB_INVALID_OBJECT) ;
+    }
+
     int32_t sparsity = sparsity_iso_csc / 4 ;
     bool iso = ((sparsity_iso_csc & 2) == 2) ;
     bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
@@ -164,36 +190,36 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         case GxB_HYPERSPARSE : 
             // decompress Cp, Ch, and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, sizeof (int64_t), in_place, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s)) ;
+                &(C->h_shallow), Ch_len, blob, blob_size, Ch_Sblocks,
+                Ch_nblocks, Ch_method, sizeof (int64_t), in_place, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, sizeof (int64_t), in_place, &s)) ;
             break ;
 
         case GxB_SPARSE : 
 
             // decompress Cp and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, sizeof (int64_t), in_place, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, sizeof (int64_t), in_place, &s)) ;
             break ;
 
         case GxB_BITMAP : 
 
             // decompress Cb
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s)) ;
+                &(C->b_shallow), Cb_len, blob, blob_size, Cb_Sblocks,
+                Cb_nblocks, Cb_method, sizeof (int8_t), in_place, &s)) ;
             break ;
 
         case GxB_FULL : 
@@ -202,8 +228,42 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     }
 
     // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s)) ;
+    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size),
+        &(C->x_shallow), Cx_len, blob, blob_size, Cx_Sblocks, Cx_nblocks,
+        Cx_method, typesize, in_place, &s)) ;
+
+    //--------------------------------------------------------------------------
+    // hold the arrays that point into the blob in a GB_Shared struct
+    //--------------------------------------------------------------------------
+
+    if (C->p_shallow || C->h_shallow || C->b_shallow || C->i_shallow ||
+        C->x_shallow)
+    {
+        shared = GB_CALLOC (1, struct GB_Shared_struct, &shared_size) ;
+        if (shared == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        shared->header_size = shared_size ;
+        shared->refcount = 1 ;
+        shared->user_owned = true ;
+        #define GB_SHARE(X)                                 \
+            if (C->X ## _shallow)                           \
+            {                                               \
+                shared->X = C->X ;                          \
+                shared->X ## _size = C->X ## _size ;        \
+            }
+        GB_SHARE (p) ;
+        GB_SHARE (h) ;
+        GB_SHARE (b) ;
+        GB_SHARE (i) ;
+        GB_SHARE (x) ;
+        C->shared = shared ;
+        shared = NULL ;
+        GBURBLE ("(deserialized in place) ") ;
+    }
 
     if (C->p != NULL)
     { 
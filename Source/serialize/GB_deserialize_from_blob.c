@@ -13,6 +13,14 @@
 // However, the contents of output array are not fully checked.  This step is
 // done by GB_deserialize, if requested.
 
+// If in_place is true, an uncompressed array aligned in the blob (see
+// GB_serialize.h) is not copied.  Instead, X points into the blob and
+// X_shallow is returned as true, if the array is suitably aligned in memory.
+
+// If the array was filtered before it was compressed (see
+// GB_serialize_filter.c), it is decompressed into workspace and then
+// unfiltered into X.
+
 #include "GB.h"
 #include "serialize/GB_serialize.h"
 #include "lz4_wrapper/GB_lz4.h"
@@ -21,6 +29,7 @@
 #define GB_FREE_ALL         \
 {                           \
     GB_FREE (&X, X_size) ;  \
+    GB_FREE (&Y, Y_size) ;  \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -28,6 +37,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -35,6 +45,8 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    size_t esize,               // size of each entry of X
+    bool in_place,              // if true, X can point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 )
@@ -49,15 +61,60 @@ GrB_Info GB_deserialize_from_blob
     ASSERT (s_handle != NULL) ;
     ASSERT (X_handle != NULL) ;
     ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow != NULL) ;
     (*X_handle) = NULL ;
     (*X_size_handle) = 0 ;
+    (*X_shallow) = false ;
+    size_t s = (*s_handle) ;
 
     //--------------------------------------------------------------------------
     // parse the method
     //--------------------------------------------------------------------------
 
-    int32_t algo, level ;
-    GB_serialize_method (&algo, &level, method) ;
+    int32_t algo, level, filter = GB_FILTER_NONE ;
+    if (method >= GxB_COMPRESSION_FILTER)
+    {
+        // the array was filtered before it was compressed
+        filter = method / GxB_COMPRESSION_FILTER ;
+        if (filter != GB_FILTER_DELTA && filter != GB_FILTER_SHUFFLE)
+        { 
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (filter == GB_FILTER_DELTA) esize = sizeof (int64_t) ;
+    }
+
+    if (method == GB_BLOB_NONE_ALIGNED)
+    { 
+        // no compression; skip the padding that aligns the array
+        algo = GxB_COMPRESSION_NONE ;
+        level = 0 ;
+        if (nblocks > 0)
+        {
+            s += GB_BLOB_PAD (s, method) ;
+        }
+    }
+    else
+    { 
+        GB_serialize_method (&algo, &level, method) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the array in place, if requested and if possible
+    //--------------------------------------------------------------------------
+
+    if (in_place && method == GB_BLOB_NONE_ALIGNED && nblocks == 1
+        && Sblocks [0] == X_len && X_len > 0 && s <= blob_size
+        && X_len <= (int64_t) (blob_size - s)
+        && ((uintptr_t) (blob + s)) % GB_BLOB_INPLACE_ALIGN == 0)
+    { 
+        // X is shallow, and points into the blob
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = X_len ;
+        (*X_shallow) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the output array
@@ -65,11 +122,20 @@ GrB_Info GB_deserialize_from_blob
 
     size_t X_size = 0 ;
     GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
-    if (X == NULL)
+    GB_void *Y = NULL ; size_t Y_size = 0 ;
+    if (filter != GB_FILTER_NONE)
+    {
+        // workspace to hold the filtered array
+        Y = GB_MALLOC (X_len, GB_void, &Y_size) ;
+    }
+    if (X == NULL || (filter != GB_FILTER_NONE && Y == NULL))
     { 
         // out of memory
+        GB_FREE_ALL ;
         return (GrB_OUT_OF_MEMORY) ;
     }
+    // the blocks are decompressed into D
+    GB_void *D = (filter == GB_FILTER_NONE) ? X : Y ;
 
     //--------------------------------------------------------------------------
     // determine the number of threads to use
@@ -81,7 +147,6 @@ GrB_Info GB_deserialize_from_blob
     // decompress the blocks from the blob
     //--------------------------------------------------------------------------
 
-    size_t s = (*s_handle) ;
     bool ok = true ;
 
     if (algo == GxB_COMPRESSION_NONE)
@@ -91,7 +156,9 @@ GrB_Info GB_deserialize_from_blob
         // no compression; the array is held in a single block
         //----------------------------------------------------------------------
 
-        if (nblocks > 1 || Sblocks [0] != X_len || s + X_len > blob_size)
+        if (filter != GB_FILTER_NONE ||
+            nblocks > 1 || Sblocks [0] != X_len || s > blob_size
+            || s + X_len > blob_size)
         { 
             // blob is invalid: guard against an unsafe memcpy
             ok = false ;
@@ -142,7 +209,7 @@ GrB_Info GB_deserialize_from_blob
                 // not yet checked, however.  That step is done in
                 // GB_deserialize, if requested.
                 const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
+                char *dst = (char *) (D + kstart) ;
                 if (algo == GxB_COMPRESSION_ZSTD)
                 { 
                     // ZSTD
@@ -176,6 +243,16 @@ GrB_Info GB_deserialize_from_blob
         return (GrB_INVALID_OBJECT) ;
     }
 
+    //--------------------------------------------------------------------------
+    // undo the filter, if any
+    //--------------------------------------------------------------------------
+
+    if (filter != GB_FILTER_NONE)
+    { 
+        GB_deserialize_unfilter (X, Y, X_len, filter, esize, nthreads_max) ;
+        GB_FREE (&Y, Y_size) ;
+    }
+
     //--------------------------------------------------------------------------
     // return result: X, its size, and updated index into the blob
     //--------------------------------------------------------------------------
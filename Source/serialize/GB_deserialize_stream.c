@@ -0,0 +1,441 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: read and decompress a GrB_Matrix from a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads a matrix written by GB_serialize_stream.  The compressed blocks are
+// read in batches, one block per thread, and decompressed in parallel directly
+// into the arrays of the matrix.  Uncompressed blocks are read directly into
+// the matrix.  The only workspace is one compressed block per thread.
+
+// The header of the stream, and the size of each array and block, are checked
+// so that a corrupted or truncated stream cannot cause any out-of-bounds
+// access.  GrB_INVALID_OBJECT is returned in that case, or if the read
+// function fails.  As in GB_deserialize, the content of the arrays is not
+// checked.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#include "serialize/GB_serialize.h"
+#include "lz4_wrapper/GB_lz4.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+#define GB_FREE_ALL                                             \
+{                                                               \
+    GB_serialize_free_blocks (&Buffers, Buffers_size, nbuffers) ; \
+    GB_FREE (&Bsize, Bsize_size) ;                              \
+    GB_FREE (&user_name, user_name_size) ;                      \
+    GB_Matrix_free (&C) ;                                       \
+}
+
+//------------------------------------------------------------------------------
+// GB_destream_array: read an array from the stream and decompress it
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_destream_array
+(
+    // output:
+    GB_void **X_handle,             // array read from the stream
+    size_t *X_size_handle,          // size of X as allocated
+    // input:
+    GxB_stream_read_function read_func,     // function to read the stream
+    void *stream,                   // passed to read_func
+    int64_t len,                    // size of X in bytes
+    int32_t nblocks,                // # of blocks of X
+    int32_t algo,                   // compression algorithm
+    GB_blocks *Buffers,             // workspace: one compressed block per
+    int64_t *Bsize,                 // thread, and its size
+    int nbuffers                    // # of buffers
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the output array
+    //--------------------------------------------------------------------------
+
+    size_t X_size = 0 ;
+    GB_void *X = GB_MALLOC (len, GB_void, &X_size) ;
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress each batch of blocks
+    //--------------------------------------------------------------------------
+
+    bool none = (algo == GxB_COMPRESSION_NONE) ;
+    int32_t batch = none ? nblocks : nbuffers ;
+
+    for (int32_t b0 = 0 ; b0 < nblocks ; b0 += batch)
+    {
+
+        //----------------------------------------------------------------------
+        // read the blocks b0:b0+nb-1
+        //----------------------------------------------------------------------
+
+        int nb = (int) GB_IMIN (batch, nblocks - b0) ;
+        for (int t = 0 ; t < nb ; t++)
+        {
+            int64_t kstart, kend, size ;
+            GB_PARTITION (kstart, kend, len, b0 + t, nblocks) ;
+            if (!read_func (stream, &size, sizeof (int64_t)))
+            {
+                // stream is truncated
+                return (GrB_INVALID_OBJECT) ;
+            }
+            bool ok ;
+            if (none)
+            {
+                // read the block directly into X [kstart:kend-1]
+                ok = (size == kend - kstart) &&
+                    read_func (stream, X + kstart, (size_t) size) ;
+            }
+            else
+            {
+                // read the compressed block into Buffers [t]
+                ok = (size > 0) && (size <= Buffers [t].p_size_allocated) &&
+                    read_func (stream, Buffers [t].p, (size_t) size) ;
+                Bsize [t] = size ;
+            }
+            if (!ok)
+            {
+                // stream is invalid or truncated
+                return (GrB_INVALID_OBJECT) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // decompress the blocks in parallel
+        //----------------------------------------------------------------------
+
+        if (!none)
+        {
+            bool ok = true ;
+            int t ;
+            #pragma omp parallel for num_threads(nb) schedule(static) \
+                reduction(&&:ok)
+            for (t = 0 ; t < nb ; t++)
+            {
+                // decompress Buffers [t].p into X [kstart:kend-1]
+                int64_t kstart, kend ;
+                GB_PARTITION (kstart, kend, len, b0 + t, nblocks) ;
+                const char *src = (const char *) Buffers [t].p ;
+                char *dst = (char *) (X + kstart) ;
+                size_t s_size = (size_t) Bsize [t] ;
+                size_t d_size = (size_t) (kend - kstart) ;
+                if (algo == GxB_COMPRESSION_ZSTD)
+                {
+                    // ZSTD
+                    size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                    ok = ok && (u == d_size) ;
+                }
+                else
+                {
+                    // LZ4 or LZ4HC
+                    int u = LZ4_decompress_safe (src, dst, (int) s_size,
+                        (int) d_size) ;
+                    ok = ok && (u == (int) d_size) ;
+                }
+            }
+            if (!ok)
+            {
+                // decompression failure; stream is invalid
+                return (GrB_INVALID_OBJECT) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix read from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function read_func,     // function to read the stream
+    void *stream                    // passed to read_func
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL && read_func != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    GB_blocks *Buffers = NULL ; size_t Buffers_size = 0 ;
+    int64_t *Bsize = NULL ; size_t Bsize_size = 0 ;
+    char *user_name = NULL ; size_t user_name_size = 0 ;
+    int nbuffers = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the header
+    //--------------------------------------------------------------------------
+
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    size_t s = 0 ;
+    if (!read_func (stream, blob, GB_BLOB_HEADER_SIZE))
+    {
+        // stream is truncated
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    GB_BLOB_READ (blob_size, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    int64_t len [5] ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        memcpy (&(len [k]), blob + s, sizeof (int64_t)) ;
+        s += sizeof (int64_t) ;
+    }
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    int32_t nblocks [5], methods [5] ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        memcpy (&(nblocks [k]), blob + s, sizeof (int32_t)) ;
+        s += sizeof (int32_t) ;
+        memcpy (&(methods [k]), blob + s, sizeof (int32_t)) ;
+        s += sizeof (int32_t) ;
+    }
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // check the header
+    //--------------------------------------------------------------------------
+
+    // the arrays that must be present, for each sparsity format
+    bool present [5] ;
+    present [0] = (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE) ;
+    present [1] = (sparsity == GxB_HYPERSPARSE) ;
+    present [2] = (sparsity == GxB_BITMAP) ;
+    present [3] = present [0] ;
+    present [4] = true ;
+
+    uint64_t nheld = 0, xlen = 0 ;
+    // streams were first written by v9.5.0, and a stream written by a later
+    // version may use a format not known here
+    bool ok = (blob_size == 0)
+        && version >= GxB_VERSION (9,5,0) && version <= GxB_IMPLEMENTATION
+        && typecode >= GB_BOOL_code && typecode <= GB_UDT_code
+        && vlen >= 0 && vlen <= GB_NMAX && vdim >= 0 && vdim <= GB_NMAX
+        && nvec >= 0 && nvec <= vdim
+        && (sparsity == GxB_HYPERSPARSE || nvec == vdim || !present [0])
+        && nvals >= 0 && typesize > 0
+        && (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE ||
+            sparsity == GxB_BITMAP || sparsity == GxB_FULL)
+        && GB_int64_multiply (&nheld, vlen, vdim)
+        && nvals <= (int64_t) nheld
+        && GB_int64_multiply (&xlen, typesize, iso ? 1 :
+            (present [0] ? nvals : (int64_t) nheld)) ;
+    ok = ok && (!present [0] || len [0] == 8 * (nvec+1))
+            && (!present [1] || len [1] == 8 * nvec)
+            && (!present [2] || len [2] == (int64_t) nheld)
+            && (!present [3] || (len [3] % 8 == 0 && len [3] / 8 == nvals))
+            && (len [4] == (int64_t) xlen) ;
+    for (int k = 0 ; k < 5 && ok ; k++)
+    {
+        if (!present [k]) len [k] = 0 ;
+        // streams are never written with the pre-filters
+        // (GxB_COMPRESSION_FILTER)
+        ok = (nblocks [k] == GB_ICEIL (len [k], GB_STREAM_BLOCKSIZE))
+            && methods [k] < GxB_COMPRESSION_FILTER ;
+    }
+
+    if (!ok)
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // stream is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (!read_func (stream, blob + s, GxB_MAX_NAME_LEN))
+        {
+            // stream is truncated
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // stream is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate one compressed block per thread
+    //--------------------------------------------------------------------------
+
+    int32_t algo [5], max_nblocks = 0 ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        int32_t level ;
+        GB_serialize_method (&(algo [k]), &level, methods [k]) ;
+        if (algo [k] != GxB_COMPRESSION_NONE)
+        {
+            max_nblocks = GB_IMAX (max_nblocks, nblocks [k]) ;
+        }
+    }
+
+    if (max_nblocks > 0)
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        int n = (int) GB_IMIN (nthreads_max, max_nblocks) ;
+        size_t bound = GB_IMAX (ZSTD_compressBound (GB_STREAM_BLOCKSIZE),
+            (size_t) LZ4_compressBound (GB_STREAM_BLOCKSIZE)) ;
+        Buffers = GB_CALLOC (n, GB_blocks, &Buffers_size) ;
+        Bsize = GB_MALLOC (n, int64_t, &Bsize_size) ;
+        if (Buffers == NULL || Bsize == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        nbuffers = n ;
+        for (int t = 0 ; t < nbuffers ; t++)
+        {
+            size_t size_allocated = 0 ;
+            Buffers [t].p = GB_MALLOC (bound, GB_void, &size_allocated) ;
+            Buffers [t].p_size_allocated = size_allocated ;
+            if (Buffers [t].p == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    void   **X      [5] = { (void **) &(C->p), (void **) &(C->h),
+        (void **) &(C->b), (void **) &(C->i), (void **) &(C->x) } ;
+    size_t *X_size [5] = { &(C->p_size), &(C->h_size), &(C->b_size),
+        &(C->i_size), &(C->x_size) } ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (present [k])
+        {
+            GB_OK (GB_destream_array ((GB_void **) X [k], X_size [k],
+                read_func, stream, len [k], nblocks [k], algo [k],
+                Buffers, Bsize, nbuffers)) ;
+        }
+    }
+
+    if (C->p != NULL && (C->p [0] != 0 || C->p [nvec] != nvals))
+    {
+        // stream is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // read the GrB_NAME
+    //--------------------------------------------------------------------------
+
+    int64_t user_name_len ;
+    if (!read_func (stream, &user_name_len, sizeof (int64_t)) ||
+        user_name_len < 0 || user_name_len > GB_NMAX)
+    {
+        // stream is invalid or truncated
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (user_name_len > 0)
+    {
+        user_name = GB_MALLOC (user_name_len + 1, char, &user_name_size) ;
+        if (user_name == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (!read_func (stream, user_name, user_name_len))
+        {
+            // stream is truncated
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        user_name [user_name_len] = '\0' ;
+        GB_OK (GB_matvec_name_set (C, user_name, GrB_NAME)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_serialize_free_blocks (&Buffers, Buffers_size, nbuffers) ;
+    GB_FREE (&Bsize, Bsize_size) ;
+    GB_FREE (&user_name, user_name_size) ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize stream", GB0) ;
+    return (GrB_SUCCESS) ;
+}
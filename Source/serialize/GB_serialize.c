@@ -128,14 +128,18 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
+    bool filtered = (method >= GxB_COMPRESSION_FILTER) ;
     GB_serialize_method (&algo, &level, method) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s%s:%d) ",
+    filtered = filtered && (algo != GxB_COMPRESSION_NONE) &&
+        (algo != GxB_COMPRESSION_ALIGNED) ;
+    GBURBLE ("(compression: %s%s%s%s%s:%d%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_ALIGNED) ? "aligned" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
         (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
         (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
-        level) ;
+        level, filtered ? "+filter" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
@@ -193,33 +197,44 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
 
     // For the dryrun case, this just computes A[phbix]_compressed_size as an
     // upper bound on each array size when compressed, and A[phbix]_nblocks.
+    // If filters are requested, the integer arrays are delta encoded, and the
+    // values are byte shuffled (unless they are single bytes).
+
+    int32_t Ai_filter = filtered ? GB_FILTER_DELTA : GB_FILTER_NONE ;
+    int32_t Ax_filter = (filtered && typesize > 1) ?
+        GB_FILTER_SHUFFLE : GB_FILTER_NONE ;
 
     int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
 
     GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
         &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
         &Ap_compressed_size, dryrun,
-        (GB_void *) A->p, Ap_len, method, algo, level, Werk)) ;
+        (GB_void *) A->p, Ap_len, method, algo, level, Ai_filter,
+        sizeof (int64_t), Werk)) ;
 
     GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
         &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
         &Ah_compressed_size, dryrun,
-        (GB_void *) A->h, Ah_len, method, algo, level, Werk)) ;
+        (GB_void *) A->h, Ah_len, method, algo, level, Ai_filter,
+        sizeof (int64_t), Werk)) ;
 
     GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
         &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
         &Ab_compressed_size, dryrun,
-        (GB_void *) A->b, Ab_len, method, algo, level, Werk)) ;
+        (GB_void *) A->b, Ab_len, method, algo, level, GB_FILTER_NONE,
+        sizeof (int8_t), Werk)) ;
 
     GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
         &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
         &Ai_compressed_size, dryrun,
-        (GB_void *) A->i, Ai_len, method, algo, level, Werk)) ;
+        (GB_void *) A->i, Ai_len, method, algo, level, Ai_filter,
+        sizeof (int64_t), Werk)) ;
 
     GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
         &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
         &Ax_compressed_size, dryrun,
-        (GB_void *) A->x, Ax_len, method, algo, level, Werk)) ;
+        (GB_void *) A->x, Ax_len, method, algo, level, Ax_filter,
+        typesize, Werk)) ;
 
     //--------------------------------------------------------------------------
     // determine the size of the blob
@@ -237,12 +252,18 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
         // type_name for user-defined types
         + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
 
-    // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob
-    s += Ap_compressed_size ;
-    s += Ah_compressed_size ;
-    s += Ab_compressed_size ;
-    s += Ai_compressed_size ;
-    s += Ax_compressed_size ;
+    // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob, and the
+    // padding that aligns each uncompressed array.  For the dryrun, the
+    // position of each array is not known, so the padding is bounded.
+    #define GB_BLOB_SIZE(method,compressed_size)                    \
+        s += (dryrun ? ((method == GB_BLOB_NONE_ALIGNED) ?          \
+            (GB_BLOB_ALIGN-1) : 0) : GB_BLOB_PAD (s, method)) ;     \
+        s += compressed_size ;
+    GB_BLOB_SIZE (Ap_method, Ap_compressed_size) ;
+    GB_BLOB_SIZE (Ah_method, Ah_compressed_size) ;
+    GB_BLOB_SIZE (Ab_method, Ab_compressed_size) ;
+    GB_BLOB_SIZE (Ai_method, Ai_compressed_size) ;
+    GB_BLOB_SIZE (Ax_method, Ax_compressed_size) ;
 
     // size of the GrB_NAME and GrB_EL_TYPE_STRING, including one nul byte each
     char *user_name = A->user_name ;
@@ -312,7 +333,13 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     uint64_t blob_size_required64 = (uint64_t) blob_size_required ;
     GB_BLOB_WRITE (blob_size_required64, uint64_t) ;
 
-    GB_BLOB_WRITE (typecode, int32_t) ;
+    bool any_filtered = (Ap_method >= GxB_COMPRESSION_FILTER) ||
+        (Ah_method >= GxB_COMPRESSION_FILTER) ||
+        (Ab_method >= GxB_COMPRESSION_FILTER) ||
+        (Ai_method >= GxB_COMPRESSION_FILTER) ||
+        (Ax_method >= GxB_COMPRESSION_FILTER) ;
+    int32_t blob_typecode = typecode + (any_filtered ? GB_BLOB_FILTERED : 0) ;
+    GB_BLOB_WRITE (blob_typecode, int32_t) ;
     GB_BLOB_WRITE (version, int32_t) ;
     GB_BLOB_WRITE (vlen, int64_t) ;
     GB_BLOB_WRITE (vdim, int64_t) ;
@@ -360,16 +387,20 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_BLOB_WRITES (Ai_Sblocks, Ai_nblocks) ;
     GB_BLOB_WRITES (Ax_Sblocks, Ax_nblocks) ;
 
-    GB_serialize_to_blob (blob, &s, Ap_Blocks, Ap_Sblocks+1, Ap_nblocks,
-        nthreads_max) ;
-    GB_serialize_to_blob (blob, &s, Ah_Blocks, Ah_Sblocks+1, Ah_nblocks,
-        nthreads_max) ;
-    GB_serialize_to_blob (blob, &s, Ab_Blocks, Ab_Sblocks+1, Ab_nblocks,
-        nthreads_max) ;
-    GB_serialize_to_blob (blob, &s, Ai_Blocks, Ai_Sblocks+1, Ai_nblocks,
-        nthreads_max) ;
-    GB_serialize_to_blob (blob, &s, Ax_Blocks, Ax_Sblocks+1, Ax_nblocks,
-        nthreads_max) ;
+    // each uncompressed array is preceded by zero padding, to align it
+    #define GB_BLOB_WRITE_ARRAY(Blocks,Sblocks,nblocks,method)          \
+    {                                                                   \
+        size_t pad = GB_BLOB_PAD (s, method) ;                          \
+        memset (blob + s, 0, pad) ;                                     \
+        s += pad ;                                                      \
+        GB_serialize_to_blob (blob, &s, Blocks, Sblocks+1, nblocks,     \
+            nthreads_max) ;                                             \
+    }
+    GB_BLOB_WRITE_ARRAY (Ap_Blocks, Ap_Sblocks, Ap_nblocks, Ap_method) ;
+    GB_BLOB_WRITE_ARRAY (Ah_Blocks, Ah_Sblocks, Ah_nblocks, Ah_method) ;
+    GB_BLOB_WRITE_ARRAY (Ab_Blocks, Ab_Sblocks, Ab_nblocks, Ab_method) ;
+    GB_BLOB_WRITE_ARRAY (Ai_Blocks, Ai_Sblocks, Ai_nblocks, Ai_method) ;
+    GB_BLOB_WRITE_ARRAY (Ax_Blocks, Ax_Sblocks, Ax_nblocks, Ax_method) ;
 
     //--------------------------------------------------------------------------
     // append the GrB_NAME and GrB_EL_TYPE_STRING to the blob
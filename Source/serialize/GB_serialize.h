@@ -37,7 +37,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool in_place                   // if true, C can point into the blob
 ) ;
 
 typedef struct
@@ -65,6 +66,8 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    int32_t filter,                     // pre-filter to apply, if compressed
+    size_t esize,                       // size of each entry of X
     GB_Werk Werk
 ) ;
 
@@ -92,6 +95,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -99,10 +103,104 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    size_t esize,               // size of each entry of X
+    bool in_place,              // if true, X can point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 ) ;
 
+// In a blob serialized with GxB_COMPRESSION_ALIGNED, each array starts at a
+// multiple of GB_BLOB_ALIGN bytes from the start of the blob, preceded by zero
+// padding.  It is recorded with the method GB_BLOB_NONE_ALIGNED, so that
+// v9.4.x and earlier, which do not skip the padding, reject the blob instead
+// of reading it incorrectly.  All other uncompressed arrays (with
+// GxB_COMPRESSION_NONE, or small arrays in compressed blobs) have the method
+// GxB_COMPRESSION_NONE and no padding.  GB_deserialize can use an aligned
+// array in place, with no copy, if its address is a multiple of
+// GB_BLOB_INPLACE_ALIGN.
+
+#define GB_BLOB_ALIGN 64
+#define GB_BLOB_INPLACE_ALIGN 16
+#define GB_BLOB_NONE_ALIGNED GxB_COMPRESSION_ALIGNED
+
+// # of bytes of padding before an array at position s in the blob
+#define GB_BLOB_PAD(s,method)                                               \
+    (((method) == GB_BLOB_NONE_ALIGNED) ?                                   \
+    ((GB_BLOB_ALIGN - ((s) % GB_BLOB_ALIGN)) % GB_BLOB_ALIGN) : 0)
+
+// Pre-filters applied to each array before compression, if the method
+// includes GxB_COMPRESSION_FILTER (see GB_serialize_filter.c).  The method of
+// a filtered array is recorded in the blob as its compression method plus
+// filter * GxB_COMPRESSION_FILTER.  v9.4.x and earlier would take such a
+// method as ZSTD, and return the filtered arrays with no error.  To prevent
+// this, a blob with any filtered array has GB_BLOB_FILTERED added to the
+// typecode in its header.  Earlier versions check that the typecode is in
+// range, and so they reject the blob.
+
+#define GB_BLOB_FILTERED 256
+
+#define GB_FILTER_NONE 0
+#define GB_FILTER_DELTA 1           // delta encoding then byte shuffle, int64
+#define GB_FILTER_SHUFFLE 2         // byte shuffle, entries of size esize
+
+void GB_serialize_filter
+(
+    // output:
+    GB_void *restrict Y,            // filtered array, of size len
+    // input:
+    const GB_void *restrict X,      // array to filter, of size len
+    int64_t len,                    // size of X and Y in bytes
+    int32_t filter,                 // GB_FILTER_DELTA or GB_FILTER_SHUFFLE
+    size_t esize,                   // size of each entry of X (8 for delta)
+    int nthreads_max
+) ;
+
+void GB_deserialize_unfilter
+(
+    // output:
+    GB_void *restrict X,            // unfiltered array, of size len
+    // input:
+    const GB_void *restrict Y,      // filtered array, of size len
+    int64_t len,                    // size of X and Y in bytes
+    int32_t filter,                 // GB_FILTER_DELTA or GB_FILTER_SHUFFLE
+    size_t esize,                   // size of each entry of X (8 for delta)
+    int nthreads_max
+) ;
+
+// A stream written by GB_serialize_stream holds:
+//  (1) the blob header (GB_BLOB_HEADER_SIZE bytes), as written by
+//      GB_serialize, except that its blob_size is zero, and A[phbix]_nblocks
+//      is the # of blocks of each array in the stream.  The blocks of an array
+//      of len bytes are the GB_PARTITION of len into nblocks parts, where
+//      nblocks is ceil (len / GB_STREAM_BLOCKSIZE).  No Sblocks follow.
+//  (2) the type name (GxB_MAX_NAME_LEN bytes), for a user-defined type.
+//  (3) each block of Ap, Ah, Ab, Ai, and Ax in turn: its size in the stream
+//      (an int64_t), then the block itself, compressed or not.
+//  (4) the length of the GrB_NAME of the matrix (an int64_t), then the name,
+//      with no nul byte.
+// A stream is not a blob, and can only be read by GB_deserialize_stream.
+
+#define GB_STREAM_BLOCKSIZE (1024*1024)
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    GxB_stream_write_function write_func,   // function to write the stream
+    void *stream,                   // passed to write_func
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix read from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function read_func,     // function to read the stream
+    void *stream                    // passed to read_func
+) ;
+
 #define GB_BLOB_HEADER_SIZE \
     sizeof (uint64_t)           /* blob_size                            */  \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */  \
@@ -9,15 +9,23 @@
 
 // Parallel compression method for an array.  The array is compressed into
 // a sequence of independently allocated blocks, or returned as-is if not
-// compressed.  Currently, only LZ4, LZ4HC, and ZSTD are supported.
+// compressed.  Currently, only LZ4, LZ4HC, and ZSTD are supported.  If a
+// filter is given, the array is filtered into workspace before it is
+// compressed (see GB_serialize_filter.c).
 
 #include "GB.h"
 #include "serialize/GB_serialize.h"
 #include "lz4_wrapper/GB_lz4.h"
 #include "zstd_wrapper/GB_zstd.h"
 
+#define GB_FREE_WORKSPACE                                       \
+{                                                               \
+    GB_FREE (&Y, Y_size) ;                                      \
+}
+
 #define GB_FREE_ALL                                             \
 {                                                               \
+    GB_FREE_WORKSPACE ;                                         \
     GB_FREE (&Sblocks, Sblocks_size) ;                          \
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks) ;  \
 }
@@ -40,6 +48,8 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    int32_t filter,                     // pre-filter to apply, if compressed
+    size_t esize,                       // size of each entry of X
     GB_Werk Werk
 )
 {
@@ -59,6 +69,7 @@ GrB_Info GB_serialize_array
     size_t Blocks_size = 0, Sblocks_size = 0 ;
     int32_t nblocks = 0 ;
     int64_t *Sblocks = NULL ;
+    GB_void *Y = NULL ; size_t Y_size = 0 ;
 
     //--------------------------------------------------------------------------
     // check for quick return
@@ -81,7 +92,8 @@ GrB_Info GB_serialize_array
     // check for no compression
     //--------------------------------------------------------------------------
 
-    if (method <= GxB_COMPRESSION_NONE || len < 256)
+    if (algo == GxB_COMPRESSION_NONE || algo == GxB_COMPRESSION_ALIGNED ||
+        len < 256)
     {
         // no compression, return result as a single block (plus the sentinel)
         if (!dryrun)
@@ -109,12 +121,20 @@ GrB_Info GB_serialize_array
             (*Sblocks_size_handle) = Sblocks_size ;
         }
 
+        // with GxB_COMPRESSION_ALIGNED, the array is aligned in the blob by
+        // GB_serialize, so it can be used in place by
+        // GxB_Matrix_deserialize_view.  Other uncompressed arrays are not
+        // aligned, so those blobs can still be read by v9.4.x.
+        if (algo == GxB_COMPRESSION_ALIGNED)
+        { 
+            (*method_used) = GB_BLOB_NONE_ALIGNED ;
+        }
         (*compressed_size) = len ;
         (*nblocks_handle) = 1 ;
         return (GrB_SUCCESS) ;
     }
 
-    (*method_used) = method ;
+    (*method_used) = method + filter * GxB_COMPRESSION_FILTER ;
 
     //--------------------------------------------------------------------------
     // determine # of threads to use
@@ -215,6 +235,23 @@ GrB_Info GB_serialize_array
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // filter the array, if requested
+    //--------------------------------------------------------------------------
+
+    if (filter != GB_FILTER_NONE)
+    {
+        Y = GB_MALLOC (len, GB_void, &Y_size) ;
+        if (Y == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_serialize_filter (Y, X, len, filter, esize, nthreads_max) ;
+        X = Y ;
+    }
+
     //--------------------------------------------------------------------------
     // compress the blocks in parallel
     //--------------------------------------------------------------------------
@@ -282,6 +319,7 @@ GrB_Info GB_serialize_array
     (*Sblocks_handle) = Sblocks ;
     (*Sblocks_size_handle) = Sblocks_size ;
     (*compressed_size) = Sblocks [nblocks] ;    // actual size of the blob
+    GB_FREE_WORKSPACE ;
     return (GrB_SUCCESS) ;
 }
 
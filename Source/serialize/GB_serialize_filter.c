@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_serialize_filter: pre-filters applied to an array before compression
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_COMPRESSION_FILTER is added to the compression method, each array is
+// transformed before it is compressed, so that LZ4 and ZSTD see more of its
+// redundancy:
+
+// GB_FILTER_DELTA: for the int64_t arrays A->p, A->h, and A->i, each entry is
+//      replaced with its difference from the prior entry, and the bytes of the
+//      differences are then shuffled as in GB_FILTER_SHUFFLE.  The differences
+//      are small (A->p and A->h are increasing, and A->i is increasing in each
+//      vector), so the high bytes are nearly all zero (or 0xFF, at the start
+//      of each vector of A->i).
+
+// GB_FILTER_SHUFFLE: for A->x, the array of n entries of size esize is held as
+//      esize planes of n bytes: byte b of entry k is moved to Y [b*n+k].  The
+//      planes of the high-order bytes (and of the sign and exponent of floating
+//      point values) are typically highly repetitive.
+
+// Any trailing bytes of the array (len % esize) are copied as-is.  The
+// filters are applied to the whole array in parallel, into a separate
+// workspace of the same size.  GB_deserialize_unfilter undoes the filter.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FILTER_MAX_THREADS 64
+
+//------------------------------------------------------------------------------
+// GB_serialize_filter: Y = filter (X)
+//------------------------------------------------------------------------------
+
+void GB_serialize_filter
+(
+    // output:
+    GB_void *restrict Y,            // filtered array, of size len
+    // input:
+    const GB_void *restrict X,      // array to filter, of size len
+    int64_t len,                    // size of X and Y in bytes
+    int32_t filter,                 // GB_FILTER_DELTA or GB_FILTER_SHUFFLE
+    size_t esize,                   // size of each entry of X (8 for delta)
+    int nthreads_max
+)
+{
+
+    ASSERT (filter == GB_FILTER_DELTA || filter == GB_FILTER_SHUFFLE) ;
+    ASSERT (GB_IMPLIES (filter == GB_FILTER_DELTA, esize == sizeof (int64_t)));
+    double chunk = GB_Context_chunk ( ) ;
+    int64_t n = len / esize ;
+    int64_t ntail = len - n * esize ;
+    int nthreads = GB_nthreads (len, chunk, nthreads_max) ;
+    int64_t k ;
+
+    if (filter == GB_FILTER_DELTA)
+    {
+        // Y = shuffle (X [k] - X [k-1])
+        const uint64_t *restrict Xi = (const uint64_t *) X ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            uint64_t d = Xi [k] - ((k == 0) ? 0 : Xi [k-1]) ;
+            for (int b = 0 ; b < (int) sizeof (uint64_t) ; b++)
+            {
+                Y [b*n + k] = (GB_void) (d >> (8*b)) ;
+            }
+        }
+    }
+    else
+    {
+        // Y = shuffle (X)
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            for (size_t b = 0 ; b < esize ; b++)
+            {
+                Y [b*n + k] = X [k*esize + b] ;
+            }
+        }
+    }
+
+    if (ntail > 0)
+    {
+        memcpy (Y + n * esize, X + n * esize, ntail) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_unfilter: X = unfilter (Y)
+//------------------------------------------------------------------------------
+
+void GB_deserialize_unfilter
+(
+    // output:
+    GB_void *restrict X,            // unfiltered array, of size len
+    // input:
+    const GB_void *restrict Y,      // filtered array, of size len
+    int64_t len,                    // size of X and Y in bytes
+    int32_t filter,                 // GB_FILTER_DELTA or GB_FILTER_SHUFFLE
+    size_t esize,                   // size of each entry of X (8 for delta)
+    int nthreads_max
+)
+{
+
+    ASSERT (filter == GB_FILTER_DELTA || filter == GB_FILTER_SHUFFLE) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int64_t n = len / esize ;
+    int64_t ntail = len - n * esize ;
+    int nthreads = GB_nthreads (len, chunk, nthreads_max) ;
+    int64_t k ;
+
+    //--------------------------------------------------------------------------
+    // X = unshuffle (Y)
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        for (size_t b = 0 ; b < esize ; b++)
+        {
+            X [k*esize + b] = Y [b*n + k] ;
+        }
+    }
+
+    if (ntail > 0)
+    {
+        memcpy (X + n * esize, Y + n * esize, ntail) ;
+    }
+
+    if (filter != GB_FILTER_DELTA || n == 0)
+    {
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // X = cumsum (X), for the delta filter
+    //--------------------------------------------------------------------------
+
+    // the differences wrap around modulo 2^64, as they were computed
+    uint64_t *restrict Xi = (uint64_t *) X ;
+    nthreads = GB_IMIN (nthreads, GB_FILTER_MAX_THREADS) ;
+    if (nthreads <= 1)
+    {
+        for (k = 1 ; k < n ; k++)
+        {
+            Xi [k] += Xi [k-1] ;
+        }
+    }
+    else
+    {
+        // sum of each slice of X, then a cumulative sum of each slice
+        uint64_t W [GB_FILTER_MAX_THREADS+1] ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+            uint64_t s = 0 ;
+            for (int64_t p = kstart ; p < kend ; p++)
+            {
+                s += Xi [p] ;
+            }
+            W [tid] = s ;
+        }
+        uint64_t s = 0 ;
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            uint64_t w = W [tid] ;
+            W [tid] = s ;
+            s += w ;
+        }
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+            uint64_t s = W [tid] ;
+            for (int64_t p = kstart ; p < kend ; p++)
+            {
+                s += Xi [p] ;
+                Xi [p] = s ;
+            }
+        }
+    }
+}
@@ -28,6 +28,9 @@ void GB_serialize_method
         return ;
     }
 
+    // the pre-filters (GxB_COMPRESSION_FILTER) are handled by the caller
+    method = method % GxB_COMPRESSION_FILTER ;
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
@@ -47,6 +50,7 @@ void GB_serialize_method
             break ;
 
         case GxB_COMPRESSION_LZ4 : 
+        case GxB_COMPRESSION_ALIGNED : 
             (*level) = 0 ;              // level is ignored
             break ;
 
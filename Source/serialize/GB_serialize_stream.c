@@ -0,0 +1,350 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is compressed in batches of blocks of GB_STREAM_BLOCKSIZE bytes,
+// one block per thread, and each batch is passed to the write function as soon
+// as it is compressed.  The serialized matrix is never held in memory as a
+// whole; the only workspace is one compressed block per thread (none if the
+// matrix is not compressed).  The stream format is described in
+// GB_serialize.h.  Returns GrB_INVALID_VALUE if the write function fails.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+#include "lz4_wrapper/GB_lz4.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+#define GB_FREE_ALL                                             \
+{                                                               \
+    GB_serialize_free_blocks (&Buffers, Buffers_size, nbuffers) ; \
+    GB_FREE (&Bsize, Bsize_size) ;                              \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_array: compress an array and write it to the stream
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_stream_array
+(
+    GxB_stream_write_function write_func,   // function to write the stream
+    void *stream,                   // passed to write_func
+    const GB_void *X,               // array to write, of size len bytes
+    int64_t len,
+    int32_t nblocks,                // # of blocks of X
+    int32_t algo,                   // compression algorithm
+    int32_t level,                  // compression level
+    GB_blocks *Buffers,             // workspace: one compressed block per
+    int64_t *Bsize,                 // thread, and its size
+    int nbuffers                    // # of buffers
+)
+{
+
+    bool none = (algo == GxB_COMPRESSION_NONE) ;
+    int32_t batch = none ? nblocks : nbuffers ;
+
+    for (int32_t b0 = 0 ; b0 < nblocks ; b0 += batch)
+    {
+
+        //----------------------------------------------------------------------
+        // compress the blocks b0:b0+nb-1 in parallel
+        //----------------------------------------------------------------------
+
+        int nb = (int) GB_IMIN (batch, nblocks - b0) ;
+        bool ok = true ;
+        if (!none)
+        {
+            int t ;
+            #pragma omp parallel for num_threads(nb) schedule(static) \
+                reduction(&&:ok)
+            for (t = 0 ; t < nb ; t++)
+            {
+                // compress X [kstart:kend-1] into Buffers [t].p
+                int64_t kstart, kend ;
+                GB_PARTITION (kstart, kend, len, b0 + t, nblocks) ;
+                const char *src = (const char *) (X + kstart) ;
+                char *dst = (char *) Buffers [t].p ;
+                int srcSize = (int) (kend - kstart) ;
+                int dstCapacity = (int) GB_IMIN (Buffers [t].p_size_allocated,
+                    INT32_MAX) ;
+                size_t s64 ;
+                switch (algo)
+                {
+                    case GxB_COMPRESSION_LZ4 :
+                        Bsize [t] = LZ4_compress_default (src, dst, srcSize,
+                            dstCapacity) ;
+                        break ;
+                    case GxB_COMPRESSION_LZ4HC :
+                        Bsize [t] = LZ4_compress_HC (src, dst, srcSize,
+                            dstCapacity, level) ;
+                        break ;
+                    default :
+                    case GxB_COMPRESSION_ZSTD :
+                        s64 = ZSTD_compress (dst, dstCapacity, src, srcSize,
+                            level) ;
+                        Bsize [t] = (s64 <= dstCapacity) ? ((int64_t) s64) : 0;
+                        break ;
+                }
+                ok = ok && (Bsize [t] > 0) ;
+            }
+        }
+
+        if (!ok)
+        {
+            // compression failure: this can "never" occur
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // write the blocks to the stream, in order
+        //----------------------------------------------------------------------
+
+        for (int t = 0 ; t < nb ; t++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, len, b0 + t, nblocks) ;
+            const GB_void *block = none ? (X + kstart) : Buffers [t].p ;
+            int64_t size = none ? (kend - kstart) : Bsize [t] ;
+            if (!write_func (stream, &size, sizeof (int64_t)) ||
+                !write_func (stream, block, (size_t) size))
+            {
+                // the stream cannot be written
+                return (GrB_INVALID_VALUE) ;
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    GxB_stream_write_function write_func,   // function to write the stream
+    void *stream,                   // passed to write_func
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (write_func != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize stream", GB0) ;
+    GB_blocks *Buffers = NULL ; size_t Buffers_size = 0 ;
+    int64_t *Bsize = NULL ; size_t Bsize_size = 0 ;
+    int nbuffers = 0 ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    if (algo == GxB_COMPRESSION_ALIGNED)
+    { 
+        // the arrays of a stream are not aligned
+        algo = GxB_COMPRESSION_NONE ;
+    }
+    method = algo + level ;
+    GBURBLE ("(stream compression: %s%s%s%s:%d) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
+        level) ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t len [5] = { 0, 0, 0, 0, 0 } ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            len [1] = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            len [0] = sizeof (GrB_Index) * (nvec+1) ;
+            len [3] = sizeof (GrB_Index) * anz ;
+            len [4] = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            len [2] = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            len [4] = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+    const GB_void *X [5] = { (GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x } ;
+
+    // the # of blocks and the method for each array; small arrays are not
+    // compressed, as in GB_serialize_array
+    int32_t nblocks [5], methods [5], max_nblocks = 0 ;
+    bool any_compressed = false ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (X [k] == NULL) len [k] = 0 ;
+        nblocks [k] = (int32_t) GB_ICEIL (len [k], GB_STREAM_BLOCKSIZE) ;
+        methods [k] = (algo == GxB_COMPRESSION_NONE || len [k] < 256) ?
+            GxB_COMPRESSION_NONE : method ;
+        if (methods [k] != GxB_COMPRESSION_NONE)
+        {
+            any_compressed = true ;
+            max_nblocks = GB_IMAX (max_nblocks, nblocks [k]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate one compressed block per thread
+    //--------------------------------------------------------------------------
+
+    if (any_compressed)
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        int n = (int) GB_IMAX (1, GB_IMIN (nthreads_max, max_nblocks)) ;
+        size_t bound = (algo == GxB_COMPRESSION_ZSTD) ?
+            ZSTD_compressBound (GB_STREAM_BLOCKSIZE) :
+            (size_t) LZ4_compressBound (GB_STREAM_BLOCKSIZE) ;
+        Buffers = GB_CALLOC (n, GB_blocks, &Buffers_size) ;
+        Bsize = GB_MALLOC (n, int64_t, &Bsize_size) ;
+        if (Buffers == NULL || Bsize == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        nbuffers = n ;
+        for (int t = 0 ; t < nbuffers ; t++)
+        {
+            size_t size_allocated = 0 ;
+            Buffers [t].p = GB_MALLOC (bound, GB_void, &size_allocated) ;
+            Buffers [t].p_size_allocated = size_allocated ;
+            if (Buffers [t].p == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and type_name to the stream
+    //--------------------------------------------------------------------------
+
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+    uint64_t blob_size = 0 ;        // zero for a stream
+    GB_BLOB_WRITE (blob_size, uint64_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_BLOB_WRITE (len [k], int64_t) ;
+    }
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t) ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_BLOB_WRITE (nblocks [k], int32_t) ;
+        GB_BLOB_WRITE (methods [k], int32_t) ;
+    }
+    ASSERT (s == GB_BLOB_HEADER_SIZE) ;
+
+    if (typecode == GB_UDT_code)
+    {
+        // only write the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        size_t n = GB_IMIN (strlen (atype->name), GxB_MAX_NAME_LEN-1) ;
+        memcpy (blob + s, atype->name, n) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    if (!write_func (stream, blob, s))
+    {
+        // the stream cannot be written
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress and write each array
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        int32_t array_algo = (methods [k] == GxB_COMPRESSION_NONE) ?
+            GxB_COMPRESSION_NONE : algo ;
+        GB_OK (GB_stream_array (write_func, stream, X [k], len [k],
+            nblocks [k], array_algo, level, Buffers, Bsize, nbuffers)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the GrB_NAME of the matrix
+    //--------------------------------------------------------------------------
+
+    char *user_name = A->user_name ;
+    int64_t user_name_len = (user_name == NULL) ? 0 : strlen (user_name) ;
+    if (!write_func (stream, &user_name_len, sizeof (int64_t)) ||
+        (user_name_len > 0 && !write_func (stream, user_name, user_name_len)))
+    {
+        // the stream cannot be written
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
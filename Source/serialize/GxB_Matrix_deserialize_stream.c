@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads a matrix written by GxB_Matrix_serialize_stream.  The read_func must
+// read exactly size bytes from the stream into the buffer and return true, or
+// return false if it cannot (if the stream ends early, for example), in which
+// case GrB_INVALID_OBJECT is returned.  Peak memory use is the matrix itself,
+// plus one compressed block per thread.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function read_func,     // function to read the stream
+    void *stream,                   // passed to read_func
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_stream (&C, type, read_func, stream, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (read_func) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // read the matrix from the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_stream (C, type, read_func, stream) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
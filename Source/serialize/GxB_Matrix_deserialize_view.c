@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_view: create a matrix that points into a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Identical to GxB_Matrix_deserialize, except that the arrays of C that are
+// held in a blob serialized with GxB_COMPRESSION_ALIGNED are not copied.
+// Instead, C points directly into the blob, which can be held in shared memory
+// or in a file mapped into memory.  Compressed arrays are decompressed as
+// usual, and other uncompressed arrays (with GxB_COMPRESSION_NONE, or in a
+// blob whose start is not aligned to 16 bytes in memory) are copied.
+
+// The blob is owned by the user application.  It must not be freed or
+// modified while C, or any matrix that shares its arrays (with GrB_Matrix_dup
+// and GxB_DUP_COPY_ON_WRITE, or with GxB_Matrix_view), exists.  If C is
+// modified, it first gets its own copy of the arrays (see GB_unshare.c), and
+// the blob is no longer accessed.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_view    // deserialize blob in place
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob, which must outlive C
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_view (&C, type, blob, blob_size, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_view") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the blob into a matrix, with no copy if possible
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, (const GB_void *) blob,
+        (size_t) blob_size, true) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
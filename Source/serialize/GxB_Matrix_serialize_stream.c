@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Like GxB_Matrix_serialize, except that the serialized matrix is passed to
+// the write_func in pieces, as it is compressed, instead of being returned as
+// a single blob.  The write_func must write all size bytes of the buffer to
+// the stream (a file, a socket, or any other destination) and return true, or
+// return false on error, in which case GrB_INVALID_VALUE is returned.  Peak
+// memory use is the matrix itself, plus one compressed block per thread.
+
+// The stream can only be read by GxB_Matrix_deserialize_stream.  The
+// pre-filters (GxB_COMPRESSION_FILTER) are not supported, and
+// GrB_NOT_IMPLEMENTED is returned if they are requested.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // output:
+    GxB_stream_write_function write_func,   // function to write the stream
+    void *stream,                   // passed to write_func
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (write_func, stream, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (write_func) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+    if (method >= GxB_COMPRESSION_FILTER)
+    { 
+        // the pre-filters work on whole arrays, not on the blocks of a stream
+        GB_ERROR (GrB_NOT_IMPLEMENTED, "Compression method %d: "
+            "GxB_COMPRESSION_FILTER is not supported for streams", method) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (write_func, stream, A, method, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
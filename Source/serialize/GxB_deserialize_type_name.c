@@ -53,6 +53,11 @@ GrB_Info GxB_deserialize_type_name  // return the type name of a blob
     size_t s = 0 ;
     GB_BLOB_READ (blob_size2, uint64_t) ;
     GB_BLOB_READ (typecode, int32_t) ;
+    if (typecode >= GB_BLOB_FILTERED)
+    { 
+        // the blob has filtered arrays (see GB_serialize.h)
+        typecode -= GB_BLOB_FILTERED ;
+    }
 
     if (blob_size2 != blob_size)
     { 
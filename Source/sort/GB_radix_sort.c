@@ -0,0 +1,342 @@
+//------------------------------------------------------------------------------
+// GB_radix_sort: parallel LSD radix sort of (j,i,k) tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A parallel least-significant-digit radix sort of the tuples (J [k], I [k],
+// K [k]), using (J [k], I [k]) as the key, for GB_builder.  The indices are
+// bounded (0 <= I [k] < vlen and 0 <= J [k] < vdim), so the key has only
+// ceil(log2(vlen)) + ceil(log2(vdim)) bits.  These are split into as few
+// digits as possible, each of at most GB_RADIX_BITS bits, so that the 2^bits
+// counters of each thread stay in its cache.  Each digit takes one pass over
+// the tuples: each thread counts the digits in its slice of the tuples, and
+// then scatters its slice into the workspace, in the same order.  A pass is
+// skipped if all tuples have the same digit.
+
+// The sort is stable.  GB_builder initializes K [k] = k, so the result is
+// the same as sorting with GB_msort_3 using (J,I,K) as the key.  J and K may
+// be NULL, in which case the tuples are (I [k], K [k]), (J [k], I [k]), or
+// just I [k].
+
+// If J is present, the key (J [k],I [k]) must fit in 64 bits.  J and I are
+// packed into a single array of keys, which are sorted along with K, and then
+// unpacked.  GB_builder uses GB_msort_* for larger keys.  Workspace of size n
+// is needed for the keys and for each array moved with them, plus
+// 2^GB_RADIX_BITS counters for each thread.
+
+#include "sort/GB_sort.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&W, W_size) ;             \
+    GB_FREE_WORK (&Count, Count_size) ;     \
+}
+
+// true if GB_builder may use the radix sort; true by default
+static bool GB_radix_sort_control = true ;
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_control_set/get: enable or disable the radix sort
+//------------------------------------------------------------------------------
+
+void GB_radix_sort_control_set (bool control)
+{
+    GB_ATOMIC_WRITE
+    GB_radix_sort_control = control ;
+}
+
+bool GB_radix_sort_control_get (void)
+{
+    bool control ;
+    GB_ATOMIC_READ
+    control = GB_radix_sort_control ;
+    return (control) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_nbits: # of bits to hold the integers 0 to n-1
+//------------------------------------------------------------------------------
+
+int GB_radix_sort_nbits (int64_t n)
+{
+    int nbits = 0 ;
+    while (nbits < 63 && (((int64_t) 1) << nbits) < n)
+    {
+        nbits++ ;
+    }
+    return (nbits) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_npasses: # of passes for a key of nbits
+//------------------------------------------------------------------------------
+
+static int GB_radix_sort_npasses (int nbits)
+{
+    return ((nbits + GB_RADIX_BITS - 1) / GB_RADIX_BITS) ;
+}
+
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_pass: sort the tuples by one digit of the key
+//------------------------------------------------------------------------------
+
+// The key of tuple k is Src_Key [k], and its digit is bits shift to
+// shift+dbits-1 of the key.  The tuples are moved into Dst, and the array
+// Src_A (if not NULL) is moved along with Src_Key.  Returns false if the pass
+// was skipped because all tuples have the same digit, in which case Dst is not
+// modified.
+
+static bool GB_radix_sort_pass
+(
+    // output:
+    int64_t *restrict Dst_Key,
+    int64_t *restrict Dst_A,
+    // input:
+    const int64_t *restrict Src_Key,
+    const int64_t *restrict Src_A,
+    const int shift,
+    const int dbits,
+    // workspace:
+    int64_t *restrict Count,        // size nthreads * 2^dbits
+    const int64_t n,
+    const int nthreads
+)
+{
+
+    const int64_t nbuckets = ((int64_t) 1) << dbits ;
+    const uint64_t mask = (uint64_t) (nbuckets - 1) ;
+    #define GB_DIGIT(k) ((int64_t) ((((uint64_t) Src_Key [k]) >> shift) & mask))
+    int tid ;
+
+    //--------------------------------------------------------------------------
+    // count the digits in each slice
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t *restrict Count_tid = Count + tid * nbuckets ;
+        memset (Count_tid, 0, nbuckets * sizeof (int64_t)) ;
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            Count_tid [GB_DIGIT (k)]++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // cumulative sum of the counts, in order of digit and then slice
+    //--------------------------------------------------------------------------
+
+    int64_t s = 0 ;
+    for (int64_t d = 0 ; d < nbuckets ; d++)
+    {
+        int64_t s_start = s ;
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t c = Count [tid * nbuckets + d] ;
+            Count [tid * nbuckets + d] = s ;
+            s += c ;
+        }
+        if (s - s_start == n)
+        {
+            // all tuples have digit d; skip this pass
+            return (false) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // scatter each slice into Dst
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t *restrict Count_tid = Count + tid * nbuckets ;
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, n, tid, nthreads) ;
+        if (Src_A != NULL)
+        {
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                int64_t p = Count_tid [GB_DIGIT (k)]++ ;
+                Dst_Key [p] = Src_Key [k] ;
+                Dst_A [p] = Src_A [k] ;
+            }
+        }
+        else
+        {
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                int64_t p = Count_tid [GB_DIGIT (k)]++ ;
+                Dst_Key [p] = Src_Key [k] ;
+            }
+        }
+    }
+
+    #undef GB_DIGIT
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort
+//------------------------------------------------------------------------------
+
+GrB_Info GB_radix_sort      // stable sort of (J,I,K) tuples, with key (J,I)
+(
+    int64_t *restrict J,    // size n array, or NULL
+    int64_t *restrict I,    // size n array
+    int64_t *restrict K,    // size n array, or NULL
+    const int64_t n,
+    const int64_t vlen,     // 0 <= I [k] < vlen for all k
+    const int64_t vdim,     // 0 <= J [k] < vdim for all k, if J not NULL
+    int nthreads            // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (I != NULL) ;
+    ASSERT (n >= 0 && vlen >= 0 && vdim >= 0) ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    int64_t *restrict Count = NULL ; size_t Count_size = 0 ;
+
+    int ibits = GB_radix_sort_nbits (vlen) ;
+    int jbits = (J == NULL) ? 0 : GB_radix_sort_nbits (vdim) ;
+    if (n <= 1 || ibits + jbits == 0)
+    { 
+        // nothing to do: all keys are equal
+        return (GrB_SUCCESS) ;
+    }
+
+    // If J is present, J and I are packed into a single array of keys
+    // (J [k] << ibits) + I [k], so that each pass moves only 2 arrays (the
+    // keys and K) instead of 3.  Otherwise, I itself is the key.
+    ASSERT (ibits + jbits <= 64) ;
+    bool packed = (J != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // one array of size n for each array moved in each pass, plus the packed
+    // keys themselves
+    int narrays = (packed ? 2 : 1) + (K != NULL) ;
+    // each thread sorts a slice of at least 16 * 2^GB_RADIX_BITS tuples, so
+    // that clearing and summing its counters takes little time in each pass
+    nthreads = GB_IMIN (nthreads,
+        GB_IMAX (n / (((int64_t) 16) << GB_RADIX_BITS), 1)) ;
+    W = GB_MALLOC_WORK (narrays * n, int64_t, &W_size) ;
+    Count = GB_MALLOC_WORK (nthreads * (((int64_t) 1) << GB_RADIX_BITS),
+        int64_t, &Count_size) ;
+    if (W == NULL || Count == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (packed)
+    {
+
+        //----------------------------------------------------------------------
+        // pack the keys
+        //----------------------------------------------------------------------
+
+        int64_t *restrict Key = W ;
+        int64_t *restrict W_Key = W + n ;
+        int64_t *restrict W_K = (K == NULL) ? NULL : (W + 2*n) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        { 
+            Key [k] = (int64_t) ((((uint64_t) J [k]) << ibits) + I [k]) ;
+        }
+
+        //----------------------------------------------------------------------
+        // sort the (Key,K) pairs, least significant digit first
+        //----------------------------------------------------------------------
+
+        int nbits = ibits + jbits ;
+        int npasses = GB_radix_sort_npasses (nbits) ;
+        int dbits = (nbits + npasses - 1) / npasses ;
+        int64_t *Src_Key = Key, *Src_K = K ;
+        int64_t *Dst_Key = W_Key, *Dst_K = W_K ;
+        for (int pass = 0 ; pass < npasses ; pass++)
+        {
+            int shift = pass * dbits ;
+            if (GB_radix_sort_pass (Dst_Key, Dst_K, Src_Key, Src_K,
+                shift, GB_IMIN (dbits, nbits - shift), Count, n, nthreads))
+            { 
+                int64_t *t ;
+                t = Src_Key ; Src_Key = Dst_Key ; Dst_Key = t ;
+                t = Src_K   ; Src_K   = Dst_K   ; Dst_K   = t ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // unpack the keys into J and I, and copy K back if needed
+        //----------------------------------------------------------------------
+
+        const uint64_t imask = (((uint64_t) 1) << ibits) - 1 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        { 
+            uint64_t key = (uint64_t) Src_Key [k] ;
+            J [k] = (int64_t) (key >> ibits) ;
+            I [k] = (int64_t) (key & imask) ;
+        }
+        if (K != NULL && Src_K != K)
+        { 
+            GB_memcpy (K, Src_K, n * sizeof (int64_t), nthreads) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // sort the (I,K) pairs, least significant digit first
+        //----------------------------------------------------------------------
+
+        int64_t *restrict W_I = W ;
+        int64_t *restrict W_K = (K == NULL) ? NULL : (W + n) ;
+        int npasses = GB_radix_sort_npasses (ibits) ;
+        int dbits = (ibits + npasses - 1) / npasses ;
+        int64_t *Src_I = I, *Src_K = K ;
+        int64_t *Dst_I = W_I, *Dst_K = W_K ;
+        for (int pass = 0 ; pass < npasses ; pass++)
+        {
+            int shift = pass * dbits ;
+            if (GB_radix_sort_pass (Dst_I, Dst_K, Src_I, Src_K,
+                shift, GB_IMIN (dbits, ibits - shift), Count, n, nthreads))
+            { 
+                int64_t *t ;
+                t = Src_I ; Src_I = Dst_I ; Dst_I = t ;
+                t = Src_K ; Src_K = Dst_K ; Dst_K = t ;
+            }
+        }
+
+        // copy the result back into (I,K), if it ends in the workspace
+        if (Src_I != I)
+        { 
+            GB_memcpy (I, Src_I, n * sizeof (int64_t), nthreads) ;
+            if (K != NULL) GB_memcpy (K, Src_K, n * sizeof (int64_t), nthreads);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -269,6 +269,11 @@ GrB_Info GB_sort
 
     bool A_iso = A->iso ;
     bool sort_in_place = (A == C) ;
+    if (sort_in_place)
+    { 
+        // A is sorted in place, so it must not share its arrays
+        GB_OK (GB_unshare (A, Werk)) ;
+    }
 
     // free any prior content of C and P
     GB_phybix_free (P) ;
@@ -10,7 +10,7 @@
 // All of the GB_qsort_* functions are single-threaded, by design.  The
 // GB_msort_* functions are parallel.  None of these sorting methods are
 // guaranteed to be stable, but they are always used in GraphBLAS with unique
-// keys.
+// keys.  GB_radix_sort is parallel and stable, and is used by GB_builder.
 
 #ifndef GB_SORT_H
 #define GB_SORT_H
@@ -100,6 +100,34 @@ GrB_Info GB_msort_3    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int nthreads                // # of threads to use
 ) ;
 
+//------------------------------------------------------------------------------
+// radix sort (for GB_builder)
+//------------------------------------------------------------------------------
+
+// max # of bits in each digit of GB_radix_sort
+#define GB_RADIX_BITS 11
+
+// GB_builder uses GB_radix_sort instead of GB_msort_* if it is enabled, if
+// there are at least GB_RADIX_SORT_MIN tuples, and if the key (j,i) of each
+// tuple fits in 64 bits.
+#define GB_RADIX_SORT_MIN (16 * 1024)
+
+GrB_Info GB_radix_sort      // stable sort of (J,I,K) tuples, with key (J,I)
+(
+    int64_t *restrict J,    // size n array, or NULL
+    int64_t *restrict I,    // size n array
+    int64_t *restrict K,    // size n array, or NULL
+    const int64_t n,
+    const int64_t vlen,     // 0 <= I [k] < vlen for all k
+    const int64_t vdim,     // 0 <= J [k] < vdim for all k, if J not NULL
+    int nthreads            // # of threads to use
+) ;
+
+int GB_radix_sort_nbits (int64_t n) ;   // # of bits to hold 0 to n-1
+
+void GB_radix_sort_control_set (bool control) ;
+bool GB_radix_sort_control_get (void) ;
+
 //------------------------------------------------------------------------------
 // matrix sorting (for GxB_Matrix_sort and GxB_Vector_sort)
 //------------------------------------------------------------------------------
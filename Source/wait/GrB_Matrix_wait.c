@@ -24,7 +24,7 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (A, "GrB_Matrix_wait (A, waitmode)") ;
+    GB_WHERE_LOGGER (A, "GrB_Matrix_wait (A, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
 
     //--------------------------------------------------------------------------
@@ -24,7 +24,7 @@ GrB_Info GrB_Scalar_wait    // finish all work on a scalar
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (s, "GrB_Scalar_wait (s, waitmode)") ;
+    GB_WHERE_LOGGER (s, "GrB_Scalar_wait (s, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (s) ;
 
     //--------------------------------------------------------------------------
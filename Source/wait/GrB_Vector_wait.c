@@ -24,7 +24,7 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (v, "GrB_Vector_wait (v, waitmode)") ;
+    GB_WHERE_LOGGER (v, "GrB_Vector_wait (v, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
 
     //--------------------------------------------------------------------------
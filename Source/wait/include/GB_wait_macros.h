@@ -10,8 +10,10 @@
 #ifndef GB_WAIT_MACROS_H
 #define GB_WAIT_MACROS_H
 
-// true if a matrix has pending tuples
-#define GB_PENDING(A) ((A) != NULL && (A)->Pending != NULL)
+// true if a matrix has pending tuples, in A->Pending or from concurrent
+// setElement (see GB_setElement_concurrent.c)
+#define GB_PENDING(A) \
+    ((A) != NULL && ((A)->Pending != NULL || (A)->concurrent_pending))
 
 // true if a matrix is allowed to have pending tuples
 #define GB_PENDING_OK(A) (GB_PENDING (A) || !GB_PENDING (A))
@@ -36,8 +36,9 @@
     /* initialize the Werk stack */                                 \
     Werk->pwerk = 0 ;
 
-// C is a matrix, vector, scalar, or descriptor
-#define GB_WHERE(C,where_string)                                    \
+// C is a matrix, vector, scalar, or descriptor, which is not modified
+// except for its error logger (GrB_wait, for example)
+#define GB_WHERE_LOGGER(C,where_string)                             \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
@@ -51,6 +52,40 @@
         Werk->logger_size_handle = &(C->logger_size) ;              \
     }
 
+// A matrix, vector, or scalar that shares its arrays with another (see
+// GB_dup_shared.c) must get its own copy of them before it is modified.
+#define GB_UNSHARE_OUTPUT(C)                                        \
+    _Generic ((C),                                                  \
+        GrB_Matrix : GB_unshare ((GrB_Matrix) (C), Werk),           \
+        GrB_Vector : GB_unshare ((GrB_Matrix) (C), Werk),           \
+        GrB_Scalar : GB_unshare ((GrB_Matrix) (C), Werk),           \
+        default    : GrB_SUCCESS)
+
+// Tuples from concurrent GrB_*_setElement (see GB_setElement_concurrent.c)
+// are assembled before C is modified by any other method.
+#define GB_CONCURRENT_WAIT_OUTPUT(C)                                \
+    _Generic ((C),                                                  \
+        GrB_Matrix : GB_Concurrent_wait ((GrB_Matrix) (C), Werk),   \
+        GrB_Vector : GB_Concurrent_wait ((GrB_Matrix) (C), Werk),   \
+        default    : GrB_SUCCESS)
+
+// C is a matrix, vector, scalar, or descriptor, which is the output of the
+// user-callable function
+#define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_LOGGER (C, where_string)                               \
+    {                                                               \
+        GrB_Info unshare_info = GB_UNSHARE_OUTPUT (C) ;             \
+        if (unshare_info != GrB_SUCCESS)                            \
+        {                                                           \
+            return (unshare_info) ; /* out of memory */             \
+        }                                                           \
+        GrB_Info wait_info = GB_CONCURRENT_WAIT_OUTPUT (C) ;        \
+        if (wait_info != GrB_SUCCESS)                               \
+        {                                                           \
+            return (wait_info) ; /* out of memory */                \
+        }                                                           \
+    }
+
 // create the Werk, with no error logging
 #define GB_WHERE1(where_string)                                     \
     if (!GB_Global_GrB_init_called_get ( ))                         \
@@ -18,30 +18,30 @@
 // prototypes for all PreJIT kernels
 //------------------------------------------------------------------------------
 
-JIT_DOT2 (GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2)
+JIT_DOT2 (GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2)
+JIT_DOT2 (GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2)
 JIT_DOT2 (GB_jit__AxB_dot2__4000bba0bbacf__plus_my_rdiv2)
 JIT_DOT2 (GB_jit__AxB_dot2__4000bbb0bbbcd__plus_my_rdiv)
 JIT_DOT2 (GB_jit__AxB_dot2__4015bbb0bbbcd)
-JIT_DOT2 (GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2)
 JIT_DOT2 (GB_jit__AxB_dot2__4100bba0babcd__plus_my_rdiv2)
 JIT_DOT2 (GB_jit__AxB_dot2__4100bba0babcf__plus_my_rdiv2)
-JIT_DOT2 (GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2)
 JIT_UOP  (GB_jit__user_op__0__my_rdiv)
+JIT_DOT2 (GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2)
 
 
 //------------------------------------------------------------------------------
 // prototypes for all PreJIT query kernels
 //------------------------------------------------------------------------------
 
-JIT_Q (GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2_query)
+JIT_Q (GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2_query)
+JIT_Q (GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2_query)
 JIT_Q (GB_jit__AxB_dot2__4000bba0bbacf__plus_my_rdiv2_query)
 JIT_Q (GB_jit__AxB_dot2__4000bbb0bbbcd__plus_my_rdiv_query)
 JIT_Q (GB_jit__AxB_dot2__4015bbb0bbbcd_query)
-JIT_Q (GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2_query)
 JIT_Q (GB_jit__AxB_dot2__4100bba0babcd__plus_my_rdiv2_query)
 JIT_Q (GB_jit__AxB_dot2__4100bba0babcf__plus_my_rdiv2_query)
-JIT_Q (GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2_query)
 JIT_Q (GB_jit__user_op__0__my_rdiv_query)
+JIT_Q (GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2_query)
 
 
 //------------------------------------------------------------------------------
@@ -51,15 +51,15 @@ JIT_Q (GB_jit__user_op__0__my_rdiv_query)
 #if ( 9 > 0 )
 static void *GB_prejit_kernels [9] =
 {
-GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2,
+GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2,
+GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2,
 GB_jit__AxB_dot2__4000bba0bbacf__plus_my_rdiv2,
 GB_jit__AxB_dot2__4000bbb0bbbcd__plus_my_rdiv,
 GB_jit__AxB_dot2__4015bbb0bbbcd,
-GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2,
 GB_jit__AxB_dot2__4100bba0babcd__plus_my_rdiv2,
 GB_jit__AxB_dot2__4100bba0babcf__plus_my_rdiv2,
-GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2,
-GB_jit__user_op__0__my_rdiv
+GB_jit__user_op__0__my_rdiv,
+GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2
 } ;
 #endif
 
@@ -70,15 +70,15 @@ GB_jit__user_op__0__my_rdiv
 #if ( 9 > 0 )
 static void *GB_prejit_queries [9] =
 {
-GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2_query,
+GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2_query,
+GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2_query,
 GB_jit__AxB_dot2__4000bba0bbacf__plus_my_rdiv2_query,
 GB_jit__AxB_dot2__4000bbb0bbbcd__plus_my_rdiv_query,
 GB_jit__AxB_dot2__4015bbb0bbbcd_query,
-GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2_query,
 GB_jit__AxB_dot2__4100bba0babcd__plus_my_rdiv2_query,
 GB_jit__AxB_dot2__4100bba0babcf__plus_my_rdiv2_query,
-GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2_query,
-GB_jit__user_op__0__my_rdiv_query
+GB_jit__user_op__0__my_rdiv_query,
+GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2_query
 } ;
 #endif
 
@@ -89,20 +89,39 @@ GB_jit__user_op__0__my_rdiv_query
 #if ( 9 > 0 )
 static char *GB_prejit_names [9] =
 {
-"GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2",
+"GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2",
+"GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2",
 "GB_jit__AxB_dot2__4000bba0bbacf__plus_my_rdiv2",
 "GB_jit__AxB_dot2__4000bbb0bbbcd__plus_my_rdiv",
 "GB_jit__AxB_dot2__4015bbb0bbbcd",
-"GB_jit__AxB_dot2__4100bba0baacf__plus_my_rdiv2",
 "GB_jit__AxB_dot2__4100bba0babcd__plus_my_rdiv2",
 "GB_jit__AxB_dot2__4100bba0babcf__plus_my_rdiv2",
-"GB_jit__AxB_dot2__4100bba0bbac7__plus_my_rdiv2",
-"GB_jit__user_op__0__my_rdiv"
+"GB_jit__user_op__0__my_rdiv",
+"GB_jit__AxB_dot2__4000bba0bbac7__plus_my_rdiv2"
+} ;
+#endif
+
+//------------------------------------------------------------------------------
+// GB_prejit_hashes: the hash codes of the PreJIT kernels, in ascending order
+//------------------------------------------------------------------------------
+
+#if ( 9 > 0 )
+static uint64_t GB_prejit_hashes [9] =
+{
+0x011d3f3c31fe171a,
+0x2a7fa85b1f837ed2,
+0x424842cce4da274b,
+0x4b2ea6f2b6a7b0ce,
+0x6e48218858a85299,
+0x85ddee0b2f10ccd1,
+0x9662b6723f64f3f4,
+0xa98ff14e387744fe,
+0xd4163d6cf4f3dd37
 } ;
 #endif
 
 //------------------------------------------------------------------------------
-// GB_prejit: return list of PreJIT function pointers and function names
+// GB_prejit: return the lists of PreJIT functions, names, and hashes
 //------------------------------------------------------------------------------
 
 void GB_prejit
@@ -110,7 +129,8 @@ void GB_prejit
     int32_t *nkernels,      // return # of kernels
     void ***Kernel_handle,  // return list of function pointers to kernels
     void ***Query_handle,   // return list of function pointers to queries
-    char ***Name_handle     // return list of kernel names
+    char ***Name_handle,    // return list of kernel names
+    uint64_t **Hash_handle  // return list of kernel hashes, in ascending order
 )
 {
     (*nkernels) = 9 ;
@@ -118,10 +138,12 @@ void GB_prejit
     (*Kernel_handle) = NULL ;
     (*Query_handle) = NULL ;
     (*Name_handle) = NULL ;
+    (*Hash_handle) = NULL ;
     #else
     (*Kernel_handle) = GB_prejit_kernels ;
     (*Query_handle) = GB_prejit_queries ;
     (*Name_handle) = GB_prejit_names ;
+    (*Hash_handle) = GB_prejit_hashes ;
     #endif
 }
 
@@ -278,6 +278,30 @@
 %   test284  - test GrB_mxm using indexop-based semirings
 %   test285  - test GrB_assign (bitmap case, C<!M>+=A, whole matrix)
 %   test286  - test kron with idxop
+%   test287  - test reuse of saxpy3 plans kept in a GxB_Context
+%   test288  - test the block-compare and galloping intersections
+%   test289  - test GxB_JIT_ASYNC
+%   test290  - test the JIT hash table: lookups, tombstones, and rehash
+%   test291  - test GxB_JIT_warmup
+%   test292  - test GxB_JIT_RECORD_FILE and GxB_JIT_export
+%   test293  - test the sorted hash index of PreJIT kernels
+%   test294  - test the cpu and compiler fingerprint of the JIT lib folder
+%   test295  - test GxB_JIT_TUNE_REDUCE_PANEL
+%   test296  - test the memory pool
+%   test297  - test the saxpy3 workspace kept in a GxB_Context
+%   test298  - test GxB_NUMA_FIRST_TOUCH
+%   test299  - test GxB_MEMORY_HUGE_PAGES
+%   test300  - test copy-on-write GrB_*_dup
+%   test301  - test GxB_Matrix_view
+%   test302  - test GxB_Matrix_mmap_write and GxB_Matrix_mmap_read
+%   test303  - test GxB_COMPRESSION_ALIGNED and GxB_Matrix_deserialize_view
+%   test304  - test GxB_Matrix_serialize_stream and deserialize_stream
+%   test305  - test GxB_COMPRESSION_FILTER
+%   test306  - test GxB_BUILD_RADIX_SORT
+%   test307  - test GxB_Builder
+%   test308  - test GxB_BUILD_HASH
+%   test309  - test GxB_CONCURRENT_SETELEMENT
+%   test310  - test GxB_Matrix_insertTuples and deleteTuples
 
 % Helper functions
 
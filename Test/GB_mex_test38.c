@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test the saxpy3 plans kept in a GxB_Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/mxm/GB_AxB_saxpy3.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&C0) ;             \
+    GrB_Descriptor_free (&desc) ;       \
+    GxB_Context_free (&Context) ;       \
+}
+
+//------------------------------------------------------------------------------
+// nplans: return the # of plans kept in a Context
+//------------------------------------------------------------------------------
+
+int nplans (GxB_Context Context) ;
+int nplans (GxB_Context Context)
+{
+    int n = 0 ;
+    for (int k = 0 ; Context->mxm_plans != NULL &&
+        k < Context->mxm_plan_max ; k++)
+    {
+        if (Context->mxm_plans [k].SaxpyTasks != NULL) n++ ;
+    }
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse INT64 matrix
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index n, int64_t nz) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index n, int64_t nz)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_INT64, n, n)) ;
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % n ;
+        GrB_Index j = simple_rand_i ( ) % n ;
+        int64_t x = (int64_t) (simple_rand_i ( ) % 7) + 1 ;
+        OK (GrB_Matrix_setElement_INT64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test38 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C = NULL, C0 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GxB_Context Context = NULL ;
+    GrB_Semiring semiring = GrB_PLUS_TIMES_SEMIRING_INT64 ;
+    const GrB_Index n = 1000 ;
+
+    //--------------------------------------------------------------------------
+    // create a Context that keeps saxpy3 plans
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_new (&Context)) ;
+    int32_t nmax = -1 ;
+    OK (GxB_Context_get_INT_ (Context, &nmax, GxB_MXM_PLAN)) ;
+    CHECK (nmax == 0) ;
+    OK (GxB_Context_set_INT_ (Context, GB_SAXPY3_PLAN_MAX + 100,
+        GxB_MXM_PLAN)) ;
+    OK (GxB_Context_get_INT_ (Context, &nmax, GxB_MXM_PLAN)) ;
+    CHECK (nmax == GB_SAXPY3_PLAN_MAX) ;
+    OK (GxB_Context_set_INT_ (Context, 4, GxB_MXM_PLAN)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // test plan hits, misses, and invalidation
+    //--------------------------------------------------------------------------
+
+    for (int method = 0 ; method <= 1 ; method++)
+    {
+        OK (GrB_Descriptor_set_INT32 (desc,
+            (method == 0) ? GxB_AxB_HASH : GxB_AxB_GUSTAVSON,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+
+        for (int mask = 0 ; mask <= 3 ; mask++)
+        {
+            // mask 0: none, 1: valued M, 2: structural M, 3: structural !M
+            OK (GrB_Descriptor_set_INT32 (desc,
+                (mask == 2) ? GrB_STRUCTURE :
+                (mask == 3) ? GrB_COMP_STRUCTURE : GrB_DEFAULT,
+                GrB_MASK)) ;
+            OK (random_matrix (&A, n, 3*n)) ;
+            OK (random_matrix (&B, n, 3*n)) ;
+            if (mask > 0)
+            {
+                OK (random_matrix (&M, n, 8*n)) ;
+            }
+            OK (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+            OK (GrB_Matrix_new (&C0, GrB_INT64, n, n)) ;
+
+            for (int trial = 0 ; trial < 6 ; trial++)
+            {
+
+                //--------------------------------------------------------------
+                // change the inputs
+                //--------------------------------------------------------------
+
+                bool hit = true ;
+                if (trial == 2)
+                {
+                    // change the values of A but not its pattern: a hit
+                    OK (GrB_Matrix_apply_BinaryOp2nd_INT64 (A, NULL, NULL,
+                        GrB_PLUS_INT64, A, 1, NULL)) ;
+                }
+                else if (trial == 3)
+                {
+                    // change the pattern of B: a miss
+                    GrB_Index i = 0, j = 0 ;
+                    int64_t x = 0 ;
+                    while (GrB_Matrix_extractElement_INT64 (&x, B, i, j)
+                        == GrB_SUCCESS)
+                    {
+                        i++ ;
+                    }
+                    OK (GrB_Matrix_setElement_INT64 (B, 3, i, j)) ;
+                    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+                    hit = false ;
+                }
+                else if (trial == 4)
+                {
+                    // corrupt the copy of the arrays kept in each plan, so
+                    // that each key still matches but its arrays do not:
+                    // no plan is reused
+                    for (int k = 0 ; k < Context->mxm_plan_max ; k++)
+                    {
+                        GB_saxpy3_plan plan = &(Context->mxm_plans [k]) ;
+                        if (plan->SaxpyTasks != NULL)
+                        {
+                            plan->Pattern [0] ^= 1 ;
+                        }
+                    }
+                    hit = false ;
+                }
+                else if (trial == 5 && mask == 1)
+                {
+                    // change a value of the valued mask M: a miss
+                    GrB_Index i = 0, j = 0 ;
+                    int64_t x = 0 ;
+                    while (GrB_Matrix_extractElement_INT64 (&x, M, i, j)
+                        != GrB_SUCCESS)
+                    {
+                        i++ ;
+                    }
+                    OK (GrB_Matrix_setElement_INT64 (M, 0, i, j)) ;
+                    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+                    hit = false ;
+                }
+                else if (trial == 0)
+                {
+                    // the first C=A*B with these inputs: a miss
+                    hit = false ;
+                }
+
+                //--------------------------------------------------------------
+                // C0 = A*B without any plans
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_clear (C0)) ;
+                OK (GrB_mxm (C0, M, NULL, semiring, A, B, desc)) ;
+
+                //--------------------------------------------------------------
+                // C = A*B, with the Context engaged
+                //--------------------------------------------------------------
+
+                OK (GxB_Context_engage (Context)) ;
+                int nplans_before = nplans (Context) ;
+                OK (GrB_Matrix_clear (C)) ;
+                OK (GrB_mxm (C, M, NULL, semiring, A, B, desc)) ;
+                int nplans_after = nplans (Context) ;
+                OK (GxB_Context_disengage (Context)) ;
+
+                // a miss saves a new plan, replacing the oldest if all 4 are
+                // in use; a hit saves nothing
+                if (hit)
+                {
+                    CHECK (nplans_after == nplans_before) ;
+                }
+                else
+                {
+                    CHECK (nplans_after == GB_IMIN (nplans_before + 1, 4)) ;
+                }
+                CHECK (nplans_after > 0) ;
+
+                // the result is the same as C0
+                CHECK (GB_mx_isequal (C, C0, 0)) ;
+            }
+
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+            GrB_Matrix_free (&M) ;
+            GrB_Matrix_free (&C) ;
+            GrB_Matrix_free (&C0) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // the plans are freed when the plan count is set to zero
+    //--------------------------------------------------------------------------
+
+    CHECK (nplans (Context) == 4) ;
+    OK (GxB_Context_set_INT_ (Context, 0, GxB_MXM_PLAN)) ;
+    CHECK (nplans (Context) == 0) ;
+    CHECK (Context->mxm_plans == NULL) ;
+
+    // GxB_CONTEXT_WORLD keeps no plans
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, 4, GxB_MXM_PLAN)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38:  all tests passed\n\n") ;
+}
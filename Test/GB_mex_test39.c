@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test the block-compare and galloping intersections
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define LMAX 2000
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&B2) ;             \
+    GrB_Descriptor_free (&desc) ;       \
+}
+
+//------------------------------------------------------------------------------
+// random_list: create a sorted list of unique indices in the range 0:n-1
+//------------------------------------------------------------------------------
+
+int64_t random_list (int64_t *X, int64_t n, int64_t len) ;
+int64_t random_list (int64_t *X, int64_t n, int64_t len)
+{
+    // each index in 0:n-1 is kept with probability about len/n
+    int64_t k = 0 ;
+    for (int64_t i = 0 ; i < n && k < LMAX ; i++)
+    {
+        if ((int64_t) (simple_rand_i ( ) % n) < len) X [k++] = i ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// intersect: find all pairs with X [px] == Y [py] with a given method
+//------------------------------------------------------------------------------
+
+int64_t intersect (int method, int64_t *P, int64_t *Q,
+    const int64_t *X, int64_t nx, const int64_t *Y, int64_t ny) ;
+int64_t intersect (int method, int64_t *P, int64_t *Q,
+    const int64_t *X, int64_t nx, const int64_t *Y, int64_t ny)
+{
+    int64_t px = 0, py = 0, k = 0 ;
+    while (GB_intersect_next (method, X, &px, nx, Y, &py, ny))
+    {
+        P [k] = px++ ;
+        Q [k] = py++ ;
+        k++ ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse matrix with columns of mixed density
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index n, bool dense_cols) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index n, bool dense_cols)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (*A, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        // some columns are very sparse, and some are nearly dense, so the
+        // intersections have both long and short lists of all ratios
+        int64_t len = (dense_cols && j % 3 == 0) ? (n/2) :
+            (j % 5 == 0) ? 1 : (int64_t) (simple_rand_i ( ) % 40) ;
+        for (int64_t k = 0 ; k < len ; k++)
+        {
+            GrB_Index i = simple_rand_i ( ) % n ;
+            double x = (double) (simple_rand_i ( ) % 7) + 1 ;
+            OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// isequal: check if two matrices are equal, once both are sparse
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test39 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL, B2 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int64_t X [LMAX], Y [LMAX], P1 [LMAX], Q1 [LMAX], P2 [LMAX], Q2 [LMAX] ;
+
+    //--------------------------------------------------------------------------
+    // test GB_intersect_next with each method the cpu supports
+    //--------------------------------------------------------------------------
+
+    int nmethods = 1 ;
+    #if GB_INTERSECT_HAS_SIMD
+    if (GB_Global_cpu_features_avx2 ( )) nmethods = 2 ;
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( )) nmethods = 3 ;
+    #endif
+    #endif
+    printf ("intersect methods tested: %d\n", nmethods) ;
+
+    int64_t n_list [ ] = { 1, 4, 8, 9, 17, 100, 2000 } ;
+    for (int kn = 0 ; kn < 7 ; kn++)
+    {
+        int64_t n = n_list [kn] ;
+        for (int64_t xlen = 0 ; xlen <= n ; xlen = (xlen == 0) ? 1 : 3*xlen)
+        {
+            for (int64_t ylen = 0 ; ylen <= n ; ylen = (ylen == 0) ? 1 : 2*ylen)
+            {
+                for (int trial = 0 ; trial < 20 ; trial++)
+                {
+                    int64_t nx = random_list (X, n, xlen) ;
+                    int64_t ny = random_list (Y, n, ylen) ;
+                    int64_t k1 = intersect (GB_INTERSECT_SCALAR, P1, Q1,
+                        X, nx, Y, ny) ;
+                    for (int method = 1 ; method < nmethods ; method++)
+                    {
+                        // the pairs are found in the same order
+                        int64_t k2 = intersect (method, P2, Q2, X, nx, Y, ny);
+                        CHECK (k1 == k2) ;
+                        for (int64_t k = 0 ; k < k1 ; k++)
+                        {
+                            CHECK (P1 [k] == P2 [k] && Q1 [k] == Q2 [k]) ;
+                            CHECK (X [P1 [k]] == Y [Q1 [k]]) ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // test galloping search against binary search
+    //--------------------------------------------------------------------------
+
+    for (int trial = 0 ; trial < 200 ; trial++)
+    {
+        int64_t nx = random_list (X, 3000, 1 + trial * 5) ;
+        for (int64_t i = -1 ; i <= 3000 ; i += 1 + (trial % 7))
+        {
+            for (int64_t p0 = 0 ; p0 < nx ; p0 += 1 + nx/5)
+            {
+                int64_t pleft1 = p0, pright1 = nx-1 ;
+                int64_t pleft2 = p0, pright2 = nx-1 ;
+                bool found1, found2 ;
+                GB_BINARY_SEARCH (i, X, pleft1, pright1, found1) ;
+                GB_GALLOP_SEARCH (i, X, pleft2, pright2, found2) ;
+                CHECK (found1 == found2) ;
+                if (found1) CHECK (pleft1 == pleft2) ;
+                // the trimmed searches find the same first entry >= i
+                pleft1 = p0 ; pright1 = nx-1 ;
+                pleft2 = p0 ; pright2 = nx-1 ;
+                GB_TRIM_BINARY_SEARCH (i, X, pleft1, pright1) ;
+                GB_TRIM_GALLOP_SEARCH (i, X, pleft2, pright2) ;
+                CHECK (pleft1 == pleft2) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // test dot2, dot3, and emult_08 against other methods
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        GrB_Index n = (trial < 2) ? 200 : 1000 ;
+        OK (random_matrix (&A, n, trial % 2 == 0)) ;
+        OK (random_matrix (&B, n, true)) ;
+        OK (random_matrix (&M, n, false)) ;
+        OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+
+        // C<M>=A'*B with dot3 and Gustavson
+        OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+        OK (GrB_mxm (C1, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+        OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_GUSTAVSON,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+        OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+        CHECK (isequal (C1, C2)) ;
+
+        // C=A'*B with dot2 and Gustavson
+        OK (GrB_Matrix_clear (C1)) ;
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_DOT,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+        OK (GrB_mxm (C1, NULL, NULL, GxB_PLUS_PAIR_FP64, A, B, desc)) ;
+        OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_GUSTAVSON,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GxB_PLUS_PAIR_FP64, A, B, desc)) ;
+        CHECK (isequal (C1, C2)) ;
+
+        // C=A.*B with both sparse (emult_08), and with B bitmap
+        OK (GrB_Matrix_clear (C1)) ;
+        OK (GrB_Matrix_clear (C2)) ;
+        OK (GrB_Matrix_dup (&B2, B)) ;
+        OK (GrB_Matrix_set_INT32 (B2, GxB_BITMAP,
+            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (C1, NULL, NULL, GrB_TIMES_FP64,
+            A, B, NULL)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (C2, NULL, NULL, GrB_TIMES_FP64,
+            A, B2, NULL)) ;
+        CHECK (isequal (C1, C2)) ;
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+        GrB_Matrix_free (&M) ;
+        GrB_Matrix_free (&C1) ;
+        GrB_Matrix_free (&C2) ;
+        GrB_Matrix_free (&B2) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39:  all tests passed\n\n") ;
+}
+
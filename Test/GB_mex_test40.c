@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test GxB_JIT_ASYNC
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+//------------------------------------------------------------------------------
+// find_file: check if the JIT cache has a file for a given operator
+//------------------------------------------------------------------------------
+
+// The kernel name includes the name of its user-defined operator, so the cache
+// is searched for a file whose name contains the operator name and ends with
+// the given suffix.
+
+bool find_file (const char *folder, const char *name, const char *suffix) ;
+bool find_file (const char *folder, const char *name, const char *suffix)
+{
+    DIR *dir = opendir (folder) ;
+    if (dir == NULL) return (false) ;
+    bool found = false ;
+    struct dirent *entry ;
+    size_t slen = strlen (suffix) ;
+    while (!found && (entry = readdir (dir)) != NULL)
+    {
+        const char *file = entry->d_name ;
+        if (file [0] == '.') continue ;
+        char path [8192] ;
+        snprintf (path, 8192, "%s/%s", folder, file) ;
+        struct stat st ;
+        if (stat (path, &st) != 0) continue ;
+        if (S_ISDIR (st.st_mode))
+        {
+            // search the subfolders (lib, c, and their buckets)
+            found = find_file (path, name, suffix) ;
+        }
+        else
+        {
+            size_t len = strlen (file) ;
+            found = (strstr (file, name) != NULL && len >= slen &&
+                strcmp (file + len - slen, suffix) == 0) ;
+        }
+    }
+    closedir (dir) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// test40_add: the operator, z = x+y+1
+//------------------------------------------------------------------------------
+
+void test40_add (double *z, const double *x, const double *y) ;
+void test40_add (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) + 1 ;
+}
+
+//------------------------------------------------------------------------------
+// check_add: C = A+A with the operator, and check the result
+//------------------------------------------------------------------------------
+
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op) ;
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, op, A, A, NULL)) ;
+    GrB_Index n = 0 ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        double c = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c, C, i, i)) ;
+        CHECK (c == 2*i + 1) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test40 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char cache [4096], name [256], defn [1024] ;
+
+    //--------------------------------------------------------------------------
+    // get/set GxB_JIT_ASYNC
+    //--------------------------------------------------------------------------
+
+    int32_t async = -1, control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &async, (GrB_Field) GxB_JIT_ASYNC));
+    CHECK (async == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true, (GrB_Field) GxB_JIT_ASYNC)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &async, (GrB_Field) GxB_JIT_ASYNC));
+    CHECK (async == 1) ;
+
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    if (control != GxB_JIT_ON)
+    {
+        // the JIT cannot compile any kernels
+        printf ("JIT is not enabled; GxB_JIT_ASYNC not tested\n") ;
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+            (GrB_Field) GxB_JIT_ASYNC)) ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test40:  all tests passed\n\n") ;
+        return ;
+    }
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, cache,
+        (GrB_Field) GxB_JIT_CACHE_PATH)) ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    for (int64_t i = 0 ; i < 10 ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) i, i, i)) ;
+    }
+
+    // Each operator has a new name in each run of this test, so its kernel
+    // is never already in the cache.
+    int id = (int) getpid ( ) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel in the background
+    //--------------------------------------------------------------------------
+
+    snprintf (name, 256, "test40_add_%d", id) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test40_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+
+    // the generic kernel is used until the lib*.so file appears
+    OK (check_add (C, A, op)) ;
+    CHECK (find_file (cache, name, ".c")) ;
+    bool done = false ;
+    for (int trial = 0 ; trial < 1200 && !done ; trial++)
+    {
+        OK (check_add (C, A, op)) ;
+        done = find_file (cache, name, GB_LIB_SUFFIX) ;
+        if (!done) usleep (100000) ;
+    }
+    CHECK (done) ;
+    // load the compiled kernel and use it
+    OK (check_add (C, A, op)) ;
+    OK (check_add (C, A, op)) ;
+    GrB_BinaryOp_free (&op) ;
+
+    //--------------------------------------------------------------------------
+    // a kernel that fails to compile in the background
+    //--------------------------------------------------------------------------
+
+    // The generic kernel is used for it, and the JIT control is left as-is.
+    // A kernel that fails to compile right away would disable the JIT.
+
+    snprintf (name, 256, "test40_bad_%d", id) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; syntax error }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test40_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (check_add (C, A, op)) ;
+    done = false ;
+    for (int trial = 0 ; trial < 1200 && !done ; trial++)
+    {
+        done = find_file (cache, name, ".failed") ;
+        if (!done) usleep (100000) ;
+    }
+    CHECK (done) ;
+    // the next use finds the *.failed file and removes it
+    OK (check_add (C, A, op)) ;
+    CHECK (!find_file (cache, name, ".failed")) ;
+    CHECK (!find_file (cache, name, GB_LIB_SUFFIX)) ;
+    // the kernel is not compiled again
+    OK (check_add (C, A, op)) ;
+    CHECK (!find_file (cache, name, ".failed")) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    CHECK (control == GxB_JIT_ON) ;
+    GrB_BinaryOp_free (&op) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel right away
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false, (GrB_Field) GxB_JIT_ASYNC)) ;
+    snprintf (name, 256, "test40_sync_%d", id) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test40_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (find_file (cache, name, GB_LIB_SUFFIX)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test the JIT hash table: lookups, tombstones, and rehash
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Entries are inserted in the JIT hash table directly, with kernels that are
+// never called.  Their dl_handle is the handle of the program itself, so that
+// closing it when the entry is freed has no effect.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/jitifyer/GB_jitifyer.h"
+#include <dlfcn.h>
+
+// all colliding entries have this hash, so they form a single probe sequence
+#define HASH  ((uint64_t) 0x0123456789ABCDEF)
+#define NCHAIN 60
+#define NFILL  10000
+
+// the other entries have scattered hashes
+#define FILL_HASH(k) (((uint64_t) (k)) * ((uint64_t) 0x9E3779B97F4A7C15))
+
+static char kernel [NCHAIN + NFILL] ;
+
+//------------------------------------------------------------------------------
+// insert: insert an entry for a fake kernel
+//------------------------------------------------------------------------------
+
+bool insert (uint64_t hash, int64_t k, bool keep) ;
+bool insert (uint64_t hash, int64_t k, bool keep)
+{
+    // GB_jitifyer_table_free (false) keeps entries for user-defined operators
+    GB_jit_encoding encoding ;
+    encoding.code = (uint64_t) k ;
+    encoding.kcode = keep ? GB_JIT_KERNEL_USEROP : GB_JIT_KERNEL_ADD ;
+    encoding.suffix_len = 0 ;
+    bool ok ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        ok = GB_jitifyer_insert (hash, &encoding, NULL,
+            dlopen (NULL, RTLD_LAZY), &(kernel [k]), -1) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// lookup: find an entry for a fake kernel
+//------------------------------------------------------------------------------
+
+void *lookup (uint64_t hash, int64_t k, bool keep) ;
+void *lookup (uint64_t hash, int64_t k, bool keep)
+{
+    GB_jit_encoding encoding ;
+    encoding.code = (uint64_t) k ;
+    encoding.kcode = keep ? GB_JIT_KERNEL_USEROP : GB_JIT_KERNEL_ADD ;
+    encoding.suffix_len = 0 ;
+    int64_t k1 = -1, kk = -1 ;
+    void *dl_function ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        dl_function = GB_jitifyer_lookup (hash, &encoding, NULL, &k1, &kk) ;
+    }
+    if (dl_function != NULL && (k1 != -1 || kk < 0)) return (NULL) ;
+    return (dl_function) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test41 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    // start with an empty table
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_RUN,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    //--------------------------------------------------------------------------
+    // insert a single probe sequence of entries, alternately kept and freed
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < NCHAIN ; k++)
+    {
+        CHECK (insert (HASH, k, k % 2 == 0)) ;
+    }
+    for (int64_t k = 0 ; k < NCHAIN ; k++)
+    {
+        CHECK (lookup (HASH, k, k % 2 == 0) == &(kernel [k])) ;
+        // the same code with the other kcode is not in the table
+        CHECK (lookup (HASH, k, k % 2 != 0) == NULL) ;
+    }
+    CHECK (lookup (HASH, NCHAIN, true) == NULL) ;
+    CHECK (lookup (HASH, NCHAIN, false) == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // free the odd entries, leaving tombstones in the probe sequence
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jitifyer_table_free (false) ;
+    }
+    for (int64_t k = 0 ; k < NCHAIN ; k++)
+    {
+        // the search continues past each tombstone
+        void *dl_function = lookup (HASH, k, k % 2 == 0) ;
+        CHECK (dl_function == ((k % 2 == 0) ? &(kernel [k]) : NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // reinsert the freed entries, and search for them all in parallel
+    //--------------------------------------------------------------------------
+
+    // The table is not rehashed, so the searches may be done outside the
+    // critical section while the entries are inserted.
+    int nthreads = 4 ;
+    bool ok = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+        reduction(&&:ok)
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        if (tid == 0)
+        {
+            for (int64_t k = 1 ; k < NCHAIN ; k += 2)
+            {
+                ok = ok && insert (HASH, k, false) ;
+            }
+        }
+        else
+        {
+            for (int trial = 0 ; trial < 100 ; trial++)
+            {
+                for (int64_t k = 0 ; k < NCHAIN ; k++)
+                {
+                    GB_jit_encoding encoding ;
+                    encoding.code = (uint64_t) k ;
+                    encoding.kcode = (k % 2 == 0) ? GB_JIT_KERNEL_USEROP :
+                        GB_JIT_KERNEL_ADD ;
+                    encoding.suffix_len = 0 ;
+                    int64_t k1 = -1, kk = -1 ;
+                    void *dl_function = GB_jitifyer_lookup (HASH, &encoding,
+                        NULL, &k1, &kk) ;
+                    // a reinserted entry may not be found yet, but a kept
+                    // entry is always found, and never the wrong one
+                    ok = ok && ((dl_function == &(kernel [k])) ||
+                        (dl_function == NULL && k % 2 != 0)) ;
+                }
+            }
+        }
+    }
+    CHECK (ok) ;
+    for (int64_t k = 0 ; k < NCHAIN ; k++)
+    {
+        CHECK (lookup (HASH, k, k % 2 == 0) == &(kernel [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // fill the table so that it is rehashed
+    //--------------------------------------------------------------------------
+
+    // free the odd entries again, so the table has tombstones when rehashed
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jitifyer_table_free (false) ;
+    }
+    for (int64_t k = NCHAIN ; k < NCHAIN + NFILL ; k++)
+    {
+        CHECK (insert (FILL_HASH (k), k, true)) ;
+    }
+    for (int64_t k = 0 ; k < NCHAIN ; k++)
+    {
+        void *dl_function = lookup (HASH, k, k % 2 == 0) ;
+        CHECK (dl_function == ((k % 2 == 0) ? &(kernel [k]) : NULL)) ;
+    }
+    for (int64_t k = NCHAIN ; k < NCHAIN + NFILL ; k++)
+    {
+        uint64_t hash = FILL_HASH (k) ;
+        CHECK (lookup (hash, k, true) == &(kernel [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free all entries and restore the JIT control
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jitifyer_table_free (true) ;
+    }
+    CHECK (lookup (HASH, 0, true) == NULL) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,256 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test GxB_JIT_warmup
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+//------------------------------------------------------------------------------
+// find_file: find a file in the JIT cache for a given operator
+//------------------------------------------------------------------------------
+
+// The kernel name includes the name of its user-defined operator, so the cache
+// is searched for a file whose name contains the operator name and ends with
+// the given suffix.  Its path is returned in path, if found.
+
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix) ;
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix)
+{
+    DIR *dir = opendir (folder) ;
+    if (dir == NULL) return (false) ;
+    bool found = false ;
+    struct dirent *entry ;
+    size_t slen = strlen (suffix) ;
+    while (!found && (entry = readdir (dir)) != NULL)
+    {
+        const char *file = entry->d_name ;
+        if (file [0] == '.') continue ;
+        snprintf (path, 4096, "%s/%s", folder, file) ;
+        struct stat st ;
+        if (stat (path, &st) != 0) continue ;
+        if (S_ISDIR (st.st_mode))
+        {
+            // search the subfolders (lib, c, and their buckets)
+            char subfolder [4096] ;
+            strncpy (subfolder, path, 4096) ;
+            found = find_file (path, subfolder, name, suffix) ;
+        }
+        else
+        {
+            size_t len = strlen (file) ;
+            found = (strstr (file, name) != NULL && len >= slen &&
+                strcmp (file + len - slen, suffix) == 0) ;
+        }
+    }
+    closedir (dir) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// test42_add: the operator, z = x+y+1
+//------------------------------------------------------------------------------
+
+void test42_add (double *z, const double *x, const double *y) ;
+void test42_add (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) + 1 ;
+}
+
+//------------------------------------------------------------------------------
+// check_add: C = A+A with the operator, and check the result
+//------------------------------------------------------------------------------
+
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op) ;
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, op, A, A, NULL)) ;
+    GrB_Index n = 0 ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        double c = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c, C, i, i)) ;
+        CHECK (c == 2*i + 1) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test42 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char cache [4096], name [256], defn [1024], source [4096], lib [4096],
+        kernel_name [4096], copy [4096] ;
+    const char *manifest = "/tmp/GB_mex_test42_manifest.txt" ;
+    const char *folder = "/tmp/GB_mex_test42" ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_warmup (NULL, 1, NULL, 2)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_JIT_warmup (NULL, 0, "/tmp/GB_mex_test42_nothing_here.txt", 2)) ;
+
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    if (control != GxB_JIT_ON)
+    {
+        // the JIT cannot compile any kernels
+        expected = GrB_NO_VALUE ;
+        ERR (GxB_JIT_warmup (NULL, 0, NULL, 2)) ;
+        printf ("JIT is not enabled; GxB_JIT_warmup not tested\n") ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test42:  all tests passed\n\n") ;
+        return ;
+    }
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, cache,
+        (GrB_Field) GxB_JIT_CACHE_PATH)) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel with a new user-defined operator
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    for (int64_t i = 0 ; i < 10 ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) i, i, i)) ;
+    }
+
+    // the operator has a new name in each run of this test, so its kernel is
+    // never already in the cache
+    snprintf (name, 256, "test42_add_%d", (int) getpid ( )) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test42_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (find_file (source, cache, name, ".c")) ;
+    CHECK (find_file (lib, cache, name, GB_LIB_SUFFIX)) ;
+
+    // get the kernel name from its source file
+    const char *p = strrchr (source, '/') + 1 ;
+    strncpy (kernel_name, p, 4096) ;
+    kernel_name [strlen (kernel_name) - 2] = '\0' ;
+    printf ("kernel: %s\n", kernel_name) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernel again, by its name
+    //--------------------------------------------------------------------------
+
+    // no kernels are compiled unless the JIT control is GxB_JIT_ON
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    expected = GrB_NO_VALUE ;
+    const char *kernels [4] ;
+    kernels [0] = kernel_name ;
+    ERR (GxB_JIT_warmup (kernels, 1, NULL, 2)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    CHECK (remove (lib) == 0) ;
+    // kernels that cannot be found are skipped, and so are names that are
+    // not kernel names
+    kernels [1] = "GB_jit__add__000bbb0bbb45__no_such_kernel" ;
+    kernels [2] = "../../GB_jit__add__000bbb0bbb45__bad_name" ;
+    kernels [3] = NULL ;
+    OK (GxB_JIT_warmup (kernels, 4, NULL, 2)) ;
+    CHECK (find_file (lib, cache, name, GB_LIB_SUFFIX)) ;
+    // a kernel that is already compiled is skipped
+    struct stat st1, st2 ;
+    CHECK (stat (lib, &st1) == 0) ;
+    OK (GxB_JIT_warmup (kernels, 1, NULL, 0)) ;
+    CHECK (stat (lib, &st2) == 0) ;
+    CHECK (st1.st_mtime == st2.st_mtime && st1.st_ino == st2.st_ino) ;
+    OK (check_add (C, A, op)) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernel from a copy of its source, given in a manifest
+    //--------------------------------------------------------------------------
+
+    mkdir (folder, 0777) ;
+    snprintf (copy, 4096, "%s/%s.c", folder, kernel_name) ;
+    FILE *fin = fopen (source, "r") ;
+    FILE *fout = fopen (copy, "w") ;
+    CHECK (fin != NULL && fout != NULL) ;
+    int c ;
+    while ((c = fgetc (fin)) != EOF) fputc (c, fout) ;
+    fclose (fin) ;
+    fclose (fout) ;
+
+    // remove the kernel from the cache, and from the JIT hash table
+    CHECK (remove (lib) == 0) ;
+    CHECK (remove (source) == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    FILE *fm = fopen (manifest, "w") ;
+    CHECK (fm != NULL) ;
+    fprintf (fm, "# kernels to compile\n\n%s\n", copy) ;
+    fclose (fm) ;
+    OK (GxB_JIT_warmup (NULL, 0, manifest, 4)) ;
+    // the source is copied into the cache, and compiled
+    CHECK (stat (source, &st1) == 0) ;
+    CHECK (stat (lib, &st1) == 0) ;
+
+    // the compiled kernel is loaded when it is needed
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_LOAD,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    remove (manifest) ;
+    remove (copy) ;
+    rmdir (folder) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,311 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test GxB_JIT_RECORD_FILE and GxB_JIT_export
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+//------------------------------------------------------------------------------
+// find_file: find a file in the JIT cache for a given operator
+//------------------------------------------------------------------------------
+
+// The kernel name includes the name of its user-defined operator, so the cache
+// is searched for a file whose name contains the operator name and ends with
+// the given suffix.  Its path is returned in path, if found.
+
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix) ;
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix)
+{
+    DIR *dir = opendir (folder) ;
+    if (dir == NULL) return (false) ;
+    bool found = false ;
+    struct dirent *entry ;
+    size_t slen = strlen (suffix) ;
+    while (!found && (entry = readdir (dir)) != NULL)
+    {
+        const char *file = entry->d_name ;
+        if (file [0] == '.') continue ;
+        snprintf (path, 4096, "%s/%s", folder, file) ;
+        struct stat st ;
+        if (stat (path, &st) != 0) continue ;
+        if (S_ISDIR (st.st_mode))
+        {
+            // search the subfolders (lib, c, and their buckets)
+            char subfolder [4096] ;
+            strncpy (subfolder, path, 4096) ;
+            found = find_file (path, subfolder, name, suffix) ;
+        }
+        else
+        {
+            size_t len = strlen (file) ;
+            found = (strstr (file, name) != NULL && len >= slen &&
+                strcmp (file + len - slen, suffix) == 0) ;
+        }
+    }
+    closedir (dir) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// test43_add: the operator, z = x+y+1
+//------------------------------------------------------------------------------
+
+void test43_add (double *z, const double *x, const double *y) ;
+void test43_add (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) + 1 ;
+}
+
+//------------------------------------------------------------------------------
+// check_add: C = A+A with the operator, and check the result
+//------------------------------------------------------------------------------
+
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op) ;
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, op, A, A, NULL)) ;
+    GrB_Index n = 0 ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        double c = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c, C, i, i)) ;
+        CHECK (c == 2*i + 1) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// file_count: count the lines in a file that are equal to a given string
+//------------------------------------------------------------------------------
+
+int file_count (const char *filename, const char *s) ;
+int file_count (const char *filename, const char *s)
+{
+    FILE *fp = fopen (filename, "r") ;
+    if (fp == NULL) return (-1) ;
+    int count = 0 ;
+    char line [4096] ;
+    while (fgets (line, 4096, fp) != NULL)
+    {
+        line [strcspn (line, "\n")] = '\0' ;
+        if (strcmp (line, s) == 0) count++ ;
+    }
+    fclose (fp) ;
+    return (count) ;
+}
+
+//------------------------------------------------------------------------------
+// same_file: check if two files are identical
+//------------------------------------------------------------------------------
+
+bool same_file (const char *filename1, const char *filename2) ;
+bool same_file (const char *filename1, const char *filename2)
+{
+    FILE *f1 = fopen (filename1, "r") ;
+    FILE *f2 = fopen (filename2, "r") ;
+    bool same = (f1 != NULL && f2 != NULL) ;
+    while (same)
+    {
+        int c1 = fgetc (f1) ;
+        int c2 = fgetc (f2) ;
+        same = (c1 == c2) ;
+        if (c1 == EOF) break ;
+    }
+    if (f1 != NULL) fclose (f1) ;
+    if (f2 != NULL) fclose (f2) ;
+    return (same) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test43 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char cache [4096], name [256], defn [1024], source [4096], lib [4096],
+        kernel_name [4096], exported [4096], s [4096] ;
+    char record [ ] = "/tmp/GB_mex_test43_record.txt" ;
+    const char *folder = "/tmp/GB_mex_test43" ;
+    remove (record) ;
+
+    //--------------------------------------------------------------------------
+    // get/set GxB_JIT_RECORD_FILE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+    CHECK (strlen (s) == 0) ;
+
+    // with no kernels and no record file, there is nothing to export
+    OK (GxB_JIT_export (NULL, 0, NULL, folder)) ;
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, record,
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+    CHECK (strcmp (s, record) == 0) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_export (NULL, 0, NULL, NULL)) ;
+    ERR (GxB_JIT_export (NULL, 1, NULL, folder)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_JIT_export (NULL, 0, "/tmp/GB_mex_test43_nothing_here.txt",
+        folder)) ;
+
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    if (control != GxB_JIT_ON)
+    {
+        // the JIT cannot compile any kernels
+        OK (GrB_Global_set_String_ (GrB_GLOBAL, "",
+            (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+        printf ("JIT is not enabled; GxB_JIT_export not tested\n") ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test43:  all tests passed\n\n") ;
+        return ;
+    }
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, cache,
+        (GrB_Field) GxB_JIT_CACHE_PATH)) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel with a new user-defined operator, and record it
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    for (int64_t i = 0 ; i < 10 ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) i, i, i)) ;
+    }
+
+    // the operator has a new name in each run of this test, so its kernel is
+    // never already in the cache
+    snprintf (name, 256, "test43_add_%d", (int) getpid ( )) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test43_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (find_file (source, cache, name, ".c")) ;
+    CHECK (find_file (lib, cache, name, GB_LIB_SUFFIX)) ;
+    const char *p = strrchr (source, '/') + 1 ;
+    strncpy (kernel_name, p, 4096) ;
+    kernel_name [strlen (kernel_name) - 2] = '\0' ;
+    printf ("kernel: %s\n", kernel_name) ;
+
+    // the kernel is recorded once, when it is loaded
+    CHECK (file_count (record, kernel_name) == 1) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // export the recorded kernels
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_JIT_export (NULL, 0, NULL, "/tmp/GB_mex_test43_no/such/folder")) ;
+
+    mkdir (folder, 0777) ;
+    snprintf (exported, 4096, "%s/%s.c", folder, kernel_name) ;
+    remove (exported) ;
+    OK (GxB_JIT_export (NULL, 0, NULL, folder)) ;
+    CHECK (same_file (source, exported)) ;
+
+    // export it again, by its name; missing kernels are skipped
+    CHECK (remove (exported) == 0) ;
+    const char *kernels [2] ;
+    kernels [0] = "GB_jit__add__000bbb0bbb45__no_such_kernel" ;
+    kernels [1] = kernel_name ;
+    OK (GxB_JIT_export (kernels, 2, NULL, folder)) ;
+    CHECK (same_file (source, exported)) ;
+
+    //--------------------------------------------------------------------------
+    // compile the exported kernel with GxB_JIT_warmup
+    //--------------------------------------------------------------------------
+
+    // remove the kernel from the cache, and from the JIT hash table
+    CHECK (remove (lib) == 0) ;
+    CHECK (remove (source) == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    kernels [0] = exported ;
+    OK (GxB_JIT_warmup (kernels, 1, NULL, 1)) ;
+    CHECK (same_file (source, exported)) ;
+    struct stat st ;
+    CHECK (stat (lib, &st) == 0) ;
+
+    // the kernel is loaded, not compiled, when it is needed, and it is
+    // recorded again
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_LOAD,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 2) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    // no kernels are recorded once the record file is cleared
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "",
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 2) ;
+
+    remove (record) ;
+    remove (exported) ;
+    rmdir (folder) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test the sorted hash index of PreJIT kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// PreJIT kernels are registered in the JIT hash table the first time they are
+// needed.  The Tcov build has a PreJIT kernel for the my_rdiv operator (see
+// Tcov/PreJIT), so the operator can be created with a NULL function pointer
+// even if the JIT cannot load or compile any kernels.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/jitifyer/GB_jitifyer.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+// the definition of my_rdiv in Tcov/PreJIT/GB_jit__user_op__0__my_rdiv.c
+#define MY_RDIV                                                 \
+"void my_rdiv (double *z, const double *x, const double *y)\n"  \
+"{\n"                                                           \
+"    // escape this quote: \"\n"                                \
+"    /* escape this backslash \\ */\n"                          \
+"    /* modified for GrB 9.4.1 */\n"                            \
+"    (*z) = (*y) / (*x) ;\n"                                    \
+"}"
+
+//------------------------------------------------------------------------------
+// GB_mex_test44 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_BinaryOp op = NULL ;
+
+    //--------------------------------------------------------------------------
+    // check the index of PreJIT kernels
+    //--------------------------------------------------------------------------
+
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    uint64_t *Hashes = NULL ;
+    int32_t nkernels = 0 ;
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names, &Hashes) ;
+    printf ("PreJIT kernels: %d\n", nkernels) ;
+    bool have_rdiv = false ;
+
+    for (int k = 0 ; k < nkernels ; k++)
+    {
+        // the kernels are sorted by their hash
+        CHECK (Kernels [k] != NULL && Queries [k] != NULL && Names [k] != NULL);
+        if (k > 0) CHECK (Hashes [k-1] <= Hashes [k]) ;
+        // the hash of each kernel is the hash returned by its query
+        uint64_t hash = 0 ;
+        const char *ignored [5] ;
+        int version [3] ;
+        GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
+        (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
+        CHECK (Hashes [k] == 0 || Hashes [k] == hash) ;
+        if (strcmp (Names [k], "GB_jit__user_op__0__my_rdiv") == 0)
+        {
+            have_rdiv = true ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // use a PreJIT kernel when no other kernels can be loaded
+    //--------------------------------------------------------------------------
+
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    // clear the JIT hash table, and flag all PreJIT kernels as unchecked
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_RUN,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    if (have_rdiv)
+    {
+        // the function pointer comes from the PreJIT kernel
+        OK (GxB_BinaryOp_new (&op, NULL, GrB_FP64, GrB_FP64, GrB_FP64,
+            "my_rdiv", MY_RDIV)) ;
+        CHECK (op->binop_function != NULL) ;
+        double x = 4, y = 2, z = 0 ;
+        op->binop_function (&z, &x, &y) ;
+        CHECK (z == 0.5) ;
+        GrB_BinaryOp_free (&op) ;
+
+        // the kernel is already registered, and is found again
+        OK (GxB_BinaryOp_new (&op, NULL, GrB_FP64, GrB_FP64, GrB_FP64,
+            "my_rdiv", MY_RDIV)) ;
+        CHECK (op->binop_function != NULL) ;
+        GrB_BinaryOp_free (&op) ;
+    }
+    else
+    {
+        printf ("PreJIT my_rdiv kernel not found\n") ;
+    }
+
+    // no PreJIT kernel has the hash of this operator
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_BinaryOp_new (&op, NULL, GrB_FP64, GrB_FP64, GrB_FP64,
+        "my_rdiv44", "void my_rdiv44 (double *z, const double *x, "
+        "const double *y) { (*z) = (*y) / (*x) ; }")) ;
+    CHECK (op == NULL) ;
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44:  all tests passed\n\n") ;
+}
+
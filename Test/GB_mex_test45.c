@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test the cpu and compiler fingerprint of the JIT lib folder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compiled kernels are placed in [cache_path]/lib/[fingerprint]/[bucket].
+// Changing the C flags changes the fingerprint, so a kernel compiled with
+// other flags is not loaded; it is compiled again in another lib folder.
+// Kernels are found when they are loaded with the JIT record file.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <ctype.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+//------------------------------------------------------------------------------
+// find_file: find a file in the JIT cache for a given operator
+//------------------------------------------------------------------------------
+
+// The kernel name includes the name of its user-defined operator, so the cache
+// is searched for a file whose name contains the operator name and ends with
+// the given suffix.  Its path is returned in path, if found.  The file given
+// by skip (if not NULL) is not returned.
+
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix, const char *skip) ;
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix, const char *skip)
+{
+    DIR *dir = opendir (folder) ;
+    if (dir == NULL) return (false) ;
+    bool found = false ;
+    struct dirent *entry ;
+    size_t slen = strlen (suffix) ;
+    while (!found && (entry = readdir (dir)) != NULL)
+    {
+        const char *file = entry->d_name ;
+        if (file [0] == '.') continue ;
+        snprintf (path, 4096, "%s/%s", folder, file) ;
+        struct stat st ;
+        if (stat (path, &st) != 0) continue ;
+        if (S_ISDIR (st.st_mode))
+        {
+            // search the subfolders (lib, c, and their buckets)
+            char subfolder [4096] ;
+            strncpy (subfolder, path, 4096) ;
+            found = find_file (path, subfolder, name, suffix, skip) ;
+        }
+        else
+        {
+            size_t len = strlen (file) ;
+            found = (strstr (file, name) != NULL && len >= slen &&
+                strcmp (file + len - slen, suffix) == 0 &&
+                (skip == NULL || strcmp (path, skip) != 0)) ;
+        }
+    }
+    closedir (dir) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// get_fingerprint: get the fingerprint from the path of a compiled kernel
+//------------------------------------------------------------------------------
+
+bool get_fingerprint (char *fingerprint, const char *lib) ;
+bool get_fingerprint (char *fingerprint, const char *lib)
+{
+    // the path is [cache_path]/lib/[fingerprint]/[bucket]/lib[kernel].so
+    const char *p = strstr (lib, "/lib/") ;
+    if (p == NULL) return (false) ;
+    p += 5 ;
+    for (int k = 0 ; k < 16 ; k++)
+    {
+        if (!isxdigit ((unsigned char) p [k])) return (false) ;
+        fingerprint [k] = p [k] ;
+    }
+    fingerprint [16] = '\0' ;
+    return (p [16] == '/') ;
+}
+
+//------------------------------------------------------------------------------
+// file_count: count the lines in a file that are equal to a given string
+//------------------------------------------------------------------------------
+
+int file_count (const char *filename, const char *s) ;
+int file_count (const char *filename, const char *s)
+{
+    FILE *fp = fopen (filename, "r") ;
+    if (fp == NULL) return (0) ;
+    int count = 0 ;
+    char line [4096] ;
+    while (fgets (line, 4096, fp) != NULL)
+    {
+        line [strcspn (line, "\n")] = '\0' ;
+        if (strcmp (line, s) == 0) count++ ;
+    }
+    fclose (fp) ;
+    return (count) ;
+}
+
+//------------------------------------------------------------------------------
+// test45_add: the operator, z = x+y+1
+//------------------------------------------------------------------------------
+
+void test45_add (double *z, const double *x, const double *y) ;
+void test45_add (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) + 1 ;
+}
+
+//------------------------------------------------------------------------------
+// check_add: C = A+A with the operator, and check the result
+//------------------------------------------------------------------------------
+
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op) ;
+GrB_Info check_add (GrB_Matrix C, GrB_Matrix A, GrB_BinaryOp op)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, op, A, A, NULL)) ;
+    GrB_Index n = 0 ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        double c = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c, C, i, i)) ;
+        CHECK (c == 2*i + 1) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test45 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char cache [4096], name [256], defn [1024], source [4096], lib1 [4096],
+        lib2 [4096], kernel_name [4096], flags [4096], flags2 [4200],
+        fingerprint1 [17], fingerprint2 [17] ;
+    char record [ ] = "/tmp/GB_mex_test45_record.txt" ;
+    remove (record) ;
+
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    if (control != GxB_JIT_ON)
+    {
+        // the JIT cannot compile any kernels
+        printf ("JIT is not enabled; lib folder fingerprint not tested\n") ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test45:  all tests passed\n\n") ;
+        return ;
+    }
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, cache,
+        (GrB_Field) GxB_JIT_CACHE_PATH)) ;
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, flags,
+        (GrB_Field) GxB_JIT_C_COMPILER_FLAGS)) ;
+    snprintf (flags2, 4200, "%s -DGB_MEX_TEST45", flags) ;
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, record,
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel with a new user-defined operator
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    for (int64_t i = 0 ; i < 10 ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) i, i, i)) ;
+    }
+
+    // the operator has a new name in each run of this test, so its kernel is
+    // never already in the cache
+    snprintf (name, 256, "test45_add_%d", (int) getpid ( )) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) + 1 ; }", name) ;
+    OK (GxB_BinaryOp_new (&op, (GxB_binary_function) test45_add,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (find_file (source, cache, name, ".c", NULL)) ;
+    CHECK (find_file (lib1, cache, name, GB_LIB_SUFFIX, NULL)) ;
+    CHECK (get_fingerprint (fingerprint1, lib1)) ;
+    const char *p = strrchr (source, '/') + 1 ;
+    strncpy (kernel_name, p, 4096) ;
+    kernel_name [strlen (kernel_name) - 2] = '\0' ;
+    printf ("kernel: %s\nlib folder: %s\n", kernel_name, fingerprint1) ;
+    CHECK (file_count (record, kernel_name) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // change the C flags, which changes the fingerprint
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, flags2,
+        (GrB_Field) GxB_JIT_C_COMPILER_FLAGS)) ;
+
+    // clear the JIT hash table; the kernel compiled with the old flags is not
+    // loaded with the new flags
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_LOAD,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 1) ;
+
+    // the kernel is compiled again, in a new lib folder
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 2) ;
+    CHECK (find_file (lib2, cache, name, GB_LIB_SUFFIX, lib1)) ;
+    CHECK (get_fingerprint (fingerprint2, lib2)) ;
+    printf ("lib folder: %s\n", fingerprint2) ;
+    CHECK (strcmp (fingerprint1, fingerprint2) != 0) ;
+    struct stat st ;
+    CHECK (stat (lib1, &st) == 0) ;
+
+    //--------------------------------------------------------------------------
+    // restore the C flags, and load the kernel from the first lib folder
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, flags,
+        (GrB_Field) GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (remove (lib2) == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_LOAD,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_add (C, A, op)) ;
+    CHECK (file_count (record, kernel_name) == 3) ;
+
+    OK (GrB_Global_set_String_ (GrB_GLOBAL, "",
+        (GrB_Field) GxB_JIT_RECORD_FILE)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    remove (record) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45:  all tests passed\n\n") ;
+}
+
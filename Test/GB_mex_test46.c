@@ -0,0 +1,266 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test GxB_JIT_TUNE_REDUCE_PANEL
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A reduce-to-scalar JIT kernel is tuned the first time it is used on a
+// problem large enough to be timed.  Each monoid has a new name in each run
+// of this test, so its kernel is never already in the cache, or tuned.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Vector_free (&V) ;              \
+    GrB_Vector_free (&S) ;              \
+    GrB_Monoid_free (&monoid) ;         \
+    GrB_BinaryOp_free (&op) ;           \
+}
+
+//------------------------------------------------------------------------------
+// find_file: find a file in the JIT cache for a given operator
+//------------------------------------------------------------------------------
+
+// The kernel name includes the name of its user-defined operator, so the cache
+// is searched for a file whose name contains the operator name and ends with
+// the given suffix.  Its path is returned in path, if found.
+
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix) ;
+bool find_file (char *path, const char *folder, const char *name,
+    const char *suffix)
+{
+    DIR *dir = opendir (folder) ;
+    if (dir == NULL) return (false) ;
+    bool found = false ;
+    struct dirent *entry ;
+    size_t slen = strlen (suffix) ;
+    while (!found && (entry = readdir (dir)) != NULL)
+    {
+        const char *file = entry->d_name ;
+        if (file [0] == '.') continue ;
+        snprintf (path, 4096, "%s/%s", folder, file) ;
+        struct stat st ;
+        if (stat (path, &st) != 0) continue ;
+        if (S_ISDIR (st.st_mode))
+        {
+            // search the subfolders (lib, c, and their buckets)
+            char subfolder [4096] ;
+            strncpy (subfolder, path, 4096) ;
+            found = find_file (path, subfolder, name, suffix) ;
+        }
+        else
+        {
+            size_t len = strlen (file) ;
+            found = (strstr (file, name) != NULL && len >= slen &&
+                strcmp (file + len - slen, suffix) == 0) ;
+        }
+    }
+    closedir (dir) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// test46_plus: the operator, z = x+y
+//------------------------------------------------------------------------------
+
+void test46_plus (double *z, const double *x, const double *y) ;
+void test46_plus (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) + (*y) ;
+}
+
+//------------------------------------------------------------------------------
+// new_monoid: create a new monoid, with a new name
+//------------------------------------------------------------------------------
+
+GrB_Info new_monoid (GrB_Monoid *monoid, GrB_BinaryOp *op, char *name,
+    const char *kind) ;
+GrB_Info new_monoid (GrB_Monoid *monoid, GrB_BinaryOp *op, char *name,
+    const char *kind)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    char defn [1024] ;
+    snprintf (name, 256, "test46_%s_%d", kind, (int) getpid ( )) ;
+    snprintf (defn, 1024, "void %s (double *z, const double *x, "
+        "const double *y) { (*z) = (*x) + (*y) ; }", name) ;
+    OK (GxB_BinaryOp_new (op, (GxB_binary_function) test46_plus,
+        GrB_FP64, GrB_FP64, GrB_FP64, name, defn)) ;
+    OK (GrB_Monoid_new_FP64 (monoid, *op, (double) 0)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// check_sum: s = sum (V) with the monoid, and check the result
+//------------------------------------------------------------------------------
+
+// V(i) = i for all i, so the result is exact for any order of summation.
+
+GrB_Info check_sum (GrB_Vector V, GrB_Monoid monoid) ;
+GrB_Info check_sum (GrB_Vector V, GrB_Monoid monoid)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, V)) ;
+    double s = -1 ;
+    OK (GrB_Vector_reduce_FP64 (&s, NULL, monoid, V, NULL)) ;
+    CHECK (s == ((double) n) * ((double) (n-1)) / 2) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test46 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Vector V = NULL, S = NULL ;
+    GrB_Monoid monoid = NULL ;
+    GrB_BinaryOp op = NULL ;
+    char cache [4096], name [256], path [4096], line [256] ;
+
+    //--------------------------------------------------------------------------
+    // get/set GxB_JIT_TUNE_REDUCE_PANEL
+    //--------------------------------------------------------------------------
+
+    int32_t tune = -1, control = -1, nthreads = 0 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &tune,
+        (GrB_Field) GxB_JIT_TUNE_REDUCE_PANEL)) ;
+    CHECK (tune == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true,
+        (GrB_Field) GxB_JIT_TUNE_REDUCE_PANEL)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &tune,
+        (GrB_Field) GxB_JIT_TUNE_REDUCE_PANEL)) ;
+    CHECK (tune == 1) ;
+
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    if (control != GxB_JIT_ON)
+    {
+        // the JIT cannot compile any kernels
+        printf ("JIT is not enabled; GxB_JIT_TUNE_REDUCE_PANEL not tested\n") ;
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+            (GrB_Field) GxB_JIT_TUNE_REDUCE_PANEL)) ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test46:  all tests passed\n\n") ;
+        return ;
+    }
+    OK (GrB_Global_get_String_ (GrB_GLOBAL, cache,
+        (GrB_Field) GxB_JIT_CACHE_PATH)) ;
+
+    // a single thread, so the kernel takes long enough to be timed
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &nthreads,
+        (GrB_Field) GxB_NTHREADS)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, 1, (GrB_Field) GxB_NTHREADS)) ;
+
+    // V(i) = i, and S(i) = i for a short vector
+    GrB_Index n = 8 * 1024 * 1024 ;
+    OK (GrB_Vector_new (&V, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (V, NULL, NULL, 1, GrB_ALL, n, NULL)) ;
+    OK (GrB_Vector_apply_IndexOp_INT64 (V, NULL, NULL, GrB_ROWINDEX_INT64, V,
+        0, NULL)) ;
+    OK (GrB_Vector_new (&S, GrB_FP64, 100)) ;
+    OK (GrB_Vector_assign_FP64 (S, NULL, NULL, 1, GrB_ALL, 100, NULL)) ;
+    OK (GrB_Vector_apply_IndexOp_INT64 (S, NULL, NULL, GrB_ROWINDEX_INT64, S,
+        0, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // a small problem is not tuned
+    //--------------------------------------------------------------------------
+
+    OK (new_monoid (&monoid, &op, name, "small")) ;
+    OK (check_sum (S, monoid)) ;
+    CHECK (find_file (path, cache, name, GB_LIB_SUFFIX)) ;
+    CHECK (!find_file (path, cache, name, ".tune")) ;
+    GrB_Monoid_free (&monoid) ;
+    GrB_BinaryOp_free (&op) ;
+
+    //--------------------------------------------------------------------------
+    // tune a kernel
+    //--------------------------------------------------------------------------
+
+    OK (new_monoid (&monoid, &op, name, "big")) ;
+    OK (check_sum (V, monoid)) ;
+    CHECK (find_file (path, cache, name, GB_LIB_SUFFIX)) ;
+    CHECK (find_file (path, cache, name, ".tune")) ;
+    printf ("tune file: %s\n", path) ;
+
+    // the tune file holds the result
+    FILE *fp = fopen (path, "r") ;
+    CHECK (fp != NULL) ;
+    CHECK (fgets (line, 256, fp) != NULL) ;
+    fclose (fp) ;
+    printf ("tuned: %s", line) ;
+    CHECK (strncmp (line, "GB_PANEL ", 9) == 0) ;
+
+    // the variants are removed
+    char variant [512] ;
+    snprintf (variant, 512, "%s__tune", name) ;
+    CHECK (!find_file (path, cache, variant, GB_LIB_SUFFIX)) ;
+    CHECK (!find_file (path, cache, variant, ".c")) ;
+
+    // the kernel is not tuned again
+    CHECK (find_file (path, cache, name, ".tune")) ;
+    struct stat st1, st2 ;
+    CHECK (stat (path, &st1) == 0) ;
+    OK (check_sum (V, monoid)) ;
+    OK (check_sum (S, monoid)) ;
+    CHECK (stat (path, &st2) == 0) ;
+    CHECK (st1.st_mtime == st2.st_mtime && st1.st_ino == st2.st_ino) ;
+
+    // the tuned kernel is loaded by a later process, and is not tuned again
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_OFF,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, GxB_JIT_ON,
+        (GrB_Field) GxB_JIT_C_CONTROL)) ;
+    OK (check_sum (V, monoid)) ;
+    CHECK (stat (path, &st2) == 0) ;
+    CHECK (st1.st_mtime == st2.st_mtime && st1.st_ino == st2.st_ino) ;
+    GrB_Monoid_free (&monoid) ;
+    GrB_BinaryOp_free (&op) ;
+
+    //--------------------------------------------------------------------------
+    // no kernel is tuned if GxB_JIT_TUNE_REDUCE_PANEL is false
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+        (GrB_Field) GxB_JIT_TUNE_REDUCE_PANEL)) ;
+    OK (new_monoid (&monoid, &op, name, "off")) ;
+    OK (check_sum (V, monoid)) ;
+    CHECK (find_file (path, cache, name, GB_LIB_SUFFIX)) ;
+    CHECK (!find_file (path, cache, name, ".tune")) ;
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, nthreads,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test the memory pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The memory pool is not used when malloc tracking is enabled, so most of
+// these tests are done with malloc tracking turned off.  All objects created
+// while it is off are freed before it is turned back on.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Scalar_free (&s) ;              \
+}
+
+//------------------------------------------------------------------------------
+// get_stats: get the memory pool statistics
+//------------------------------------------------------------------------------
+
+GrB_Info get_stats (int64_t *stats) ;
+GrB_Info get_stats (int64_t *stats)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Global_get_VOID_ (GrB_GLOBAL, (void *) stats,
+        (GrB_Field) GxB_MEMORY_POOL_STATS)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test47 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_Scalar s = NULL ;
+    int64_t limits [GxB_NMEMORY_POOL], limits2 [GxB_NMEMORY_POOL] ;
+    int64_t stats [GxB_NMEMORY_POOL_STATS] ;
+    void *p [8] ;
+    size_t nbytes [8] ;
+
+    //--------------------------------------------------------------------------
+    // get/set the memory pool controls
+    //--------------------------------------------------------------------------
+
+    int32_t control = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_MEMORY_POOL_CONTROL)) ;
+    CHECK (control == 0) ;
+
+    size_t size = 0 ;
+    OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS)) ;
+    CHECK (size == sizeof (int64_t) * GxB_NMEMORY_POOL) ;
+    OK (GrB_Global_get_SIZE_ (GrB_GLOBAL, &size,
+        (GrB_Field) GxB_MEMORY_POOL_STATS)) ;
+    CHECK (size == sizeof (int64_t) * GxB_NMEMORY_POOL_STATS) ;
+
+    // default limits: none below 8 bytes or at 1MB and above
+    OK (GrB_Global_get_VOID_ (GrB_GLOBAL, (void *) limits,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS)) ;
+    for (int k = 0 ; k < GxB_NMEMORY_POOL ; k++)
+    {
+        CHECK ((limits [k] > 0) == (k >= 3 && k < 20)) ;
+    }
+    CHECK (limits [3] == 16384 && limits [19] == 8) ;
+
+    // the limits array must be large enough
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) limits,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, sizeof (int64_t))) ;
+
+    // limits below 8 bytes are ignored, and negative limits are zero
+    for (int k = 0 ; k < GxB_NMEMORY_POOL ; k++) limits2 [k] = k ;
+    limits2 [4] = -1 ;
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) limits2,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, sizeof (limits2))) ;
+    OK (GrB_Global_get_VOID_ (GrB_GLOBAL, (void *) limits2,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS)) ;
+    for (int k = 0 ; k < GxB_NMEMORY_POOL ; k++)
+    {
+        CHECK (limits2 [k] == ((k < 3 || k == 4) ? 0 : k)) ;
+    }
+
+    // restore the default limits
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, 0)) ;
+    OK (GrB_Global_get_VOID_ (GrB_GLOBAL, (void *) limits2,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS)) ;
+    for (int k = 0 ; k < GxB_NMEMORY_POOL ; k++)
+    {
+        CHECK (limits2 [k] == limits [k]) ;
+    }
+
+    // max # of bytes in the pool: 64MB by default
+    int64_t max_bytes = -1 ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Global_get_Scalar_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_MEMORY_POOL_MAX_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&max_bytes, s)) ;
+    CHECK (max_bytes == 64 * 1024 * 1024) ;
+    OK (GrB_Scalar_free (&s)) ;
+
+    //--------------------------------------------------------------------------
+    // the pool is not used when malloc tracking is enabled
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true,
+        (GrB_Field) GxB_MEMORY_POOL_CONTROL)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control,
+        (GrB_Field) GxB_MEMORY_POOL_CONTROL)) ;
+    CHECK (control == 1) ;
+    bool tracking = GB_Global_malloc_tracking_get ( ) ;
+    if (tracking)
+    {
+        OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+            (GrB_Field) GxB_MEMORY_POOL_STATS, 0)) ;
+        p [0] = GB_malloc_memory (100, 1, &(nbytes [0])) ;
+        CHECK (p [0] != NULL && nbytes [0] == 100) ;
+        GB_free_memory (&(p [0]), nbytes [0]) ;
+        OK (get_stats (stats)) ;
+        CHECK (stats [0] == 0 && stats [1] == 0 && stats [2] == 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // reuse blocks from the pool
+    //--------------------------------------------------------------------------
+
+    GB_Global_malloc_tracking_set (false) ;
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_STATS, 0)) ;
+
+    // the block is rounded up to a power of two, and kept when freed
+    p [0] = GB_malloc_memory (100, 1, &(nbytes [0])) ;
+    CHECK (p [0] != NULL && nbytes [0] == 128) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [0] == 0 && stats [1] == 1) ;
+    void *p0 = p [0] ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 1 && stats [3] == 128) ;
+
+    // the same block is used again
+    p [0] = GB_calloc_memory (120, 1, &(nbytes [0])) ;
+    CHECK (p [0] == p0 && nbytes [0] == 128) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [0] == 1 && stats [1] == 1) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+    for (int k = 0 ; k < 120 ; k++) CHECK (((uint8_t *) p [0]) [k] == 0) ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+
+    // a large block is not rounded, and bypasses the pool
+    p [0] = GB_malloc_memory (3 * 1024 * 1024, 1, &(nbytes [0])) ;
+    CHECK (p [0] != NULL && nbytes [0] == 3 * 1024 * 1024) ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [0] == 1 && stats [1] == 1 && stats [2] == 1) ;
+
+    // clear the hit and miss counts
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_STATS, 0)) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [0] == 0 && stats [1] == 0 && stats [2] == 1) ;
+
+    //--------------------------------------------------------------------------
+    // limit the # of blocks of each size
+    //--------------------------------------------------------------------------
+
+    // Blocks of 64KB are not held in the per-thread caches, so at most
+    // limits [16] of them are kept.  Changing the limits flushes the pool.
+    memcpy (limits2, limits, sizeof (limits)) ;
+    limits2 [16] = 2 ;
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) limits2,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, sizeof (limits2))) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        p [k] = GB_malloc_memory (40000, 1, &(nbytes [k])) ;
+        CHECK (p [k] != NULL && nbytes [k] == 65536) ;
+    }
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_free_memory (&(p [k]), nbytes [k]) ;
+    }
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 2 && stats [3] == 2 * 65536) ;
+
+    // with a limit of zero, the size is not rounded
+    limits2 [16] = 0 ;
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) limits2,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, sizeof (limits2))) ;
+    p [0] = GB_malloc_memory (40000, 1, &(nbytes [0])) ;
+    CHECK (p [0] != NULL && nbytes [0] == 40000) ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+
+    //--------------------------------------------------------------------------
+    // limit the total size of the pool
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_LIMITS, 0)) ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Scalar_setElement_INT64 (s, 200 * 1024)) ;
+    OK (GrB_Global_set_Scalar_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_MEMORY_POOL_MAX_BYTES)) ;
+    OK (GrB_Scalar_clear (s)) ;
+    OK (GrB_Global_get_Scalar_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_MEMORY_POOL_MAX_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&max_bytes, s)) ;
+    CHECK (max_bytes == 200 * 1024) ;
+    int64_t stats0 [GxB_NMEMORY_POOL_STATS] ;
+    OK (get_stats (stats0)) ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        p [k] = GB_malloc_memory (65536, 1, &(nbytes [k])) ;
+        CHECK (p [k] != NULL && nbytes [k] == 65536) ;
+    }
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_free_memory (&(p [k]), nbytes [k]) ;
+    }
+    // only 3 blocks fit in 200KB, with the small blocks already in the pool
+    OK (get_stats (stats)) ;
+    CHECK (stats0 [3] < 200 * 1024 - 3 * 65536) ;
+    CHECK (stats [2] - stats0 [2] == 3) ;
+    CHECK (stats [3] - stats0 [3] == 3 * 65536) ;
+
+    // a negative value restores the default, and flushes the pool
+    OK (GrB_Scalar_setElement_INT64 (s, -1)) ;
+    OK (GrB_Global_set_Scalar_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_MEMORY_POOL_MAX_BYTES)) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+    OK (GrB_Global_get_Scalar_ (GrB_GLOBAL, s,
+        (GrB_Field) GxB_MEMORY_POOL_MAX_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&max_bytes, s)) ;
+    CHECK (max_bytes == 64 * 1024 * 1024) ;
+    OK (GrB_Scalar_free (&s)) ;
+
+    //--------------------------------------------------------------------------
+    // blocks imported from the application are not kept
+    //--------------------------------------------------------------------------
+
+    // x is 8KB, so if it were kept, it would be the only block of its size
+    OK (GrB_Vector_new (&v, GrB_FP64, 1024)) ;
+    double *x = GB_Global_malloc_function (1024 * sizeof (double)) ;
+    CHECK (x != NULL) ;
+    for (int k = 0 ; k < 1024 ; k++) x [k] = k ;
+    OK (GxB_Vector_pack_Full (v, (void **) &x, 1024 * sizeof (double), false,
+        NULL)) ;
+    CHECK (x == NULL) ;
+    OK (GrB_Vector_free (&v)) ;
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_STATS, 0)) ;
+    p [0] = GB_malloc_memory (8192, 1, &(nbytes [0])) ;
+    CHECK (p [0] != NULL && nbytes [0] == 8192) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [0] == 0 && stats [1] == 1) ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+
+    //--------------------------------------------------------------------------
+    // use the pool for GraphBLAS operations
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_VOID_ (GrB_GLOBAL, NULL,
+        (GrB_Field) GxB_MEMORY_POOL_STATS, 0)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    for (int64_t i = 0 ; i < 100 ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, 1, i, i)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, i, (i+1) % 100)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    for (int trial = 0 ; trial < 20 ; trial++)
+    {
+        OK (GrB_Matrix_new (&C, GrB_FP64, 100, 100)) ;
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+            NULL)) ;
+        GrB_Index nvals = 0 ;
+        OK (GrB_Matrix_nvals (&nvals, C)) ;
+        CHECK (nvals == 300) ;
+        double c = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c, C, 7, 8)) ;
+        CHECK (c == 2) ;
+        OK (GrB_Matrix_free (&C)) ;
+    }
+    OK (GrB_Matrix_free (&A)) ;
+    OK (get_stats (stats)) ;
+    printf ("pool: hits %g misses %g blocks %g bytes %g\n",
+        (double) stats [0], (double) stats [1], (double) stats [2],
+        (double) stats [3]) ;
+    CHECK (stats [0] > stats [1]) ;
+    CHECK (stats [2] > 0 && stats [3] > 0) ;
+
+    //--------------------------------------------------------------------------
+    // disabling the pool flushes it
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+        (GrB_Field) GxB_MEMORY_POOL_CONTROL)) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+    p [0] = GB_malloc_memory (100, 1, &(nbytes [0])) ;
+    CHECK (p [0] != NULL && nbytes [0] == 100) ;
+    GB_free_memory (&(p [0]), nbytes [0]) ;
+    OK (get_stats (stats)) ;
+    CHECK (stats [2] == 0 && stats [3] == 0) ;
+    GB_Global_malloc_tracking_set (tracking) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test the saxpy3 workspace kept in a GxB_Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/mxm/GB_AxB_saxpy3.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&C0) ;             \
+    GrB_Descriptor_free (&desc) ;       \
+    GxB_Context_free (&Context) ;       \
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse INT64 matrix
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index m, GrB_Index n, int64_t nz) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index m, GrB_Index n, int64_t nz)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_INT64, m, n)) ;
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % m ;
+        GrB_Index j = simple_rand_i ( ) % n ;
+        int64_t x = (int64_t) (simple_rand_i ( ) % 7) + 1 ;
+        OK (GrB_Matrix_setElement_INT64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test48 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C = NULL, C0 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GxB_Context Context = NULL ;
+    GrB_Semiring semiring = GrB_PLUS_TIMES_SEMIRING_INT64 ;
+    const GrB_Index n = 2000 ;
+
+    //--------------------------------------------------------------------------
+    // create a Context that keeps the saxpy3 workspace
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_new (&Context)) ;
+    int32_t keep = -1 ;
+    OK (GxB_Context_get_INT_ (Context, &keep, GxB_MXM_WORKSPACE)) ;
+    CHECK (keep == 0) ;
+    OK (GxB_Context_set_INT_ (Context, true, GxB_MXM_WORKSPACE)) ;
+    OK (GxB_Context_get_INT_ (Context, &keep, GxB_MXM_WORKSPACE)) ;
+    CHECK (keep == 1) ;
+    CHECK (Context->mxm_werk == NULL) ;
+
+    // GxB_CONTEXT_WORLD keeps no workspace
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set_INT_ (GxB_CONTEXT_WORLD, true, GxB_MXM_WORKSPACE)) ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (random_matrix (&A, n, n, 4*n)) ;
+
+    //--------------------------------------------------------------------------
+    // C=B*A with the workspace kept across calls
+    //--------------------------------------------------------------------------
+
+    // B has 1 to 200 rows, so the workspace grows and shrinks, and the tasks
+    // are fine (for a few costly rows and many threads) or coarse.  A tiny
+    // chunk size ensures that small problems use all threads.
+    OK (GxB_Context_set_FP64 (Context, GxB_CONTEXT_CHUNK, 1)) ;
+
+    int64_t nrows_list [ ] = { 1, 200, 4, 1, 50, 2, 200, 1 } ;
+    int64_t mark = 0 ;
+    int32_t nthreads_save = 0 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GxB_Context_set_INT_ (Context, nthreads, GxB_NTHREADS)) ;
+        for (int method = 0 ; method <= 1 ; method++)
+        {
+            OK (GrB_Descriptor_set_INT32 (desc,
+                (method == 0) ? GxB_AxB_HASH : GxB_AxB_GUSTAVSON,
+                (GrB_Field) GxB_AxB_METHOD)) ;
+            for (int mask = 0 ; mask <= 2 ; mask++)
+            {
+                // mask 0: none, 1: structural M, 2: structural !M
+                OK (GrB_Descriptor_set_INT32 (desc,
+                    (mask == 1) ? GrB_STRUCTURE :
+                    (mask == 2) ? GrB_COMP_STRUCTURE : GrB_DEFAULT,
+                    GrB_MASK)) ;
+                for (int trial = 0 ; trial < 8 ; trial++)
+                {
+                    int64_t nrows = nrows_list [trial] ;
+                    // a few costly rows of B are done by fine tasks
+                    int64_t bnz = (nrows <= 4) ? (200 * nrows) :
+                        (2 * nrows + trial * 50) ;
+                    OK (random_matrix (&B, nrows, n, bnz)) ;
+                    OK (GrB_Matrix_set_INT32 (B, GxB_SPARSE,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    if (mask > 0)
+                    {
+                        OK (random_matrix (&M, nrows, n, 100*nrows)) ;
+                    }
+                    OK (GrB_Matrix_new (&C, GrB_INT64, nrows, n)) ;
+                    OK (GrB_Matrix_new (&C0, GrB_INT64, nrows, n)) ;
+
+                    // C0 = B*A without the Context
+                    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, nthreads,
+                        (GrB_Field) GxB_NTHREADS)) ;
+                    OK (GrB_mxm (C0, M, NULL, semiring, B, A, desc)) ;
+
+                    // C = B*A with the Context engaged
+                    OK (GxB_Context_engage (Context)) ;
+                    OK (GrB_mxm (C, M, NULL, semiring, B, A, desc)) ;
+                    OK (GxB_Context_disengage (Context)) ;
+                    // C and C0 may be jumbled in different orders
+                    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                    OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+                    CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+                    // the workspace is kept, and its mark never decreases
+                    struct GB_saxpy3_werk_struct *werk = Context->mxm_werk ;
+                    if (werk != NULL)
+                    {
+                        CHECK (werk->mark >= mark) ;
+                        mark = werk->mark ;
+                    }
+
+                    GrB_Matrix_free (&B) ;
+                    GrB_Matrix_free (&M) ;
+                    GrB_Matrix_free (&C) ;
+                    GrB_Matrix_free (&C0) ;
+                }
+            }
+        }
+    }
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    // the workspace has been used by both fine and coarse tasks
+    CHECK (Context->mxm_werk != NULL) ;
+    struct GB_saxpy3_werk_struct *werk = Context->mxm_werk ;
+    printf ("workspace: Hf fine %g, Hf coarse %g, Hi %g, Hx %g bytes, "
+        "mark %g\n", (double) werk->Hf_fine_size,
+        (double) werk->Hf_coarse_size, (double) werk->Hi_size,
+        (double) werk->Hx_size, (double) werk->mark) ;
+    CHECK (werk->Hf_fine_size > 0 && werk->Hf_coarse_size > 0) ;
+    CHECK (werk->mark > 0) ;
+
+    //--------------------------------------------------------------------------
+    // a kept Hf_coarse is reused, not reallocated
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&B, 200, n, 400)) ;
+    OK (GrB_Matrix_new (&C, GrB_INT64, 200, n)) ;
+    OK (GrB_Matrix_new (&C0, GrB_INT64, 200, n)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_GUSTAVSON,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_DEFAULT, GrB_MASK)) ;
+    OK (GrB_mxm (C0, NULL, NULL, semiring, B, A, desc)) ;
+    OK (GxB_Context_set_INT_ (Context, 1, GxB_NTHREADS)) ;
+    OK (GxB_Context_engage (Context)) ;
+    OK (GrB_mxm (C, NULL, NULL, semiring, B, A, desc)) ;
+    int64_t *Hf_coarse = werk->Hf_coarse ;
+    mark = werk->mark ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        OK (GrB_Matrix_clear (C)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring, B, A, desc)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        CHECK (werk->Hf_coarse == Hf_coarse && werk->mark > mark) ;
+        mark = werk->mark ;
+    }
+    OK (GxB_Context_disengage (Context)) ;
+
+    //--------------------------------------------------------------------------
+    // the workspace is freed when it is no longer kept
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_set_INT_ (Context, false, GxB_MXM_WORKSPACE)) ;
+    CHECK (Context->mxm_werk == NULL) ;
+    OK (GxB_Context_engage (Context)) ;
+    OK (GrB_Matrix_clear (C)) ;
+    OK (GrB_mxm (C, NULL, NULL, semiring, B, A, desc)) ;
+    OK (GxB_Context_disengage (Context)) ;
+    CHECK (GB_mx_isequal (C, C0, 0)) ;
+    CHECK (Context->mxm_werk == NULL) ;
+
+    // a Context is freed with its workspace
+    OK (GxB_Context_set_INT_ (Context, true, GxB_MXM_WORKSPACE)) ;
+    OK (GxB_Context_engage (Context)) ;
+    OK (GrB_mxm (C, NULL, NULL, semiring, B, A, desc)) ;
+    OK (GxB_Context_disengage (Context)) ;
+    CHECK (Context->mxm_werk != NULL) ;
+    OK (GxB_Context_free (&Context)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48:  all tests passed\n\n") ;
+}
+
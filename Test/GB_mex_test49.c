@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test GxB_NUMA_FIRST_TOUCH
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GxB_Context_free (&Context) ;       \
+    if (X != NULL) free (X) ;           \
+    X = NULL ;                          \
+    if (I != NULL) free (I) ;           \
+    I = NULL ;                          \
+    if (J != NULL) free (J) ;           \
+    J = NULL ;                          \
+}
+
+#define PAGE 4096
+#define GUARD 64
+
+//------------------------------------------------------------------------------
+// check_touch: check the result of GB_memory_first_touch
+//------------------------------------------------------------------------------
+
+// The block P [0:size-1] starts at an offset into a buffer filled with 0xFF,
+// with GUARD bytes on either side.
+
+bool check_touch (GB_void *P, size_t size, bool clear) ;
+bool check_touch (GB_void *P, size_t size, bool clear)
+{
+    // the bytes outside of the block are not modified
+    for (int64_t k = 1 ; k <= GUARD ; k++)
+    {
+        if (P [-k] != 0xFF || P [size-1+k] != 0xFF) return (false) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) size ; k++)
+    {
+        // the first byte and the first byte of each page are set to zero;
+        // the rest are set to zero only if the block is cleared
+        bool page_start = (k == 0) || (((uintptr_t) (P + k)) % PAGE == 0) ;
+        GB_void expected = (clear || page_start) ? 0 : 0xFF ;
+        if (P [k] != expected) return (false) ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test49 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GxB_Context Context = NULL ;
+    GB_void *X = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+
+    //--------------------------------------------------------------------------
+    // get/set the global and Context settings
+    //--------------------------------------------------------------------------
+
+    int32_t touch = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &touch,
+        (GrB_Field) GxB_NUMA_FIRST_TOUCH)) ;
+    CHECK (touch == 0) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true,
+        (GrB_Field) GxB_NUMA_FIRST_TOUCH)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &touch,
+        (GrB_Field) GxB_NUMA_FIRST_TOUCH)) ;
+    CHECK (touch == 1) ;
+    CHECK (GB_Context_numa_first_touch ( )) ;
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+        (GrB_Field) GxB_NUMA_FIRST_TOUCH)) ;
+    CHECK (!GB_Context_numa_first_touch ( )) ;
+
+    OK (GxB_Context_new (&Context)) ;
+    OK (GxB_Context_get_INT_ (Context, &touch, GxB_NUMA_FIRST_TOUCH)) ;
+    CHECK (touch == 0) ;
+    OK (GxB_Context_set_INT_ (Context, true, GxB_NUMA_FIRST_TOUCH)) ;
+    OK (GxB_Context_get_INT_ (Context, &touch, GxB_NUMA_FIRST_TOUCH)) ;
+    CHECK (touch == 1) ;
+    OK (GxB_Context_fprint (Context, "Context", GxB_COMPLETE, stdout)) ;
+
+    // the setting of the engaged Context is used, not the global one
+    OK (GxB_Context_engage (Context)) ;
+    CHECK (GB_Context_numa_first_touch ( )) ;
+    OK (GxB_Context_disengage (Context)) ;
+    CHECK (!GB_Context_numa_first_touch ( )) ;
+
+    //--------------------------------------------------------------------------
+    // GB_memory_first_touch
+    //--------------------------------------------------------------------------
+
+    size_t bufsize = 24 * PAGE ;
+    X = malloc (bufsize) ;
+    CHECK (X != NULL) ;
+    size_t sizes [ ] = { 1, 100, PAGE-1, PAGE, PAGE+1, 3*PAGE+17, 20*PAGE } ;
+    int offsets [ ] = { 0, 1, 13, PAGE-1 } ;
+    for (int s = 0 ; s < 7 ; s++)
+    {
+        for (int o = 0 ; o < 4 ; o++)
+        {
+            // the block starts at a page boundary, plus an offset
+            GB_void *P = X + GUARD + PAGE - (((uintptr_t) X) % PAGE) ;
+            P += offsets [o] ;
+            if (P - GUARD < X) P += PAGE ;
+            size_t size = sizes [s] ;
+            CHECK (P + size + GUARD <= X + bufsize) ;
+            for (int nthreads = 0 ; nthreads <= 5 ; nthreads++)
+            {
+                for (int clear = 0 ; clear <= 1 ; clear++)
+                {
+                    memset (X, 0xFF, bufsize) ;
+                    GB_memory_first_touch (P, size, clear, nthreads) ;
+                    CHECK (check_touch (P, size, clear)) ;
+                }
+            }
+        }
+    }
+    // nothing is done for an empty block
+    memset (X, 0xFF, bufsize) ;
+    GB_memory_first_touch (X, 0, true, 4) ;
+    GB_memory_first_touch (NULL, 100, true, 4) ;
+    CHECK (X [0] == 0xFF) ;
+    free (X) ;
+    X = NULL ;
+
+    //--------------------------------------------------------------------------
+    // large blocks from GB_malloc_memory and GB_calloc_memory
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_set_INT_ (Context, 4, GxB_NTHREADS)) ;
+    OK (GxB_Context_engage (Context)) ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        size_t n = GB_FIRST_TOUCH_MIN + trial * 1000 + 3, size1, size2 ;
+        GB_void *p = GB_malloc_memory (n, 1, &size1) ;
+        CHECK (p != NULL && size1 >= n) ;
+        memset (p, 0xFF, n) ;
+        GB_free_memory ((void **) &p, size1) ;
+        p = GB_calloc_memory (n, 1, &size2) ;
+        CHECK (p != NULL && size2 >= n) ;
+        bool ok = true ;
+        for (int64_t k = 0 ; k < (int64_t) n ; k++)
+        {
+            ok = ok && (p [k] == 0) ;
+        }
+        CHECK (ok) ;
+        GB_free_memory ((void **) &p, size2) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the same matrix is built with and without the first touch
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 2000000 ;
+    I = malloc (n * sizeof (GrB_Index)) ;
+    J = calloc (n, sizeof (GrB_Index)) ;
+    X = malloc (n * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    double *Y = (double *) X ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        I [k] = (GrB_Index) ((k * 7919) % n) ;
+        Y [k] = (double) k ;
+    }
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, 1)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, 1)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, Y, n, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Context_disengage (Context)) ;
+    OK (GrB_Matrix_build_FP64 (C, I, J, Y, n, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49:  all tests passed\n\n") ;
+}
+
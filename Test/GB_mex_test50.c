@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// GB_mex_test50: test GxB_MEMORY_HUGE_PAGES
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Large blocks are aligned to 2MB only on Linux, and only if GraphBLAS uses
+// the malloc and free functions of the C library.  Otherwise, the option can
+// be set but has no effect, and only the results are checked.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&C0) ;                 \
+    GrB_Vector_free (&q) ;                  \
+    GB_free_memory ((void **) &p, psize) ;  \
+}
+
+#define HUGE_PAGE (2*1024*1024)
+
+//------------------------------------------------------------------------------
+// GB_mex_test50 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, C0 = NULL ;
+    GrB_Vector q = NULL ;
+    GB_void *p = NULL ;
+    size_t psize = 0 ;
+
+    #if defined ( __linux__ )
+    bool have_huge_pages =
+        (GB_Global_malloc_function_get ( ) == (void *) malloc) &&
+        (GB_Global_free_function_get ( ) == (void *) free) ;
+    #else
+    bool have_huge_pages = false ;
+    #endif
+    printf ("huge pages: %d\n", (int) have_huge_pages) ;
+
+    //--------------------------------------------------------------------------
+    // get/set the option
+    //--------------------------------------------------------------------------
+
+    int32_t huge = -1 ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &huge,
+        (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+    CHECK (huge == 0) ;
+
+    // no huge pages are used if the option is false
+    CHECK (GB_memory_huge_pages_malloc (2 * HUGE_PAGE) == NULL) ;
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true,
+        (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+    OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &huge,
+        (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+    CHECK (huge == 1) ;
+
+    // no huge pages are used for a small block
+    CHECK (GB_memory_huge_pages_malloc (GB_HUGE_PAGE_MIN - 1) == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // large blocks from GB_malloc_memory and GB_calloc_memory
+    //--------------------------------------------------------------------------
+
+    size_t sizes [ ] = { GB_HUGE_PAGE_MIN, GB_HUGE_PAGE_MIN + 1,
+        3 * HUGE_PAGE + 100 } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        size_t n = sizes [k] ;
+
+        // a large block is aligned to a huge page
+        p = GB_malloc_memory (n, 1, &psize) ;
+        CHECK (p != NULL && psize >= n) ;
+        if (have_huge_pages) CHECK (((uintptr_t) p) % HUGE_PAGE == 0) ;
+        memset (p, 0xFF, n) ;
+        GB_free_memory ((void **) &p, psize) ;
+        CHECK (p == NULL) ;
+
+        // and it is cleared by GB_calloc_memory
+        p = GB_calloc_memory (n, 1, &psize) ;
+        CHECK (p != NULL && psize >= n) ;
+        if (have_huge_pages) CHECK (((uintptr_t) p) % HUGE_PAGE == 0) ;
+        bool ok = true ;
+        for (int64_t i = 0 ; i < (int64_t) n ; i++)
+        {
+            ok = ok && (p [i] == 0) ;
+        }
+        CHECK (ok) ;
+        GB_free_memory ((void **) &p, psize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // saxpy with a Gustavson workspace held in huge pages
+    //--------------------------------------------------------------------------
+
+    // A*q and A'*q with a large sparse A, computed with and without huge
+    // pages, use large workspaces of size n
+    GrB_Index n = 1000000 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int64_t k = 0 ; k < 2*n ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % n ;
+        GrB_Index j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 13), i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_new (&q, GrB_FP64, n)) ;
+    for (int64_t k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (q, 1, simple_rand_i ( ) % n)) ;
+    }
+    OK (GrB_Vector_wait (q, GrB_MATERIALIZE)) ;
+
+    for (int method = 0 ; method <= 1 ; method++)
+    {
+        GrB_Descriptor desc = (method == 0) ? NULL : GrB_DESC_T0 ;
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+            (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+        OK (GrB_Matrix_new (&C0, GrB_FP64, n, 1)) ;
+        OK (GrB_mxm (C0, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, (GrB_Matrix) q, desc)) ;
+        OK (GrB_Global_set_INT32_ (GrB_GLOBAL, true,
+            (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, 1)) ;
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, (GrB_Matrix) q, desc)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&C0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32_ (GrB_GLOBAL, false,
+        (GrB_Field) GxB_MEMORY_HUGE_PAGES)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test50:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,265 @@
+//------------------------------------------------------------------------------
+// GB_mex_test51: test copy-on-write GrB_*_dup
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Vector_free (&w) ;              \
+    GrB_Vector_free (&u) ;              \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random FP64 matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 0, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        OK (GrB_Matrix_setElement_FP64 (*A, simple_rand_x ( ), i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test51 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GB_WERK ("GB_mex_test51") ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL, T = NULL ;
+    GrB_Vector v = NULL, w = NULL, u = NULL ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (51) ;
+
+    int32_t save_cow, s ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_cow,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+
+    //--------------------------------------------------------------------------
+    // GrB_Matrix_dup with copy-on-write disabled
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &s,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    CHECK (s == 0) ;
+    OK (random_matrix (&A, 20, 30, GxB_SPARSE, true)) ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    CHECK (A->shared == NULL && C->shared == NULL) ;
+    CHECK (C->x != A->x && C->i != A->i && C->p != A->p) ;
+    CHECK (isequal (A, C)) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // GrB_Matrix_dup with copy-on-write enabled
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            int sparsity = sparsity_list [k] ;
+            printf ("cow dup: sparsity %d by_col %d\n", sparsity, by_col) ;
+
+            // T = A, with no shared arrays, for checking the results below
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+                (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+            OK (random_matrix (&A, 40, 30, sparsity, by_col)) ;
+            OK (GrB_Matrix_dup (&T, A)) ;
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+                (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+            OK (GrB_Global_get_INT32 (GrB_GLOBAL, &s,
+                (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+            CHECK (s == 1) ;
+
+            // C = A shares all the arrays of A
+            OK (GrB_Matrix_dup (&C, A)) ;
+            CHECK (A->shared != NULL && C->shared == A->shared) ;
+            CHECK (A->shared->refcount == 2) ;
+            CHECK (C->x == A->x && C->i == A->i && C->p == A->p) ;
+            CHECK (C->h == A->h && C->b == A->b) ;
+            CHECK (C->x_shallow && A->x_shallow) ;
+
+            // using A and C as inputs does not unshare them
+            OK (GrB_Matrix_new (&D, GrB_FP64, 40, 30)) ;
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_PLUS_FP64,
+                A, C, NULL)) ;
+            CHECK (C->shared == A->shared && C->x == A->x) ;
+            OK (GrB_Matrix_free (&D)) ;
+
+            // modify C; A is not changed
+            OK (GrB_Matrix_setElement_FP64 (C, 999, 3, 4)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            CHECK (C->shared == NULL && !C->x_shallow) ;
+            CHECK (C->x != A->x) ;
+            CHECK (A->shared != NULL && A->shared->refcount == 1) ;
+            double x = 0 ;
+            OK (GrB_Matrix_extractElement_FP64 (&x, C, 3, 4)) ;
+            CHECK (x == 999) ;
+            CHECK (isequal (A, T)) ;
+
+            // D = A, then free A; D remains valid
+            OK (GrB_Matrix_dup (&D, A)) ;
+            CHECK (D->shared == A->shared && D->shared->refcount == 2) ;
+            OK (GrB_Matrix_free (&A)) ;
+            CHECK (D->shared != NULL && D->shared->refcount == 1) ;
+            CHECK (isequal (D, T)) ;
+
+            // A = D, then unshare A: both get their own arrays
+            OK (GrB_Matrix_dup (&A, D)) ;
+            CHECK (A->shared == D->shared && A->shared->refcount == 2) ;
+            OK (GB_unshare (A, Werk)) ;
+            CHECK (A->shared == NULL && !A->x_shallow && A->x != D->x) ;
+            CHECK (D->shared != NULL && D->shared->refcount == 1) ;
+            OK (GB_unshare (D, Werk)) ;
+            CHECK (D->shared == NULL && !D->x_shallow) ;
+            OK (GB_unshare (D, Werk)) ;
+            CHECK (isequal (A, T)) ;
+            CHECK (isequal (D, T)) ;
+            FREE_ALL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // GrB_Vector_dup with copy-on-write enabled
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_INT64, 100)) ;
+    for (int64_t k = 0 ; k < 100 ; k += 3)
+    {
+        OK (GrB_Vector_setElement_INT64 (v, k, k)) ;
+    }
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_dup (&w, v)) ;
+    OK (GrB_Vector_dup (&u, v)) ;
+    CHECK (w->shared == v->shared && u->shared == v->shared) ;
+    CHECK (v->shared != NULL && v->shared->refcount == 3) ;
+    OK (GrB_Vector_removeElement (w, 3)) ;
+    OK (GrB_Vector_wait (w, GrB_MATERIALIZE)) ;
+    CHECK (w->shared == NULL && v->shared->refcount == 2) ;
+    GrB_Index nvals ;
+    OK (GrB_Vector_nvals (&nvals, v)) ;
+    CHECK (nvals == 34) ;
+    OK (GrB_Vector_nvals (&nvals, w)) ;
+    CHECK (nvals == 33) ;
+    OK (GrB_Vector_free (&v)) ;
+    CHECK (u->shared != NULL && u->shared->refcount == 1) ;
+    int64_t y = 0 ;
+    OK (GrB_Vector_extractElement_INT64 (&y, u, 99)) ;
+    CHECK (y == 99) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // GrB_Matrix_dup of the same matrix by several user threads
+    //--------------------------------------------------------------------------
+
+    // only one of the threads moves the arrays of A into A->shared
+    #define NDUP 8
+    GrB_Matrix Dups [NDUP] ;
+    OK (random_matrix (&A, 40, 30, GxB_SPARSE, true)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    OK (GrB_Matrix_dup (&T, A)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    CHECK (A->shared == NULL) ;
+    bool ok = true ;
+    #pragma omp parallel for num_threads(NDUP) schedule(static,1) \
+        reduction(&&:ok)
+    for (int tid = 0 ; tid < NDUP ; tid++)
+    {
+        Dups [tid] = NULL ;
+        ok = ok && (GrB_Matrix_dup (&(Dups [tid]), A) == GrB_SUCCESS) ;
+    }
+    CHECK (ok) ;
+    CHECK (A->shared != NULL && A->shared->refcount == NDUP + 1) ;
+    for (int tid = 0 ; tid < NDUP ; tid++)
+    {
+        CHECK (Dups [tid]->shared == A->shared) ;
+        CHECK (isequal (Dups [tid], T)) ;
+        OK (GrB_Matrix_free (&(Dups [tid]))) ;
+    }
+    CHECK (A->shared->refcount == 1) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_cow,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test51:  all tests passed\n\n") ;
+}
+
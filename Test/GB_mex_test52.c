@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// GB_mex_test52: test GxB_Matrix_view
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Matrix_free (&T) ;              \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random FP64 matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 0, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        OK (GrB_Matrix_setElement_FP64 (*A, simple_rand_x ( ), i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test52 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL, T = NULL ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (52) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_view
+    //--------------------------------------------------------------------------
+
+    GrB_Index List [20], Range [2] = { 10, 29 }, Stride [20] ;
+    for (int k = 0 ; k < 20 ; k++)
+    {
+        List [k] = 10 + k ;
+        Stride [k] = 2 * k ;
+    }
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            int sparsity = sparsity_list [k] ;
+            printf ("view: sparsity %d by_col %d\n", sparsity, by_col) ;
+            OK (random_matrix (&A, 50, 60, sparsity, by_col)) ;
+            for (int kind = 0 ; kind <= 1 ; kind++)
+            {
+
+                // C = A(:,10:29) if A is held by column, or A(10:29,:) by row,
+                // with the range given as an explicit list or as a GxB_RANGE
+                const GrB_Index *I = GrB_ALL, *J = GrB_ALL ;
+                GrB_Index ni = 50, nj = 60 ;
+                const GrB_Index *K = (kind == 0) ? List : Range ;
+                GrB_Index nk = (kind == 0) ? 20 : GxB_RANGE ;
+                if (by_col)
+                {
+                    J = K ; nj = nk ;
+                }
+                else
+                {
+                    I = K ; ni = nk ;
+                }
+                OK (GxB_Matrix_view (&C, A, I, ni, J, nj)) ;
+                CHECK (A->shared != NULL && C->shared == A->shared) ;
+                CHECK (C->x_shallow) ;
+                OK (GrB_Matrix_new (&T, GrB_FP64, by_col ? 50 : 20,
+                    by_col ? 20 : 60)) ;
+                OK (GrB_Matrix_extract (T, NULL, NULL, A, I, ni, J, nj,
+                    NULL)) ;
+                OK (GrB_Matrix_dup (&D, T)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                CHECK (isequal (C, T)) ;
+
+                // modify A; C is not changed
+                OK (GrB_Matrix_setElement_FP64 (A, -1, 12, 12)) ;
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                CHECK (C->shared != NULL) ;
+                CHECK (isequal (C, D)) ;
+
+                // modify C; A is not changed
+                OK (GrB_Matrix_setElement_FP64 (C, -2, 0, 0)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                CHECK (C->shared == NULL) ;
+                double x = 0 ;
+                OK (GrB_Matrix_extractElement_FP64 (&x, A, 12, 12)) ;
+                CHECK (x == -1) ;
+                OK (GrB_Matrix_free (&C)) ;
+                OK (GrB_Matrix_free (&D)) ;
+                OK (GrB_Matrix_free (&T)) ;
+            }
+
+            // a view remains valid after its parent is freed
+            OK (GrB_Matrix_dup (&T, A)) ;
+            OK (GxB_Matrix_view (&C, A, GrB_ALL, 50, GrB_ALL, 60)) ;
+            OK (GrB_Matrix_free (&A)) ;
+            CHECK (isequal (C, T)) ;
+            OK (GrB_Matrix_free (&C)) ;
+            OK (GrB_Matrix_free (&T)) ;
+
+            // a strided list is copied with GrB_extract
+            OK (random_matrix (&A, 50, 60, sparsity, by_col)) ;
+            OK (GxB_Matrix_view (&C, A, Stride, 20, Stride, 20)) ;
+            CHECK (C->shared == NULL || C->shared != A->shared) ;
+            OK (GrB_Matrix_new (&T, GrB_FP64, 20, 20)) ;
+            OK (GrB_Matrix_extract (T, NULL, NULL, A, Stride, 20, Stride, 20,
+                NULL)) ;
+            CHECK (isequal (C, T)) ;
+            FREE_ALL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // views of the same matrix made by several user threads
+    //--------------------------------------------------------------------------
+
+    // only one of the threads moves the arrays of A into A->shared
+    #define NVIEW 8
+    GrB_Matrix Views [NVIEW] ;
+    OK (random_matrix (&A, 50, 60, GxB_SPARSE, true)) ;
+    CHECK (A->shared == NULL) ;
+    bool ok = true ;
+    #pragma omp parallel for num_threads(NVIEW) schedule(static,1) \
+        reduction(&&:ok)
+    for (int tid = 0 ; tid < NVIEW ; tid++)
+    {
+        Views [tid] = NULL ;
+        ok = ok && (GxB_Matrix_view (&(Views [tid]), A, GrB_ALL, 50,
+            Range, GxB_RANGE) == GrB_SUCCESS) ;
+    }
+    CHECK (ok) ;
+    CHECK (A->shared != NULL && A->shared->refcount == NVIEW + 1) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, 50, 20)) ;
+    OK (GrB_Matrix_extract (T, NULL, NULL, A, GrB_ALL, 50, Range, GxB_RANGE,
+        NULL)) ;
+    for (int tid = 0 ; tid < NVIEW ; tid++)
+    {
+        CHECK (Views [tid]->shared == A->shared) ;
+        CHECK (isequal (Views [tid], T)) ;
+        OK (GrB_Matrix_free (&(Views [tid]))) ;
+    }
+    CHECK (A->shared->refcount == 1) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_view error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, 50, 60, GxB_SPARSE, true)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_view (NULL, A, GrB_ALL, 50, List, 20)) ;
+    ERR (GxB_Matrix_view (&C, NULL, GrB_ALL, 50, List, 20)) ;
+    CHECK (C == NULL) ;
+    ERR (GxB_Matrix_view (&C, A, NULL, 50, List, 20)) ;
+    ERR (GxB_Matrix_view (&C, A, GrB_ALL, 50, NULL, 20)) ;
+    GrB_Index Bad [2] = { 59, 60 } ;
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    ERR (GxB_Matrix_view (&C, A, GrB_ALL, 50, Bad, 2)) ;
+    CHECK (C == NULL) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test52:  all tests passed\n\n") ;
+}
@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// GB_mex_test53: test GxB_Matrix_mmap_write and GxB_Matrix_mmap_read
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FILENAME "/tmp/GB_mex_test53.mmap"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, type, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test53 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    GrB_Type type_list [3] = { GrB_FP64, GrB_INT8, GrB_INT32 } ;
+    simple_rand_seed (53) ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int t = 0 ; t < 3 ; t++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+                    int sparsity = sparsity_list [k] ;
+                    GrB_Type type = type_list [t] ;
+                    printf ("sparsity %d by_col %d type %d iso %d\n",
+                        sparsity, by_col, t, iso) ;
+                    OK (random_matrix (&A, type, 100, 80, sparsity, by_col,
+                        iso)) ;
+                    //----------------------------------------------------------
+                    // GxB_Matrix_mmap_write and GxB_Matrix_mmap_read
+                    //----------------------------------------------------------
+
+                    OK (GxB_Matrix_mmap_write (FILENAME, A)) ;
+                    OK (GxB_Matrix_mmap_read (&C, type, FILENAME)) ;
+                    CHECK (C->shared != NULL && C->shared->mmap_base != NULL) ;
+                    CHECK (isequal (C, A)) ;
+
+                    // C can be used as an input without being copied
+                    OK (GrB_Matrix_new (&D, type, 100, 80)) ;
+                    OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL,
+                        GrB_PLUS_FP64, C, A, NULL)) ;
+                    CHECK (C->shared != NULL && C->shared->mmap_base != NULL) ;
+                    OK (GrB_Matrix_free (&D)) ;
+
+                    // modify C; it gets its own copy of its content
+                    OK (GrB_Matrix_setElement_FP64 (C, 7, 2, 3)) ;
+                    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                    CHECK (C->shared == NULL) ;
+                    double y = 0 ;
+                    OK (GrB_Matrix_extractElement_FP64 (&y, C, 2, 3)) ;
+                    CHECK (y == 7) ;
+                    OK (GrB_Matrix_free (&C)) ;
+
+                    // the file is unchanged
+                    OK (GxB_Matrix_mmap_read (&C, NULL, FILENAME)) ;
+                    CHECK (isequal (C, A)) ;
+
+                    // the type must match
+                    OK (GrB_Matrix_free (&C)) ;
+                    expected = GrB_DOMAIN_MISMATCH ;
+                    ERR (GxB_Matrix_mmap_read (&C, GrB_UINT16, FILENAME)) ;
+                    CHECK (C == NULL) ;
+                    remove (FILENAME) ;
+                    FREE_ALL ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GrB_FP64, 10, 10, GxB_SPARSE, true, false)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_mmap_write (NULL, A)) ;
+    ERR (GxB_Matrix_mmap_write (FILENAME, NULL)) ;
+    ERR (GxB_Matrix_mmap_read (&C, NULL, NULL)) ;
+    ERR (GxB_Matrix_mmap_read (NULL, NULL, FILENAME)) ;
+
+    // a file that does not exist cannot be mapped
+    remove (FILENAME) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_mmap_read (&C, NULL, FILENAME)) ;
+    CHECK (C == NULL) ;
+
+    // a file that does not hold a matrix cannot be mapped
+    FILE *f = fopen (FILENAME, "w") ;
+    CHECK (f != NULL) ;
+    for (int k = 0 ; k < 10000 ; k++) fputc ('x', f) ;
+    fclose (f) ;
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_mmap_read (&C, NULL, FILENAME)) ;
+    CHECK (C == NULL) ;
+    remove (FILENAME) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test53:  all tests passed\n\n") ;
+}
+
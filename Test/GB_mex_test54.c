@@ -0,0 +1,229 @@
+//------------------------------------------------------------------------------
+// GB_mex_test54: test GxB_COMPRESSION_ALIGNED and GxB_Matrix_deserialize_view
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, type, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test54 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    GrB_Type type_list [3] = { GrB_FP64, GrB_INT8, GrB_INT32 } ;
+    simple_rand_seed (54) ;
+
+    int32_t save_cow ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_cow,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int t = 0 ; t < 3 ; t++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+                    int sparsity = sparsity_list [k] ;
+                    GrB_Type type = type_list [t] ;
+                    printf ("sparsity %d by_col %d type %d iso %d\n",
+                        sparsity, by_col, t, iso) ;
+                    OK (random_matrix (&A, type, 100, 80, sparsity, by_col,
+                        iso)) ;
+                    OK (GrB_Descriptor_new (&desc)) ;
+
+                    //----------------------------------------------------------
+                    // GxB_COMPRESSION_ALIGNED and GxB_Matrix_deserialize_view
+                    //----------------------------------------------------------
+
+                    OK (GrB_Descriptor_set_INT32 (desc,
+                        GxB_COMPRESSION_ALIGNED, (GrB_Field) GxB_COMPRESSION)) ;
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+
+                    // C points into the blob, unless its x array is iso
+                    OK (GxB_Matrix_deserialize_view (&C, type, blob,
+                        blob_size, NULL)) ;
+                    GB_void *b0 = (GB_void *) blob ;
+                    GB_void *b1 = b0 + blob_size ;
+                    CHECK (C->shared != NULL && C->shared->user_owned) ;
+                    if (!C->iso && GB_nnz (C) > 0)
+                    {
+                        CHECK (C->x_shallow) ;
+                        CHECK ((GB_void *) C->x >= b0 &&
+                               (GB_void *) C->x <  b1) ;
+                        CHECK (((GB_void *) C->x - b0) % 64 == 0) ;
+                    }
+                    CHECK (isequal (C, A)) ;
+
+                    // C can be used as an input without being copied
+                    OK (GrB_Matrix_new (&D, type, 100, 80)) ;
+                    OK (GrB_Matrix_apply (D, NULL, NULL, GrB_AINV_FP64, C,
+                        NULL)) ;
+                    CHECK (C->shared != NULL && C->shared->user_owned) ;
+                    OK (GrB_Matrix_free (&D)) ;
+
+                    // a dup of C also points into the blob
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+                        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+                    OK (GrB_Matrix_dup (&D, C)) ;
+                    CHECK (D->shared == C->shared) ;
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+                        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+
+                    // modify C and D; they no longer use the blob
+                    OK (GrB_Matrix_setElement_FP64 (C, 7, 2, 3)) ;
+                    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                    CHECK (C->shared == NULL && !C->x_shallow) ;
+                    OK (GrB_Matrix_removeElement (D, 2, 3)) ;
+                    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+                    CHECK (D->shared == NULL) ;
+                    memset (blob, 0, blob_size) ;
+                    mxFree (blob) ; blob = NULL ;
+                    double x = 0 ;
+                    OK (GrB_Matrix_extractElement_FP64 (&x, C, 2, 3)) ;
+                    CHECK (x == 7) ;
+                    expected = GrB_NO_VALUE ;
+                    ERR (GrB_Matrix_extractElement_FP64 (&x, D, 2, 3)) ;
+                    OK (GrB_Matrix_free (&C)) ;
+                    OK (GrB_Matrix_free (&D)) ;
+
+                    // an aligned blob can also be deserialized as usual
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+                    OK (GrB_Matrix_deserialize (&C, type, blob, blob_size)) ;
+                    CHECK (C->shared == NULL) ;
+                    CHECK (isequal (C, A)) ;
+                    OK (GrB_Matrix_free (&C)) ;
+                    mxFree (blob) ; blob = NULL ;
+
+                    // a compressed blob, or one that is not aligned, is
+                    // deserialized into new arrays
+                    for (int m = 0 ; m <= 1 ; m++)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, (m == 0) ?
+                            GxB_COMPRESSION_DEFAULT : GxB_COMPRESSION_NONE,
+                            (GrB_Field) GxB_COMPRESSION)) ;
+                        OK (GxB_Matrix_serialize (&blob, &blob_size, A,
+                            desc)) ;
+                        OK (GxB_Matrix_deserialize_view (&C, type, blob,
+                            blob_size, NULL)) ;
+                        mxFree (blob) ; blob = NULL ;
+                        CHECK (C->shared == NULL) ;
+                        CHECK (isequal (C, A)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                    }
+
+                    FREE_ALL ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_deserialize_view (NULL, NULL, blob, blob_size, NULL)) ;
+    ERR (GxB_Matrix_deserialize_view (&C, NULL, NULL, blob_size, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_cow,
+        (GrB_Field) GxB_DUP_COPY_ON_WRITE)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test54:  all tests passed\n\n") ;
+}
+
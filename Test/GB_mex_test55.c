@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_mex_test55: test GxB_Matrix_serialize_stream and deserialize_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free (&A) ;                      \
+    GrB_Matrix_free (&C) ;                      \
+    GrB_Descriptor_free (&desc) ;               \
+    if (stream.buf != NULL) free (stream.buf) ; \
+    stream.buf = NULL ;                         \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, type, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// a stream held in memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t *buf ;      // the bytes written to the stream
+    size_t size ;       // # of bytes in buf
+    size_t pos ;        // position of the next byte to read
+    size_t limit ;      // the write fails if the stream would exceed limit
+}
+test55_stream ;
+
+bool test55_write (void *stream, const void *buffer, size_t size) ;
+bool test55_write (void *stream, const void *buffer, size_t size)
+{
+    test55_stream *S = (test55_stream *) stream ;
+    if (S->size + size > S->limit) return (false) ;
+    uint8_t *buf = realloc (S->buf, S->size + size + 1) ;
+    if (buf == NULL) return (false) ;
+    memcpy (buf + S->size, buffer, size) ;
+    S->buf = buf ;
+    S->size += size ;
+    return (true) ;
+}
+
+bool test55_read (void *stream, void *buffer, size_t size) ;
+bool test55_read (void *stream, void *buffer, size_t size)
+{
+    test55_stream *S = (test55_stream *) stream ;
+    if (S->pos + size > S->size) return (false) ;
+    memcpy (buffer, S->buf + S->pos, size) ;
+    S->pos += size ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test55 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Descriptor desc = NULL ;
+    test55_stream stream = { NULL, 0, 0, SIZE_MAX } ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    GrB_Type type_list [3] = { GrB_FP64, GrB_INT8, GrB_INT32 } ;
+    simple_rand_seed (55) ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int t = 0 ; t < 3 ; t++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+                    int sparsity = sparsity_list [k] ;
+                    GrB_Type type = type_list [t] ;
+                    printf ("sparsity %d by_col %d type %d iso %d\n",
+                        sparsity, by_col, t, iso) ;
+                    OK (random_matrix (&A, type, 100, 80, sparsity, by_col,
+                        iso)) ;
+                    OK (GrB_Descriptor_new (&desc)) ;
+
+                    //----------------------------------------------------------
+                    // GxB_Matrix_serialize_stream and deserialize_stream
+                    //----------------------------------------------------------
+
+                    int stream_list [5] = { GxB_COMPRESSION_NONE,
+                        GxB_COMPRESSION_ALIGNED, GxB_COMPRESSION_LZ4,
+                        GxB_COMPRESSION_LZ4HC + 5, GxB_COMPRESSION_ZSTD + 3 } ;
+                    for (int m = 0 ; m < 5 ; m++)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, stream_list [m],
+                            (GrB_Field) GxB_COMPRESSION)) ;
+                        stream.size = 0 ; stream.pos = 0 ;
+                        stream.limit = SIZE_MAX ;
+                        OK (GxB_Matrix_serialize_stream (test55_write, &stream,
+                            A, desc)) ;
+                        OK (GxB_Matrix_deserialize_stream (&C, type,
+                            test55_read, &stream, NULL)) ;
+                        CHECK (stream.pos == stream.size) ;
+                        CHECK (isequal (C, A)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+
+                        // a truncated stream cannot be read
+                        size_t size = stream.size ;
+                        expected = GrB_INVALID_OBJECT ;
+                        stream.size = size / 2 ; stream.pos = 0 ;
+                        ERR (GxB_Matrix_deserialize_stream (&C, type,
+                            test55_read, &stream, NULL)) ;
+                        CHECK (C == NULL) ;
+                        stream.size = 0 ; stream.pos = 0 ;
+                        ERR (GxB_Matrix_deserialize_stream (&C, type,
+                            test55_read, &stream, NULL)) ;
+                        CHECK (C == NULL) ;
+
+                        // a stream that cannot be written
+                        expected = GrB_INVALID_VALUE ;
+                        stream.size = 0 ; stream.limit = size / 2 ;
+                        ERR (GxB_Matrix_serialize_stream (test55_write,
+                            &stream, A, desc)) ;
+                    }
+
+                    // the filters cannot be used with a stream
+                    OK (GrB_Descriptor_set_INT32 (desc,
+                        GxB_COMPRESSION_LZ4 + GxB_COMPRESSION_FILTER,
+                        (GrB_Field) GxB_COMPRESSION)) ;
+                    expected = GrB_NOT_IMPLEMENTED ;
+                    stream.size = 0 ; stream.limit = SIZE_MAX ;
+                    ERR (GxB_Matrix_serialize_stream (test55_write, &stream,
+                        A, desc)) ;
+
+                    //----------------------------------------------------------
+                    // a stream with an invalid header cannot be read
+                    //----------------------------------------------------------
+
+                    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE,
+                        (GrB_Field) GxB_COMPRESSION)) ;
+                    stream.size = 0 ;
+                    OK (GxB_Matrix_serialize_stream (test55_write, &stream,
+                        A, desc)) ;
+                    expected = GrB_INVALID_OBJECT ;
+                    for (int c = 0 ; c < 3 ; c++)
+                    {
+                        // the header starts with blob_size, typecode, and
+                        // version; nvals is at byte 48, and the method of
+                        // the values array at byte 156
+                        size_t offset = (c == 0) ? 12 : ((c == 1) ? 48 : 156) ;
+                        int64_t bad = (c == 0) ? (GxB_IMPLEMENTATION + 1) :
+                            ((c == 1) ? INT64_MAX :
+                            (GxB_COMPRESSION_LZ4 + GxB_COMPRESSION_FILTER)) ;
+                        size_t len = (c == 1) ? 8 : 4 ;
+                        uint8_t save [8] ;
+                        memcpy (save, stream.buf + offset, len) ;
+                        if (len == 8)
+                        {
+                            memcpy (stream.buf + offset, &bad, 8) ;
+                        }
+                        else
+                        {
+                            int32_t bad32 = (int32_t) bad ;
+                            memcpy (stream.buf + offset, &bad32, 4) ;
+                        }
+                        stream.pos = 0 ;
+                        ERR (GxB_Matrix_deserialize_stream (&C, type,
+                            test55_read, &stream, NULL)) ;
+                        CHECK (C == NULL) ;
+                        memcpy (stream.buf + offset, save, len) ;
+                    }
+                    stream.pos = 0 ;
+                    OK (GxB_Matrix_deserialize_stream (&C, type, test55_read,
+                        &stream, NULL)) ;
+                    CHECK (isequal (C, A)) ;
+
+                    FREE_ALL ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GrB_FP64, 10, 10, GxB_SPARSE, true, false)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_serialize_stream (NULL, &stream, A, NULL)) ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, NULL, &stream, NULL)) ;
+    FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test55:  all tests passed\n\n") ;
+}
+
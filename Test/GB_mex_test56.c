@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// GB_mex_test56: test GxB_COMPRESSION_FILTER
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Type type, GrB_Index nrows,
+    GrB_Index ncols, int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, type, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test56 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    int nfiltered = 0 ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    GrB_Type type_list [3] = { GrB_FP64, GrB_INT8, GrB_INT32 } ;
+    simple_rand_seed (56) ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int t = 0 ; t < 3 ; t++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+                    int sparsity = sparsity_list [k] ;
+                    GrB_Type type = type_list [t] ;
+                    printf ("sparsity %d by_col %d type %d iso %d\n",
+                        sparsity, by_col, t, iso) ;
+                    OK (random_matrix (&A, type, 100, 80, sparsity, by_col,
+                        iso)) ;
+                    OK (GrB_Descriptor_new (&desc)) ;
+
+                    //----------------------------------------------------------
+                    // GxB_COMPRESSION_FILTER
+                    //----------------------------------------------------------
+
+                    int filter_list [4] = {
+                        GxB_COMPRESSION_LZ4    + GxB_COMPRESSION_FILTER,
+                        GxB_COMPRESSION_LZ4HC  + GxB_COMPRESSION_FILTER + 5,
+                        GxB_COMPRESSION_ZSTD   + GxB_COMPRESSION_FILTER,
+                        GxB_COMPRESSION_ZSTD   + GxB_COMPRESSION_FILTER + 3 } ;
+                    for (int f = 0 ; f < 4 ; f++)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, filter_list [f],
+                            (GrB_Field) GxB_COMPRESSION)) ;
+                        OK (GxB_Matrix_serialize (&blob, &blob_size, A,
+                            desc)) ;
+                        OK (GxB_Matrix_deserialize (&C, type, blob, blob_size,
+                            NULL)) ;
+                        CHECK (isequal (C, A)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                        OK (GrB_Matrix_deserialize (&C, NULL, blob,
+                            blob_size)) ;
+                        CHECK (isequal (C, A)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                        mxFree (blob) ; blob = NULL ;
+                    }
+
+                    // a filtered blob is flagged in its typecode, so that
+                    // v9.4.x and earlier reject it; the flag is required
+                    int32_t typecode = 0 ;
+                    char type_name [GxB_MAX_NAME_LEN] ;
+                    for (int f = 0 ; f <= 1 ; f++)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, (f == 0) ?
+                            GxB_COMPRESSION_LZ4 : filter_list [0],
+                            (GrB_Field) GxB_COMPRESSION)) ;
+                        OK (GxB_Matrix_serialize (&blob, &blob_size, A,
+                            desc)) ;
+                        // the method of each array is in the blob header, at
+                        // bytes 124, 132, ..., 156; small arrays are not
+                        // compressed, and so are not filtered
+                        bool any_filtered = false ;
+                        for (int a = 0 ; a < 5 ; a++)
+                        {
+                            int32_t method = 0 ;
+                            memcpy (&method, ((uint8_t *) blob) + 124 + 8*a,
+                                4) ;
+                            any_filtered = any_filtered ||
+                                (method >= GxB_COMPRESSION_FILTER) ;
+                        }
+                        if (f == 0) CHECK (!any_filtered) ;
+                        if (any_filtered) nfiltered++ ;
+                        memcpy (&typecode, ((uint8_t *) blob) + 8, 4) ;
+                        CHECK (any_filtered == (typecode >= 256)) ;
+                        OK (GxB_deserialize_type_name (type_name, blob,
+                            blob_size)) ;
+                        CHECK (strcmp (type_name, type->name) == 0) ;
+                        // toggle the flag
+                        typecode += any_filtered ? (-256) : 256 ;
+                        memcpy (((uint8_t *) blob) + 8, &typecode, 4) ;
+                        expected = GrB_INVALID_OBJECT ;
+                        ERR (GxB_Matrix_deserialize (&C, type, blob,
+                            blob_size, NULL)) ;
+                        CHECK (C == NULL) ;
+                        mxFree (blob) ; blob = NULL ;
+                    }
+
+                    FREE_ALL ;
+                }
+            }
+        }
+    }
+
+    // some of the blobs have filtered arrays
+    CHECK (nfiltered > 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test56:  all tests passed\n\n") ;
+}
+
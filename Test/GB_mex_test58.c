@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+// GB_mex_test58: test GxB_Builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Builder is compared with GrB_Matrix_build, with batches of tuples of
+// increasing size, for many dup operators and matrix dimensions.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define NTUPLES 100000
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&T) ;                  \
+    GxB_Builder_free (&builder) ;           \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+    I = NULL ; J = NULL ; X = NULL ;        \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test58 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL, T = NULL ;
+    GxB_Builder builder = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *X = NULL ;
+    simple_rand_seed (58) ;
+
+    int32_t save_format ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_format,
+        (GrB_Field) GxB_FORMAT)) ;
+
+    // the dimensions of each problem: a small matrix with many duplicates
+    // (for the hash build), a larger one with few duplicates, a vector, and
+    // a huge hypersparse matrix whose (i,j) keys do not fit in 64 bits
+    GrB_Index nrows_list [4] = { 50, 400, 100000, ((GrB_Index) 1) << 40 } ;
+    GrB_Index ncols_list [4] = { 40, 300, 1,      ((GrB_Index) 1) << 40 } ;
+
+    GrB_BinaryOp dup_list [5] = { GrB_PLUS_INT64, GrB_FIRST_INT64,
+        GrB_SECOND_INT64, GrB_MIN_INT64, GxB_IGNORE_DUP } ;
+
+    I = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = malloc (NTUPLES * sizeof (int64_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL,
+            by_row ? GxB_BY_ROW : GxB_BY_COL, (GrB_Field) GxB_FORMAT)) ;
+
+        for (int problem = 0 ; problem < 4 ; problem++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create the tuples
+                //--------------------------------------------------------------
+
+                GrB_Index nrows = nrows_list [problem] ;
+                GrB_Index ncols = ncols_list [problem] ;
+                bool huge = (problem == 3) ;
+                printf ("by_row %d problem %d iso %d\n", by_row, problem, iso) ;
+                for (int64_t k = 0 ; k < NTUPLES ; k++)
+                {
+                    // the huge matrix has tuples in a 100-by-100 block
+                    // spread over its whole range
+                    I [k] = huge ? ((simple_rand_i ( ) % 100) << 33) :
+                        (simple_rand_i ( ) * 32768 + simple_rand_i ( )) % nrows;
+                    J [k] = huge ? ((simple_rand_i ( ) % 100) << 33) :
+                        (simple_rand_i ( ) * 32768 + simple_rand_i ( )) % ncols;
+                    X [k] = iso ? 3 : (int64_t) (simple_rand_i ( ) % 1000) ;
+                }
+
+                for (int d = 0 ; d < 5 ; d++)
+                {
+                    GrB_BinaryOp dup = dup_list [d] ;
+
+                    //----------------------------------------------------------
+                    // T = the tuples built with GrB_Matrix_build
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&T, GrB_INT64, nrows, ncols)) ;
+                    OK (GrB_Matrix_build_INT64 (T, I, J, X, NTUPLES, dup)) ;
+
+                    //----------------------------------------------------------
+                    // GxB_Builder, with batches of increasing size
+                    //----------------------------------------------------------
+
+                    if (dup != GxB_IGNORE_DUP)
+                    {
+                        OK (GxB_Builder_new (&builder, GrB_INT64, nrows, ncols,
+                            dup)) ;
+                        int64_t k = 0, batch = 1 ;
+                        while (k < NTUPLES)
+                        {
+                            int64_t n = GB_IMIN (batch, NTUPLES - k) ;
+                            OK (GxB_Builder_append (builder, I + k, J + k,
+                                X + k, n)) ;
+                            k += n ;
+                            batch = (batch < 8192) ? (2 * batch) : 1 ;
+                        }
+                        OK (GxB_Builder_finish (&C, builder)) ;
+                        CHECK (isequal (T, C)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+
+                        // the builder is empty after GxB_Builder_finish
+                        OK (GxB_Builder_finish (&C, builder)) ;
+                        GrB_Index nvals = 1 ;
+                        OK (GrB_Matrix_nvals (&nvals, C)) ;
+                        CHECK (nvals == 0) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                        OK (GxB_Builder_free (&builder)) ;
+                    }
+                    OK (GrB_Matrix_free (&T)) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // duplicates are assembled in the type of the dup operator
+    //--------------------------------------------------------------------------
+
+    // With an INT8 builder and a PLUS_FP64 dup operator, 100+100-100 is 100 if
+    // computed in double and typecast once, but 27 if typecast to INT8 after
+    // each batch (since 200 is typecast to 127).
+    int8_t X8 [3] = { 100, 100, -100 } ;
+    GrB_Index I3 [3] = { 1, 1, 1 }, J3 [3] = { 2, 2, 2 } ;
+    OK (GrB_Matrix_new (&T, GrB_INT8, 10, 10)) ;
+    OK (GrB_Matrix_build_INT8 (T, I3, J3, X8, 3, GrB_PLUS_FP64)) ;
+    OK (GxB_Builder_new (&builder, GrB_INT8, 10, 10, GrB_PLUS_FP64)) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GxB_Builder_append (builder, I3 + k, J3 + k, X8 + k, 1)) ;
+    }
+    OK (GxB_Builder_finish (&C, builder)) ;
+    int8_t x8 = 0 ;
+    OK (GrB_Matrix_extractElement_INT8 (&x8, C, 1, 2)) ;
+    CHECK (x8 == 100) ;
+    CHECK (isequal (T, C)) ;
+    OK (GrB_Matrix_free (&C)) ;
+    OK (GrB_Matrix_free (&T)) ;
+    OK (GxB_Builder_free (&builder)) ;
+
+    //--------------------------------------------------------------------------
+    // duplicates with no dup operator
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < 1000 ; k++)
+    {
+        I [k] = k % 10 ;
+        J [k] = k / 10 ;
+        X [k] = k ;
+    }
+
+    // each (i,j) appears once
+    OK (GrB_Matrix_new (&T, GrB_INT64, 10, 100)) ;
+    OK (GrB_Matrix_build_INT64 (T, I, J, X, 1000, NULL)) ;
+    OK (GxB_Builder_new (&builder, GrB_INT64, 10, 100, NULL)) ;
+    OK (GxB_Builder_append (builder, I, J, X, 600)) ;
+    OK (GxB_Builder_append (builder, I + 600, J + 600, X + 600, 400)) ;
+    OK (GxB_Builder_finish (&C, builder)) ;
+    CHECK (isequal (T, C)) ;
+    OK (GrB_Matrix_free (&C)) ;
+
+    // duplicates in two batches
+    expected = GrB_INVALID_VALUE ;
+    OK (GxB_Builder_append (builder, I, J, X, 600)) ;
+    ERR (GxB_Builder_append (builder, I + 500, J + 500, X + 500, 500)) ;
+    OK (GxB_Builder_free (&builder)) ;
+
+    // duplicates in one batch
+    I [1] = I [0] ;
+    J [1] = J [0] ;
+    OK (GxB_Builder_new (&builder, GrB_INT64, 10, 100, NULL)) ;
+    ERR (GxB_Builder_append (builder, I, J, X, 1000)) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    I [0] = 10 ;
+    ERR (GxB_Builder_append (builder, I, J, X, 1)) ;
+    OK (GxB_Builder_free (&builder)) ;
+    OK (GxB_Builder_free (&builder)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Builder_new (NULL, GrB_INT64, 10, 100, NULL)) ;
+    ERR (GxB_Builder_new (&builder, NULL, 10, 100, NULL)) ;
+    CHECK (builder == NULL) ;
+    ERR (GxB_Builder_append (NULL, I, J, X, 1)) ;
+    ERR (GxB_Builder_finish (NULL, NULL)) ;
+    ERR (GxB_Builder_finish (&C, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Builder_new (&builder, GrB_INT64, 10, 100, GxB_FIRSTI_INT64)) ;
+    ERR (GxB_Builder_new (&builder, GrB_INT64, 10, 100, GrB_LT_INT64)) ;
+    CHECK (builder == NULL) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Builder_new (&builder, GrB_INT64, GrB_INDEX_MAX + 2, 100,
+        NULL)) ;
+    CHECK (builder == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_format,
+        (GrB_Field) GxB_FORMAT)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test58:  all tests passed\n\n") ;
+}
+
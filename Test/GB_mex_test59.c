@@ -0,0 +1,228 @@
+//------------------------------------------------------------------------------
+// GB_mex_test59: test GxB_BUILD_HASH
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_Matrix_build is tested with GxB_BUILD_HASH enabled and disabled, with
+// the radix sort enabled or disabled, and with many or few duplicates.  The
+// results must be identical, and are checked against a dense reference.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define NTUPLES 100000
+
+#define FREE_ALL                                    \
+{                                                   \
+    GrB_Matrix_free (&C) ;                          \
+    GrB_Matrix_free (&T) ;                          \
+    if (I != NULL) free (I) ;                       \
+    if (J != NULL) free (J) ;                       \
+    if (X != NULL) free (X) ;                       \
+    if (Dense != NULL) free (Dense) ;               \
+    I = NULL ; J = NULL ; X = NULL ; Dense = NULL ; \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test59 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL, T = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *X = NULL, *Dense = NULL ;
+    simple_rand_seed (59) ;
+
+    int32_t save_radix, save_hash, save_format ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_radix,
+        (GrB_Field) GxB_BUILD_RADIX_SORT)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_hash,
+        (GrB_Field) GxB_BUILD_HASH)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &save_format,
+        (GrB_Field) GxB_FORMAT)) ;
+
+    // the dimensions of each problem: a small matrix with many duplicates
+    // (for the hash build), a larger one with few duplicates, a vector, and
+    // a huge hypersparse matrix whose (i,j) keys do not fit in 64 bits
+    GrB_Index nrows_list [4] = { 50, 400, 100000, ((GrB_Index) 1) << 40 } ;
+    GrB_Index ncols_list [4] = { 40, 300, 1,      ((GrB_Index) 1) << 40 } ;
+
+    GrB_BinaryOp dup_list [5] = { GrB_PLUS_INT64, GrB_FIRST_INT64,
+        GrB_SECOND_INT64, GrB_MIN_INT64, GxB_IGNORE_DUP } ;
+
+    I = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = malloc (NTUPLES * sizeof (int64_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL,
+            by_row ? GxB_BY_ROW : GxB_BY_COL, (GrB_Field) GxB_FORMAT)) ;
+
+        for (int problem = 0 ; problem < 4 ; problem++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create the tuples
+                //--------------------------------------------------------------
+
+                GrB_Index nrows = nrows_list [problem] ;
+                GrB_Index ncols = ncols_list [problem] ;
+                bool huge = (problem == 3) ;
+                printf ("by_row %d problem %d iso %d\n", by_row, problem, iso) ;
+                for (int64_t k = 0 ; k < NTUPLES ; k++)
+                {
+                    // the huge matrix has tuples in a 100-by-100 block
+                    // spread over its whole range
+                    I [k] = huge ? ((simple_rand_i ( ) % 100) << 33) :
+                        (simple_rand_i ( ) * 32768 + simple_rand_i ( )) % nrows;
+                    J [k] = huge ? ((simple_rand_i ( ) % 100) << 33) :
+                        (simple_rand_i ( ) * 32768 + simple_rand_i ( )) % ncols;
+                    X [k] = iso ? 3 : (int64_t) (simple_rand_i ( ) % 1000) ;
+                }
+
+                // Dense = the expected result for PLUS, FIRST, and SECOND
+                int64_t nd = huge ? 0 : (int64_t) (nrows * ncols) ;
+                if (!huge)
+                {
+                    Dense = calloc (3 * nd + 1, sizeof (int64_t)) ;
+                    CHECK (Dense != NULL) ;
+                    for (int64_t k = NTUPLES - 1 ; k >= 0 ; k--)
+                    {
+                        int64_t p = I [k] * ncols + J [k] ;
+                        Dense [p] += X [k] ;
+                        Dense [nd + p] = X [k] ;         // FIRST
+                    }
+                    for (int64_t k = 0 ; k < NTUPLES ; k++)
+                    {
+                        int64_t p = I [k] * ncols + J [k] ;
+                        Dense [2*nd + p] = X [k] ;       // SECOND
+                    }
+                }
+
+                for (int d = 0 ; d < 5 ; d++)
+                {
+                    GrB_BinaryOp dup = dup_list [d] ;
+
+                    //----------------------------------------------------------
+                    // T = the tuples built with no radix sort and no hash
+                    //----------------------------------------------------------
+
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+                        (GrB_Field) GxB_BUILD_RADIX_SORT)) ;
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+                        (GrB_Field) GxB_BUILD_HASH)) ;
+                    OK (GrB_Matrix_new (&T, GrB_INT64, nrows, ncols)) ;
+                    OK (GrB_Matrix_build_INT64 (T, I, J, X, NTUPLES, dup)) ;
+
+                    // check T with the Dense result
+                    if (!huge && d <= 2)
+                    {
+                        GrB_Index nvals ;
+                        OK (GrB_Matrix_nvals (&nvals, T)) ;
+                        GrB_Index nz = 0 ;
+                        for (int64_t p = 0 ; p < nd ; p++)
+                        {
+                            int64_t x = 0 ;
+                            info = GrB_Matrix_extractElement_INT64 (&x, T,
+                                p / ncols, p % ncols) ;
+                            if (info == GrB_NO_VALUE) continue ;
+                            OK (info) ;
+                            CHECK (x == Dense [d*nd + p]) ;
+                            nz++ ;
+                        }
+                        CHECK (nz == nvals) ;
+                    }
+
+                    //----------------------------------------------------------
+                    // compare with the hash build
+                    //----------------------------------------------------------
+
+                    for (int radix = 0 ; radix <= 1 ; radix++)
+                    {
+                        for (int hash = 0 ; hash <= 1 ; hash++)
+                        {
+                            OK (GrB_Global_set_INT32 (GrB_GLOBAL, radix,
+                                (GrB_Field) GxB_BUILD_RADIX_SORT)) ;
+                            OK (GrB_Global_set_INT32 (GrB_GLOBAL, hash,
+                                (GrB_Field) GxB_BUILD_HASH)) ;
+                            int32_t s ;
+                            OK (GrB_Global_get_INT32 (GrB_GLOBAL, &s,
+                                (GrB_Field) GxB_BUILD_HASH)) ;
+                            CHECK (s == hash) ;
+                            OK (GrB_Matrix_new (&C, GrB_INT64, nrows, ncols)) ;
+                            OK (GrB_Matrix_build_INT64 (C, I, J, X, NTUPLES,
+                                dup)) ;
+                            CHECK (isequal (T, C)) ;
+                            OK (GrB_Matrix_free (&C)) ;
+                        }
+                    }
+
+                    OK (GrB_Matrix_free (&T)) ;
+                }
+
+                if (Dense != NULL) free (Dense) ;
+                Dense = NULL ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_radix,
+        (GrB_Field) GxB_BUILD_RADIX_SORT)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_hash,
+        (GrB_Field) GxB_BUILD_HASH)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, save_format,
+        (GrB_Field) GxB_FORMAT)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test59:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,229 @@
+//------------------------------------------------------------------------------
+// GB_mex_test60: test concurrent setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests GxB_CONCURRENT_SETELEMENT with many user threads, by comparing the
+// results with GrB_Matrix_setElement from a single thread.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Vector_free (&u) ;              \
+    if (I != NULL) free (I) ;           \
+    if (J != NULL) free (J) ;           \
+    if (X != NULL) free (X) ;           \
+    I = NULL ; J = NULL ; X = NULL ;    \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random FP64 matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test60 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL, T = NULL ;
+    GrB_Vector v = NULL, u = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (60) ;
+
+    I = malloc (200 * 300 * sizeof (GrB_Index)) ;
+    J = malloc (200 * 300 * sizeof (GrB_Index)) ;
+    X = malloc (200 * 300 * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_CONCURRENT_SETELEMENT
+    //--------------------------------------------------------------------------
+
+    // more user threads than slots, so some tuples go to the spill list
+    int nthreads = GB_CONCURRENT_NSLOTS + 8 ;
+    GrB_Index n = 1000 ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                int sparsity = sparsity_list [k] ;
+                printf ("concurrent: sparsity %d by_col %d iso %d\n",
+                    sparsity, by_col, iso) ;
+                OK (random_matrix (&C, 200, 300, sparsity, by_col, iso)) ;
+                OK (GrB_Matrix_dup (&T, C)) ;
+                int32_t s = 1 ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == 0) ;
+                OK (GrB_Matrix_set_INT32 (C, true,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == 1) ;
+
+                for (int trial = 0 ; trial < 3 ; trial++)
+                {
+                    // each (i,j) appears once, so the result does not depend
+                    // on the order in which the threads set their entries
+                    int64_t ntuples = 200 * 300 / (trial + 2) ;
+                    for (int64_t t = 0 ; t < ntuples ; t++)
+                    {
+                        int64_t p = (t * 7919 + trial) % (200 * 300) ;
+                        I [t] = p % 200 ;
+                        J [t] = p / 200 ;
+                        X [t] = iso ? 1 : (double) (t % 1000) ;
+                    }
+                    int64_t nfail = 0, t ;
+                    #pragma omp parallel for num_threads(nthreads) \
+                        schedule(dynamic,7) reduction(+:nfail)
+                    for (t = 0 ; t < ntuples ; t++)
+                    {
+                        GrB_Info thread_info = (t % 3 == 0) ?
+                            GrB_Matrix_setElement_INT32 (C, (int32_t) X [t],
+                                I [t], J [t]) :
+                            GrB_Matrix_setElement_FP64 (C, X [t], I [t], J [t]);
+                        if (thread_info != GrB_SUCCESS) nfail++ ;
+                    }
+                    CHECK (nfail == 0) ;
+                    for (t = 0 ; t < ntuples ; t++)
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (T, X [t], I [t],
+                            J [t])) ;
+                    }
+                    CHECK (isequal (C, T)) ;
+                }
+
+                // a row or column index out of bounds
+                expected = GrB_INVALID_INDEX ;
+                ERR (GrB_Matrix_setElement_FP64 (C, 1, 200, 0)) ;
+                ERR (GrB_Matrix_setElement_FP64 (C, 1, 0, 300)) ;
+
+                // tuples still held in C->concurrent are assembled when the
+                // setting is disabled
+                OK (GrB_Matrix_setElement_FP64 (C, 42, 7, 8)) ;
+                OK (GrB_Matrix_setElement_FP64 (T, 42, 7, 8)) ;
+                OK (GrB_Matrix_set_INT32 (C, false,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == 0) ;
+                CHECK (C->concurrent == NULL) ;
+                CHECK (isequal (C, T)) ;
+                OK (GrB_Matrix_free (&C)) ;
+                OK (GrB_Matrix_free (&T)) ;
+            }
+        }
+    }
+
+    // concurrent setElement on a vector
+    OK (GrB_Vector_new (&v, GrB_FP64, n)) ;
+    OK (GrB_Vector_new (&u, GrB_FP64, n)) ;
+    OK (GrB_Vector_set_INT32 (v, true, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+    int64_t nfail = 0, t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,3) \
+        reduction(+:nfail)
+    for (t = 0 ; t < (int64_t) n ; t++)
+    {
+        if (GrB_Vector_setElement_FP64 (v, (double) t, t) != GrB_SUCCESS)
+        {
+            nfail++ ;
+        }
+    }
+    CHECK (nfail == 0) ;
+    for (t = 0 ; t < (int64_t) n ; t++)
+    {
+        OK (GrB_Vector_setElement_FP64 (u, (double) t, t)) ;
+    }
+    CHECK (isequal ((GrB_Matrix) v, (GrB_Matrix) u)) ;
+    OK (GrB_Vector_free (&v)) ;
+    OK (GrB_Vector_free (&u)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test60:  all tests passed\n\n") ;
+}
+
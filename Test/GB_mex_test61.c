@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+// GB_mex_test61: test GxB_Matrix_insertTuples and deleteTuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests GxB_Matrix_insertTuples and GxB_Matrix_deleteTuples, by comparing
+// their results with GrB_Matrix_setElement and GrB_Matrix_removeElement.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define NTUPLES 50000
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&T) ;              \
+    if (I != NULL) free (I) ;           \
+    if (J != NULL) free (J) ;           \
+    if (X != NULL) free (X) ;           \
+    I = NULL ; J = NULL ; X = NULL ;    \
+}
+
+//------------------------------------------------------------------------------
+// isequal: ensure two matrices are identical
+//------------------------------------------------------------------------------
+
+bool isequal (GrB_Matrix C1, GrB_Matrix C2) ;
+bool isequal (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    // finish any pending work
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // ensure C2 has the same sparsity and row/col storage as C1
+    int32_t s ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_get_INT32 (C1, &s, (GrB_Field) GxB_SPARSITY_STATUS)) ;
+    OK (GrB_Matrix_set_INT32 (C2,  s, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    // check if C1 and C2 are equal
+    return (GB_mx_isequal (C1, C2, 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random FP64 matrix with a given format
+//------------------------------------------------------------------------------
+
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col, bool iso) ;
+GrB_Info random_matrix (GrB_Matrix *A, GrB_Index nrows, GrB_Index ncols,
+    int sparsity, bool by_col, bool iso)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    OK (GrB_Matrix_new (A, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_set_INT32 (*A, by_col ? GrB_COLMAJOR : GrB_ROWMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (*A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries present
+        OK (GrB_Matrix_assign_FP64 (*A, NULL, NULL, 1, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < (int64_t) (nrows * ncols / 4) ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : (double) (simple_rand_i ( ) % 1000) ;
+        OK (GrB_Matrix_setElement_FP64 (*A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (*A, GrB_MATERIALIZE)) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test61 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL, T = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int sparsity_list [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (61) ;
+
+    I = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = malloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = malloc (NTUPLES * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_insertTuples and GxB_Matrix_deleteTuples
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                int sparsity = sparsity_list [k] ;
+                printf ("insert/delete: sparsity %d by_col %d iso %d\n",
+                    sparsity, by_col, iso) ;
+                OK (random_matrix (&C, 200, 300, sparsity, by_col, iso)) ;
+                OK (GrB_Matrix_dup (&T, C)) ;
+
+                // one large batch, and then many small ones, with tuples
+                // that are in C and not in C, and with duplicates
+                for (int64_t batch = NTUPLES ; batch >= 10 ; batch /= 10)
+                {
+                    for (int64_t b = 0 ; b < NTUPLES / batch && b < 100 ; b++)
+                    {
+                        for (int64_t t = 0 ; t < batch ; t++)
+                        {
+                            I [t] = simple_rand_i ( ) % 200 ;
+                            J [t] = simple_rand_i ( ) % 300 ;
+                            X [t] = iso ? 1 : (double) (simple_rand_i ( )%1000);
+                        }
+
+                        // insert the tuples
+                        OK (GxB_Matrix_insertTuples (C, I, J, X, batch)) ;
+                        for (int64_t t = 0 ; t < batch ; t++)
+                        {
+                            OK (GrB_Matrix_setElement_FP64 (T, X [t], I [t],
+                                J [t])) ;
+                        }
+
+                        // delete half of them, and other tuples
+                        for (int64_t t = 0 ; t < batch ; t += 2)
+                        {
+                            I [t] = simple_rand_i ( ) % 200 ;
+                        }
+                        OK (GxB_Matrix_deleteTuples (C, I, J, batch / 2)) ;
+                        for (int64_t t = 0 ; t < batch / 2 ; t++)
+                        {
+                            OK (GrB_Matrix_removeElement (T, I [t], J [t])) ;
+                        }
+                    }
+                    CHECK (isequal (C, T)) ;
+                }
+
+                // an iso matrix with non-iso values
+                OK (GrB_Matrix_free (&C)) ;
+                OK (GrB_Matrix_free (&T)) ;
+                OK (random_matrix (&C, 200, 300, sparsity, by_col, true)) ;
+                OK (GrB_Matrix_dup (&T, C)) ;
+                for (int64_t t = 0 ; t < 100 ; t++)
+                {
+                    I [t] = simple_rand_i ( ) % 200 ;
+                    J [t] = simple_rand_i ( ) % 300 ;
+                    X [t] = (t == 50) ? 2 : 1 ;
+                }
+                OK (GxB_Matrix_insertTuples (C, I, J, X, 50)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                CHECK (C->iso) ;
+                OK (GxB_Matrix_insertTuples (C, I + 50, J + 50, X + 50, 50)) ;
+                for (int64_t t = 0 ; t < 100 ; t++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (T, X [t], I [t], J [t])) ;
+                }
+                CHECK (isequal (C, T)) ;
+                CHECK (!C->iso) ;
+
+                // indices out of bounds; C is not modified
+                expected = GrB_INDEX_OUT_OF_BOUNDS ;
+                I [99] = 200 ;
+                ERR1 (C, GxB_Matrix_insertTuples (C, I, J, X, 100)) ;
+                ERR1 (C, GxB_Matrix_deleteTuples (C, I, J, 100)) ;
+                I [99] = 0 ;
+                J [99] = 300 ;
+                ERR1 (C, GxB_Matrix_insertTuples (C, I, J, X, 100)) ;
+                ERR1 (C, GxB_Matrix_deleteTuples (C, I, J, 100)) ;
+                J [99] = 0 ;
+                CHECK (isequal (C, T)) ;
+
+                // no tuples
+                OK (GxB_Matrix_insertTuples (C, I, J, X, 0)) ;
+                OK (GxB_Matrix_deleteTuples (C, I, J, 0)) ;
+                CHECK (isequal (C, T)) ;
+                OK (GrB_Matrix_free (&C)) ;
+                OK (GrB_Matrix_free (&T)) ;
+            }
+        }
+    }
+
+    // an empty matrix becomes iso if all the tuples have the same value
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    for (int64_t t = 0 ; t < 20 ; t++)
+    {
+        I [t] = t % 10 ;
+        J [t] = t / 2 ;
+        X [t] = 3 ;
+    }
+    OK (GxB_Matrix_insertTuples (C, I, J, X, 20)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (C->iso) ;
+    GrB_Index nvals = 0 ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 20) ;
+    OK (GxB_Matrix_deleteTuples (C, I, J, 20)) ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 0) ;
+
+    // error handling
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_insertTuples (NULL, I, J, X, 1)) ;
+    ERR (GxB_Matrix_insertTuples (C, NULL, J, X, 1)) ;
+    ERR (GxB_Matrix_insertTuples (C, I, NULL, X, 1)) ;
+    ERR (GxB_Matrix_insertTuples (C, I, J, NULL, 1)) ;
+    ERR (GxB_Matrix_deleteTuples (NULL, I, J, 1)) ;
+    ERR (GxB_Matrix_deleteTuples (C, NULL, J, 1)) ;
+    ERR (GxB_Matrix_deleteTuples (C, I, NULL, 1)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR1 (C, GxB_Matrix_insertTuples (C, I, J, X, GrB_INDEX_MAX + 2)) ;
+    ERR1 (C, GxB_Matrix_deleteTuples (C, I, J, GrB_INDEX_MAX + 2)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test61:  all tests passed\n\n") ;
+}
+
@@ -0,0 +1,9 @@
+function test287
+%TEST287 test reuse of saxpy3 plans kept in a GxB_Context
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test38 ;
+fprintf ('test287 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test288
+%TEST288 test the block-compare and galloping intersections
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test39 ;
+fprintf ('test288 all tests passed.\n') ;
+
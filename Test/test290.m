@@ -0,0 +1,9 @@
+function test290
+%TEST290 test the JIT hash table: lookups, tombstones, and rehash
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test41 ;
+fprintf ('test290 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test291
+%TEST291 test GxB_JIT_warmup
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test42 ;
+fprintf ('test291 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test292
+%TEST292 test GxB_JIT_RECORD_FILE and GxB_JIT_export
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test43 ;
+fprintf ('test292 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test293
+%TEST293 test the sorted hash index of PreJIT kernels
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test44 ;
+fprintf ('test293 all tests passed.\n') ;
+
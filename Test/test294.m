@@ -0,0 +1,9 @@
+function test294
+%TEST294 test the cpu and compiler fingerprint of the JIT lib folder
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test45 ;
+fprintf ('test294 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test295
+%TEST295 test GxB_JIT_TUNE_REDUCE_PANEL
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test46 ;
+fprintf ('test295 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test296
+%TEST296 test the memory pool
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('test296 all tests passed.\n') ;
+
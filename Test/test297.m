@@ -0,0 +1,9 @@
+function test297
+%TEST297 test the saxpy3 workspace kept in a GxB_Context
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test48 ;
+fprintf ('test297 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test298
+%TEST298 test GxB_NUMA_FIRST_TOUCH
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test49 ;
+fprintf ('test298 all tests passed.\n') ;
+
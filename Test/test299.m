@@ -0,0 +1,9 @@
+function test299
+%TEST299 test GxB_MEMORY_HUGE_PAGES
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test50 ;
+fprintf ('test299 all tests passed.\n') ;
+
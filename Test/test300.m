@@ -0,0 +1,9 @@
+function test300
+%TEST300 test copy-on-write GrB_*_dup
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test51 ;
+fprintf ('test300 all tests passed.\n') ;
+
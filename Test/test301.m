@@ -0,0 +1,9 @@
+function test301
+%TEST301 test GxB_Matrix_view
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test52 ;
+fprintf ('test301 all tests passed.\n') ;
+
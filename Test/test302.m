@@ -0,0 +1,9 @@
+function test302
+%TEST302 test GxB_Matrix_mmap_write and GxB_Matrix_mmap_read
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test53 ;
+fprintf ('test302 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test303
+%TEST303 test GxB_COMPRESSION_ALIGNED and GxB_Matrix_deserialize_view
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test54 ;
+fprintf ('test303 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test304
+%TEST304 test GxB_Matrix_serialize_stream and deserialize_stream
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test55 ;
+fprintf ('test304 all tests passed.\n') ;
+
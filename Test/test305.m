@@ -0,0 +1,9 @@
+function test305
+%TEST305 test GxB_COMPRESSION_FILTER
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test56 ;
+fprintf ('test305 all tests passed.\n') ;
+
@@ -0,0 +1,9 @@
+function test306
+%TEST306 test GxB_BUILD_RADIX_SORT
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test57 ;
+fprintf ('test306 all tests passed.\n') ;
+
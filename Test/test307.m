@@ -0,0 +1,9 @@
+function test307
+%TEST307 test GxB_Builder
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test58 ;
+fprintf ('test307 all tests passed.\n') ;
+
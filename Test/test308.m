@@ -0,0 +1,9 @@
+function test308
+%TEST308 test GxB_BUILD_HASH
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test59 ;
+fprintf ('test308 all tests passed.\n') ;
+
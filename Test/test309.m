@@ -0,0 +1,9 @@
+function test309
+%TEST309 test GxB_CONCURRENT_SETELEMENT
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test60 ;
+fprintf ('test309 all tests passed.\n') ;
+
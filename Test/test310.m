@@ -0,0 +1,9 @@
+function test310
+%TEST310 test GxB_Matrix_insertTuples and deleteTuples
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test61 ;
+fprintf ('test310 all tests passed.\n') ;
+
@@ -229,6 +229,30 @@ logstat ('testc2(1,1)',t, J44  , F10  ) ; % complex tests (quick case, builtin)
 logstat ('test227'    ,t, J4   , F1   ) ; % kron
 logstat ('test141'    ,t, J0   , F1   ) ; % eWiseAdd with dense matrices
 logstat ('test179'    ,t, J44  , F10  ) ; % bitmap select
+logstat ('test287'    ,t, J4   , F1   ) ; % saxpy3 plan reuse in a Context
+logstat ('test288'    ,t, J4   , F1   ) ; % SIMD and galloping intersection
+logstat ('test289'    ,t, J4   , F1   ) ; % JIT compile in background
+logstat ('test290'    ,t, J4   , F1   ) ; % JIT hash table, tombstones
+logstat ('test291'    ,t, J4   , F1   ) ; % JIT warmup
+logstat ('test292'    ,t, J4   , F1   ) ; % JIT record file and export
+logstat ('test293'    ,t, J4   , F1   ) ; % PreJIT lazy registration
+logstat ('test294'    ,t, J4   , F1   ) ; % JIT lib folder fingerprint
+logstat ('test295'    ,t, J4   , F1   ) ; % JIT reduce panel tuning
+logstat ('test296'    ,t, J4   , F1   ) ; % memory pool
+logstat ('test297'    ,t, J4   , F1   ) ; % saxpy3 workspace reuse
+logstat ('test298'    ,t, J4   , F1   ) ; % NUMA first touch
+logstat ('test299'    ,t, J4   , F1   ) ; % transparent huge pages
+logstat ('test300'    ,t, J4   , F1   ) ; % copy-on-write dup
+logstat ('test301'    ,t, J4   , F1   ) ; % zero-copy views
+logstat ('test302'    ,t, J4   , F1   ) ; % mmap matrices
+logstat ('test303'    ,t, J4   , F1   ) ; % aligned blobs and views
+logstat ('test304'    ,t, J4   , F1   ) ; % serialize streams
+logstat ('test305'    ,t, J4   , F1   ) ; % serialize pre-filters
+logstat ('test306'    ,t, J4   , F1   ) ; % radix sort build
+logstat ('test307'    ,t, J4   , F1   ) ; % GxB_Builder
+logstat ('test308'    ,t, J4   , F1   ) ; % hash build
+logstat ('test309'    ,t, J4   , F1   ) ; % concurrent setElement
+logstat ('test310'    ,t, J4   , F1   ) ; % insertTuples and deleteTuples
 
 % 1 to 10 seconds, no Werk, debug_off
 hack (2) = 1 ; GB_mex_hack (hack) ;     % disable the Werk stack
@@ -12,13 +12,35 @@
 #-------------------------------------------------------------------------------
 
 file ( GLOB PRE1 "PreJIT/GB_jit_*.c" )
+
+# The kernels are sorted by their hash, which is found in the query function
+# of each kernel, so that GraphBLAS can find a PreJIT kernel with a binary
+# search the first time it is needed, rather than registering all of them in
+# GrB_init.  A kernel whose hash cannot be found is given a hash of zero, and
+# is registered in GrB_init.
+set ( PRE2 "" )
+foreach ( PSRC ${PRE1} )
+    get_filename_component ( F ${PSRC} NAME_WE )
+    file ( STRINGS ${PSRC} PHASH REGEX "\\(\\*hash\\) = 0x[0-9a-f]+" )
+    string ( REGEX MATCH "0x[0-9a-f]+" PHASH "${PHASH}" )
+    string ( LENGTH "${PHASH}" PHASH_LEN )
+    if ( NOT PHASH_LEN EQUAL 18 )
+        set ( PHASH "0x0000000000000000" )
+    endif ( )
+    list ( APPEND PRE2 "${PHASH}_${F}" )
+endforeach ( )
+list ( SORT PRE2 )
+
 set ( PREJIT "" )
 set ( PREPRO "" )
 set ( PREQUERY "" )
 set ( PREQ "" )
-foreach ( PSRC ${PRE1} )
-    get_filename_component ( F ${PSRC} NAME_WE )
+set ( PREHASH "" )
+foreach ( PH ${PRE2} )
+    string ( SUBSTRING ${PH} 0 18 PHASH )
+    string ( SUBSTRING ${PH} 19 -1 F )
     list ( APPEND PREJIT ${F} )
+    list ( APPEND PREHASH ${PHASH} )
     list ( APPEND PREQUERY "JIT_Q (" ${F} "_query)\n" )
     list ( APPEND PREQ "${F}_query" )
     if ( ${F} MATCHES "^GB_jit__add_" )
@@ -130,6 +152,7 @@ list ( JOIN PREJIT "\",\n\"" PRENAMES )
 list ( LENGTH PREJIT GB_PREJIT_LEN )
 list ( JOIN PREJIT ",\n" PREFUNCS )
 list ( JOIN PREQ ",\n" PREQFUNCS )
+list ( JOIN PREHASH ",\n" PREHASHES )
 
 configure_file ( "Config/GB_prejit.c.in"
     "${PROJECT_SOURCE_DIR}/Config/GB_prejit.c"